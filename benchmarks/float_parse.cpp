@@ -0,0 +1,179 @@
+#include "float_parser.hpp"
+#include "generator.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+// -- float parsing benchmark -------------------------------------------------
+
+/* checks engine::float_parser bit for bit against strtof on random inputs
+   (obj style fixed point, shortest round trip, scientific, subnormals, long
+   digit strings, halfway cases, specials), then compares floats per second
+   usage: float_parse [count] */
+
+
+/* random bit pattern reinterpreted as float */
+static auto random_float(void) -> float {
+	const auto bits = static_cast<std::uint32_t>(benchmark::next());
+	float value;
+	std::memcpy(&value, &bits, sizeof(float));
+	return value;
+}
+
+/* one random input string */
+static auto random_input(const std::size_t kind) -> std::string {
+
+	char buffer[512];
+
+	switch (kind % 8U) {
+
+		// obj exporters
+		case 0U:
+			std::snprintf(buffer, sizeof(buffer), "%f", static_cast<double>(benchmark::uniform(-100.0f, 100.0f)));
+			break;
+
+		// shortest round trip of any finite float
+		case 1U: {
+			float value = random_float();
+			while (not std::isfinite(value))
+				value = random_float();
+			std::snprintf(buffer, sizeof(buffer), "%.9g", static_cast<double>(value));
+			break;
+		}
+
+		// scientific
+		case 2U:
+			std::snprintf(buffer, sizeof(buffer), "%.6e", static_cast<double>(random_float()));
+			break;
+
+		// subnormal range
+		case 3U:
+			std::snprintf(buffer, sizeof(buffer), "%.12e",
+						  static_cast<double>(benchmark::uniform(0.0f, 1.0f)) * 1.5e-38);
+			break;
+
+		// exactly halfway between two floats (needs more than 19 digits)
+		case 4U: {
+			float value = random_float();
+			while (not std::isfinite(value) || value == 0.0f)
+				value = random_float();
+			const double next = static_cast<double>(std::nextafter(value, std::numeric_limits<float>::infinity()));
+			std::snprintf(buffer, sizeof(buffer), "%.60g", (static_cast<double>(value) + next) / 2.0);
+			break;
+		}
+
+		// long digit strings
+		case 5U: {
+			std::size_t n = 0U;
+			n += static_cast<std::size_t>(std::snprintf(buffer, sizeof(buffer), "%u.", static_cast<unsigned>(benchmark::next() % 1000U)));
+			const std::size_t digits = 20U + benchmark::next() % 150U;
+			for (std::size_t i = 0U; i < digits; ++i)
+				buffer[n++] = static_cast<char>('0' + benchmark::next() % 10U);
+			std::snprintf(buffer + n, sizeof(buffer) - n, "e%d", static_cast<int>(benchmark::next() % 80U) - 40);
+			break;
+		}
+
+		// integers and short decimals
+		case 6U:
+			std::snprintf(buffer, sizeof(buffer), "%d.%u", static_cast<int>(benchmark::next() % 20001U) - 10000,
+						  static_cast<unsigned>(benchmark::next() % 1000U));
+			break;
+
+		// specials and extremes
+		default: {
+			static const char* const specials[] {
+				"0", "-0", "0.0", ".5", "5.", "+1", "inf", "-Infinity", "nan", "NaN(123)",
+				"1e39", "-1e39", "1e-46", "3.4028235e38", "3.4028236e38", "1.17549435e-38",
+				"1.4e-45", "7e-46", "7.1e-46", "0.000000000000000000000000000000001",
+				"16777217", "16777216.5", "1e10", "1e-10", "123456789012345678901234567890"
+			};
+			return specials[benchmark::next() % (sizeof(specials) / sizeof(specials[0]))];
+		}
+	}
+	return buffer;
+}
+
+/* same bits (any nan matches any nan) */
+static auto same(const float a, const float b) -> bool {
+	if (std::isnan(a) && std::isnan(b))
+		return true;
+	return std::memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+
+int main(int ac, char** av) {
+
+	const std::size_t count = ac > 1 ? std::strtoull(av[1], nullptr, 10) : 2'000'000U;
+
+	std::vector<std::string> inputs;
+	inputs.reserve(count);
+
+	for (std::size_t i = 0U; i < count; ++i)
+		inputs.emplace_back(random_input(i));
+
+	// -- property: identical to strtof ---------------------------------------
+
+	std::size_t mismatches = 0U;
+
+	for (const auto& input : inputs) {
+
+		const char* it  = input.data();
+		const char* end = input.data() + input.size();
+		float value     = 0.0f;
+
+		if (not engine::float_parser::parse(it, end, value) || it != end) {
+			if (++mismatches < 10U)
+				std::cerr << "rejected: " << input << std::endl;
+			continue;
+		}
+
+		const float expected = std::strtof(input.c_str(), nullptr);
+
+		if (not same(value, expected)) {
+			if (++mismatches < 10U)
+				std::fprintf(stderr, "mismatch: %s -> %.9g (strtof %.9g)\n", input.c_str(),
+							 static_cast<double>(value), static_cast<double>(expected));
+		}
+	}
+
+	std::printf("%zu inputs, %zu mismatches against strtof\n", count, mismatches);
+
+	// -- throughput on obj style input ---------------------------------------
+
+	std::vector<std::string> obj;
+	obj.reserve(count);
+
+	for (std::size_t i = 0U; i < count; ++i)
+		obj.emplace_back(random_input(0U));
+
+	const auto measure = [&](const char* name, auto&& parse) -> void {
+		float sum = 0.0f;
+		const auto start = std::chrono::steady_clock::now();
+		for (const auto& input : obj)
+			sum += parse(input);
+		const auto end   = std::chrono::steady_clock::now();
+		const double seconds = std::chrono::duration<double>(end - start).count();
+		std::printf("%-14s %10.3f s %10.2f Mfloats/s (checksum %g)\n",
+					name, seconds, static_cast<double>(count) / seconds / 1e6, static_cast<double>(sum));
+	};
+
+	measure("float_parser", [](const std::string& input) -> float {
+		const char* it = input.data();
+		float value = 0.0f;
+		engine::float_parser::parse(it, input.data() + input.size(), value);
+		return value;
+	});
+
+	measure("strtof", [](const std::string& input) -> float {
+		return std::strtof(input.c_str(), nullptr);
+	});
+
+	return mismatches == 0U ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,166 @@
+#ifndef BENCHMARK_GENERATOR_HPP
+#define BENCHMARK_GENERATOR_HPP
+
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+
+
+// -- B E N C H M A R K  N A M E S P A C E ------------------------------------
+
+namespace benchmark {
+
+
+	/* deterministic generator state */
+	inline std::uint64_t seed = 0x9e3779b97f4a7c15ULL;
+
+	/* xorshift */
+	inline auto next(void) noexcept -> std::uint64_t {
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		return seed;
+	}
+
+	/* uniform float */
+	inline auto uniform(const float min, const float max) noexcept -> float {
+		return min + (max - min) * static_cast<float>(next() >> 40) / static_cast<float>(1 << 24);
+	}
+
+	/* uniform float in [-1, 1] */
+	inline auto uniform(void) noexcept -> float {
+		return uniform(-1.0f, 1.0f);
+	}
+
+	/* generate obj file, return file size */
+	inline auto generate(const char* path, const std::size_t faces) -> std::size_t {
+
+		std::FILE* file = std::fopen(path, "w");
+
+		if (file == nullptr)
+			throw std::runtime_error{"failed to create benchmark file"};
+
+		const std::size_t count = faces / 2U + 3U;
+
+		std::fprintf(file, "# generated benchmark mesh\n");
+
+		// one vertex in eight with w, one with a color, one texcoord in eight with w
+		for (std::size_t i = 0U; i < count; ++i) {
+			std::fprintf(file, "v %f %f %f", uniform(-100.0f, 100.0f), uniform(-100.0f, 100.0f), uniform(-100.0f, 100.0f));
+			if ((i & 7U) == 0U)
+				std::fputs(" 1.0", file);
+			else if ((i & 7U) == 4U)
+				std::fprintf(file, " %f %f %f", uniform(0.0f, 1.0f), uniform(0.0f, 1.0f), uniform(0.0f, 1.0f));
+			std::fputc('\n', file);
+		}
+		for (std::size_t i = 0U; i < count; ++i)
+			std::fprintf(file, (i & 7U) == 0U ? "vt %f %f 0.0\n" : "vt %f %f\n", uniform(0.0f, 1.0f), uniform(0.0f, 1.0f));
+		for (std::size_t i = 0U; i < count; ++i)
+			std::fprintf(file, "vn %f %f %f\n", uniform(-1.0f, 1.0f), uniform(-1.0f, 1.0f), uniform(-1.0f, 1.0f));
+
+		for (std::size_t i = 0U; i < faces; ++i) {
+			const auto a = next() % count + 1U;
+			const auto b = next() % count + 1U;
+			const auto c = next() % count + 1U;
+			std::fprintf(file, "f %zu/%zu/%zu %zu/%zu/%zu %zu/%zu/%zu\n", a, a, a, b, b, b, c, c, c);
+		}
+
+		const auto size = static_cast<std::size_t>(std::ftell(file));
+		std::fclose(file);
+		return size;
+	}
+
+
+	/* mixed corpus file header (identifies a reusable file) */
+	inline constexpr const char* CORPUS_HEADER = "# engine corpus v2 faces %zu\r\n";
+
+	/* generate obj file with every face form (v, v/vt, v//vn, v/vt/vn), triangles,
+	   quads and n-gons, negative indices, vertices with w or a color, texcoords
+	   with w, full line and trailing comments and crlf endings, the same face count always gives the same bytes, an existing file
+	   with the same header is reused, return file size */
+	inline auto generate_mixed(const char* path, const std::size_t faces) -> std::size_t {
+
+		char header[64];
+		std::snprintf(header, sizeof(header), CORPUS_HEADER, faces);
+
+		if (std::FILE* existing = std::fopen(path, "rb"); existing != nullptr) {
+
+			char line[64] = {};
+			const bool same = std::fgets(line, sizeof(line), existing) != nullptr
+						   && std::strcmp(line, header) == 0;
+
+			std::fseek(existing, 0, SEEK_END);
+			const auto size = static_cast<std::size_t>(std::ftell(existing));
+			std::fclose(existing);
+
+			if (same)
+				return size;
+		}
+
+		std::FILE* file = std::fopen(path, "wb");
+
+		if (file == nullptr)
+			throw std::runtime_error{"failed to create benchmark file"};
+
+		seed = 0x9e3779b97f4a7c15ULL;
+
+		const std::size_t count = faces / 2U + 3U;
+
+		std::fputs(header, file);
+
+		for (std::size_t i = 0U; i < count; ++i) {
+			if ((i & 0x3fU) == 0U)
+				std::fputs("# vertex block\r\n", file);
+			std::fprintf(file, "v %f %f %f", uniform(-100.0f, 100.0f), uniform(-100.0f, 100.0f), uniform(-100.0f, 100.0f));
+			if ((i & 7U) == 1U)
+				std::fprintf(file, " %f", uniform(0.5f, 2.0f));
+			else if ((i & 7U) == 5U)
+				std::fprintf(file, " %f %f %f", uniform(0.0f, 1.0f), uniform(0.0f, 1.0f), uniform(0.0f, 1.0f));
+			std::fputs("\r\n", file);
+			std::fprintf(file, (i & 7U) == 3U ? "vt %f %f 0.0\r\n" : "vt %f %f\r\n", uniform(0.0f, 1.0f), uniform(0.0f, 1.0f));
+			std::fprintf(file, "vn %f %f %f\r\n", uniform(-1.0f, 1.0f), uniform(-1.0f, 1.0f), uniform(-1.0f, 1.0f));
+		}
+
+		std::fputs("\r\n", file);
+
+		for (std::size_t i = 0U; i < faces; ++i) {
+
+			const auto r = next();
+
+			// 70% triangles, 25% quads, 5% pentagons and hexagons
+			const unsigned pick    = static_cast<unsigned>(r % 100U);
+			const unsigned corners = pick < 70U ? 3U : pick < 95U ? 4U : 5U + static_cast<unsigned>((r >> 8) & 1U);
+			const unsigned form    = static_cast<unsigned>((r >> 16) & 3U);
+			const bool relative    = ((r >> 20) & 15U) == 0U;
+
+			if ((i & 0xffU) == 0U)
+				std::fputs("# face block\r\n", file);
+
+			std::fputc('f', file);
+
+			for (unsigned c = 0U; c < corners; ++c) {
+
+				const auto v = next() % count + 1U;
+				const long long k = relative ? static_cast<long long>(v) - static_cast<long long>(count) - 1 : static_cast<long long>(v);
+
+				switch (form) {
+					case 0U: std::fprintf(file, " %lld", k); break;
+					case 1U: std::fprintf(file, " %lld/%lld", k, k); break;
+					case 2U: std::fprintf(file, " %lld//%lld", k, k); break;
+					default: std::fprintf(file, " %lld/%lld/%lld", k, k, k); break;
+				}
+			}
+
+			std::fputs(((r >> 24) & 31U) == 0U ? " # tagged\r\n" : "\r\n", file);
+		}
+
+		const auto size = static_cast<std::size_t>(std::ftell(file));
+		std::fclose(file);
+		return size;
+	}
+
+}
+
+#endif // BENCHMARK_GENERATOR_HPP
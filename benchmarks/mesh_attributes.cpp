@@ -0,0 +1,292 @@
+#include "wavefront.hpp"
+#include "mesh_attributes.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+// -- mesh attributes benchmark -----------------------------------------------
+
+/* loads obj text without normals: a textured sphere (one smoothing group),
+   a box with s off and a box whose faces alternate two groups, checks the
+   generated normals against the exact ones, the vertex splits the groups
+   cause and the tangents (unit, orthogonal, along +u, bitangent along +v),
+   then times normals and tangents of a dense sphere on one thread and on
+   every core and fails when the two results differ by a single bit
+   usage: mesh_attributes [rings] */
+
+
+/* face data as the wavefront parser fills it */
+struct source final {
+
+	struct face final {
+		std::uint32_t v1, t1, n1, v2, t2, n2, v3, t3, n3;
+	};
+
+	struct smoothing final {
+		std::uint32_t face;
+		std::uint32_t id;
+	};
+
+	std::vector<engine::simd::float3> _positions;
+	std::vector<engine::simd::float2> _texcoords;
+	std::vector<engine::simd::float3> _normals;
+	std::vector<face> _faces;
+	std::vector<smoothing> _smoothing;
+};
+
+/* uv sphere of radius 1, u around y, v from the north pole, texture seam repeated */
+static auto sphere_text(const std::size_t rings) -> std::string {
+
+	std::string text;
+	const std::size_t segments = rings * 2U;
+	const double pi = 3.14159265358979323846;
+
+	for (std::size_t r = 0U; r <= rings; ++r)
+		for (std::size_t s = 0U; s <= segments; ++s) {
+			const double theta = pi * static_cast<double>(r) / static_cast<double>(rings);
+			const double phi   = 2.0 * pi * static_cast<double>(s % segments) / static_cast<double>(segments);
+			char line[160];
+			std::snprintf(line, sizeof(line), "v %.9f %.9f %.9f\nvt %.9f %.9f\n",
+						  std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi),
+						  static_cast<double>(s) / static_cast<double>(segments), static_cast<double>(r) / static_cast<double>(rings));
+			text += line;
+		}
+
+	text += "s 1\n";
+
+	for (std::size_t r = 0U; r < rings; ++r)
+		for (std::size_t s = 0U; s < segments; ++s) {
+			const std::size_t a = (r * (segments + 1U)) + s + 1U;
+			const std::size_t b = a + segments + 1U;
+			char line[160];
+			if (r != 0U) {
+				std::snprintf(line, sizeof(line), "f %zu/%zu %zu/%zu %zu/%zu\n", a, a, a + 1U, a + 1U, b, b);
+				text += line;
+			}
+			if (r + 1U != rings) {
+				std::snprintf(line, sizeof(line), "f %zu/%zu %zu/%zu %zu/%zu\n", a + 1U, a + 1U, b + 1U, b + 1U, b, b);
+				text += line;
+			}
+		}
+	return text;
+}
+
+/* unit box, quads wound outward, smoothing statement before each face */
+static auto box_text(const char* (&groups)[6]) -> std::string {
+
+	std::string text =
+		"v -1 -1 -1\nv 1 -1 -1\nv 1 1 -1\nv -1 1 -1\n"
+		"v -1 -1 1\nv 1 -1 1\nv 1 1 1\nv -1 1 1\n";
+
+	const char* faces[6] {
+		"f 1 4 3 2\n", "f 5 6 7 8\n", "f 1 2 6 5\n",
+		"f 4 8 7 3\n", "f 1 5 8 4\n", "f 2 3 7 6\n"
+	};
+
+	for (unsigned int i = 0U; i < 6U; ++i) {
+		text += std::string{"s "} + groups[i] + "\n";
+		text += faces[i];
+	}
+	return text;
+}
+
+/* same sphere as source data, for direct timing */
+static auto sphere_source(const std::size_t rings) -> source {
+
+	source data;
+	const std::size_t segments = rings * 2U;
+	const float pi = 3.14159265358979f;
+
+	for (std::size_t r = 0U; r <= rings; ++r)
+		for (std::size_t s = 0U; s <= segments; ++s) {
+			const float theta = pi * static_cast<float>(r) / static_cast<float>(rings);
+			const float phi   = 2.0f * pi * static_cast<float>(s % segments) / static_cast<float>(segments);
+			data._positions.push_back(engine::simd::float3{std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi)});
+		}
+
+	for (std::size_t r = 0U; r < rings; ++r)
+		for (std::size_t s = 0U; s < segments; ++s) {
+			const auto a = static_cast<std::uint32_t>((r * (segments + 1U)) + s + 1U);
+			const auto b = static_cast<std::uint32_t>(a + segments + 1U);
+			data._faces.push_back({a, 0U, 0U, a + 1U, 0U, 0U, b, 0U, 0U});
+			data._faces.push_back({a + 1U, 0U, 0U, b + 1U, 0U, 0U, b, 0U, 0U});
+		}
+	return data;
+}
+
+/* load text, false on a parse failure */
+static auto load(const std::string& text, engine::model& model) -> bool {
+	return engine::wavefront::load(text.data(), text.data() + text.size(), model, 1U);
+}
+
+/* largest tangent error: length, normal component, +u direction, bitangent along +v */
+static auto tangent_error(const engine::model& model) -> double {
+
+	double worst = 0.0;
+
+	for (std::size_t i = 0U; i < model.package.first.size(); ++i) {
+
+		const auto& v = model.package.first[i];
+		const auto& t = model.tangents[i];
+
+		// skip the poles, their tangent plane has no u gradient
+		if (std::abs(v.py()) > 0.999f)
+			continue;
+
+		const double length = std::sqrt(t.x * t.x + t.y * t.y + t.z * t.z);
+		const double normal = t.x * v.nx() + t.y * v.ny() + t.z * v.nz();
+
+		// d/du of the position, then bitangent = w * cross(n, t) against d/dv
+		const double r = std::sqrt(v.px() * v.px() + v.pz() * v.pz());
+		const double du[3] { -v.pz() / r, 0.0, v.px() / r };
+		const double along = t.x * du[0] + t.z * du[2];
+
+		const double b[3] { t.w * (v.ny() * t.z - v.nz() * t.y), t.w * (v.nz() * t.x - v.nx() * t.z), t.w * (v.nx() * t.y - v.ny() * t.x) };
+		const double down = -b[1];
+
+		worst = std::max({worst, std::abs(length - 1.0), std::abs(normal), 1.0 - along, down < 0.0 ? 1.0 : 0.0});
+	}
+	return worst;
+}
+
+
+int main(int ac, char** av) {
+
+	const std::size_t rings = ac > 1 ? std::strtoull(av[1], nullptr, 10) : 600U;
+
+	try {
+		bool ok = true;
+
+		// -- smooth textured sphere ----------------------------------------
+		{
+			engine::model model;
+			if (not load(sphere_text(48U), model))
+				throw std::runtime_error{"sphere did not load"};
+
+			double worst = 0.0;
+			for (const auto& v : model.package.first)
+				worst = std::max(worst, std::abs(1.0 - (v.nx() * v.px() + v.ny() * v.py() + v.nz() * v.pz())));
+
+			const double tangent = tangent_error(model);
+
+			std::printf("sphere: %zu vertices, normal error %.6f, tangent error %.6f\n",
+						model.package.first.size(), worst, tangent);
+
+			ok = ok && worst < 2e-3 && tangent < 2e-2 && model.tangents.size() == model.package.first.size();
+		}
+
+		// -- flat and split boxes ------------------------------------------
+		{
+			const char* flat[6]  { "off", "off", "off", "off", "off", "off" };
+			const char* split[6] { "1", "2", "1", "2", "1", "2" };
+			const char* single[6] { "1", "1", "1", "1", "1", "1" };
+
+			struct expected final { const char* name; const char* (&groups)[6]; std::size_t vertices; };
+			const expected boxes[] { {"flat box", flat, 24U}, {"split box", split, 14U}, {"smooth box", single, 8U} };
+
+			for (const auto& box : boxes) {
+
+				engine::model model;
+				if (not load(box_text(box.groups), model))
+					throw std::runtime_error{"box did not load"};
+
+				// flat faces take their axis, a fully smooth corner points along the diagonal
+				std::size_t wrong = 0U;
+				for (const auto& v : model.package.first) {
+					const double length = std::sqrt(v.nx() * v.nx() + v.ny() * v.ny() + v.nz() * v.nz());
+					const double outward = v.nx() * v.px() + v.ny() * v.py() + v.nz() * v.pz();
+					wrong += (std::abs(length - 1.0) > 1e-5 || outward <= 0.0) ? 1U : 0U;
+					if (box.vertices == 24U)
+						wrong += (std::abs(std::abs(v.nx()) + std::abs(v.ny()) + std::abs(v.nz()) - 1.0) > 1e-5) ? 1U : 0U;
+					if (box.vertices == 8U)
+						wrong += std::abs(outward - std::sqrt(3.0)) > 1e-5 ? 1U : 0U;
+				}
+
+				std::printf("%s: %zu vertices (%zu expected), %zu wrong normals\n",
+							box.name, model.package.first.size(), box.vertices, wrong);
+
+				ok = ok && wrong == 0U && model.package.first.size() == box.vertices;
+			}
+		}
+
+		// -- the getline parser fills them too -----------------------------
+		{
+			const char* path = "/tmp/engine_mesh_attributes.obj";
+			const std::string text = sphere_text(16U);
+
+			if (FILE* file = std::fopen(path, "wb")) {
+				std::fwrite(text.data(), 1U, text.size(), file);
+				std::fclose(file);
+			}
+
+			engine::vpackage package;
+			engine::wavefront{path}.parse2(package);
+
+			std::size_t zero = 0U;
+			for (const auto& v : package.first)
+				zero += (v.nx() == 0.0f && v.ny() == 0.0f && v.nz() == 0.0f) ? 1U : 0U;
+
+			std::printf("parse2: %zu corners, %zu without normal\n", package.first.size(), zero);
+			ok = ok && not package.first.empty() && zero == 0U;
+		}
+
+		// -- one thread against all ----------------------------------------
+		{
+			const auto threads = engine::parallel::concurrency();
+
+			source one = sphere_source(rings);
+			source all = sphere_source(rings);
+
+			const auto start  = std::chrono::steady_clock::now();
+			engine::mesh_attributes::normals(one, 1U);
+			const auto middle = std::chrono::steady_clock::now();
+			engine::mesh_attributes::normals(all, threads);
+			const auto end    = std::chrono::steady_clock::now();
+
+			bool same = one._normals.size() == all._normals.size()
+					 && std::memcmp(one._faces.data(), all._faces.data(), one._faces.size() * sizeof(source::face)) == 0;
+			for (std::size_t i = 0U; same && i < one._normals.size(); ++i)
+				same = std::memcmp(&one._normals[i], &all._normals[i], sizeof(float) * 3U) == 0;
+
+			std::printf("normals: %zu triangles, 1 thread %.1f ms, %zu threads %.1f ms%s\n",
+						one._faces.size(), std::chrono::duration<double, std::milli>(middle - start).count(),
+						threads, std::chrono::duration<double, std::milli>(end - middle).count(),
+						same ? "" : "  results differ");
+
+			engine::model a, b;
+			if (not load(sphere_text(rings / 4U), a) || not load(sphere_text(rings / 4U), b))
+				throw std::runtime_error{"sphere did not load"};
+
+			const auto t0 = std::chrono::steady_clock::now();
+			engine::mesh_attributes::tangents(a, 1U);
+			const auto t1 = std::chrono::steady_clock::now();
+			engine::mesh_attributes::tangents(b, threads);
+			const auto t2 = std::chrono::steady_clock::now();
+
+			const bool equal = a.tangents.size() == b.tangents.size()
+							&& std::memcmp(a.tangents.data(), b.tangents.data(), a.tangents.size() * sizeof(engine::simd::float4)) == 0;
+
+			std::printf("tangents: %zu triangles, 1 thread %.1f ms, %zu threads %.1f ms%s\n",
+						a.package.second.size() / 3U, std::chrono::duration<double, std::milli>(t1 - t0).count(),
+						threads, std::chrono::duration<double, std::milli>(t2 - t1).count(),
+						equal ? "" : "  results differ");
+
+			ok = ok && same && equal;
+		}
+
+		if (not ok)
+			return EXIT_FAILURE;
+
+	} catch (const std::exception& except) {
+		std::cerr << except.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
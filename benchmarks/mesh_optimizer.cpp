@@ -0,0 +1,160 @@
+#include "mesh_optimizer.hpp"
+#include "wavefront.hpp"
+#include "generator.hpp"
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+// -- mesh optimizer benchmark ------------------------------------------------
+
+/* optimizes a wavy grid with shuffled triangles and the mixed corpus,
+   prints acmr / atvr / fetch overfetch before and after at several
+   simulated cache sizes, fails when a pass loses a triangle or when
+   the grid acmr does not improve
+   usage: mesh_optimizer [grid side] [corpus faces] [directory] */
+
+
+/* triangle as its three positions, rotated to start at the smallest */
+using corner_key = std::array<float, 9U>;
+
+/* sorted triangle keys of a model */
+static auto triangles(const engine::model& model) -> std::vector<corner_key> {
+
+	const auto& [vertices, indexes] = model.package;
+	std::vector<corner_key> keys;
+	keys.reserve(indexes.size() / 3U);
+
+	for (std::size_t i = 0U; i + 2U < indexes.size(); i += 3U) {
+
+		std::array<std::array<float, 3U>, 3U> p;
+		for (std::size_t k = 0U; k < 3U; ++k) {
+			const auto& v = vertices[indexes[i + k]];
+			p[k] = {v.px(), v.py(), v.pz()};
+		}
+
+		std::size_t first = 0U;
+		for (std::size_t k = 1U; k < 3U; ++k)
+			first = p[k] < p[first] ? k : first;
+
+		corner_key key;
+		for (std::size_t k = 0U; k < 3U; ++k)
+			for (std::size_t c = 0U; c < 3U; ++c)
+				key[(k * 3U) + c] = p[(first + k) % 3U][c];
+		keys.push_back(key);
+	}
+
+	std::sort(keys.begin(), keys.end());
+	return keys;
+}
+
+/* optimize a copy at each cache size, print one row each, false on lost triangles or no gain */
+static auto run(const char* name, const engine::model& source, const bool must_improve) -> bool {
+
+	const auto reference = triangles(source);
+	bool ok = true;
+
+	std::printf("%s (%zu vertices, %zu triangles)\n", name,
+				source.package.first.size(), source.package.second.size() / 3U);
+
+	for (const std::size_t cache : {8U, 16U, 32U}) {
+
+		engine::model model = source;
+
+		const auto start  = std::chrono::steady_clock::now();
+		const auto report = engine::mesh_optimizer::optimize(model, cache);
+		const auto end    = std::chrono::steady_clock::now();
+
+		const double ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+		std::printf("  cache %2zu  acmr %5.3f -> %5.3f  atvr %5.3f -> %5.3f  overfetch %5.2f -> %5.2f  %9.1f ms\n",
+					cache, report.before.acmr, report.after.acmr, report.before.atvr, report.after.atvr,
+					report.before.overfetch, report.after.overfetch, ms);
+
+		if (triangles(model) != reference) {
+			std::printf("  triangles changed\n");
+			ok = false;
+		}
+
+		if (must_improve && report.after.acmr >= report.before.acmr) {
+			std::printf("  no acmr gain\n");
+			ok = false;
+		}
+	}
+
+	return ok;
+}
+
+
+int main(int ac, char** av) {
+
+	const std::size_t side  = ac > 1 ? std::strtoull(av[1], nullptr, 10) : 512U;
+	const std::size_t faces = ac > 2 ? std::strtoull(av[2], nullptr, 10) : 200'000U;
+	const std::string dir   = ac > 3 ? av[3] : "/tmp";
+
+	try {
+		bool ok = true;
+
+		// wavy grid, triangles in random order (worst case input)
+		{
+			engine::model grid;
+			auto& [vertices, indexes] = grid.package;
+
+			for (std::size_t y = 0U; y <= side; ++y)
+				for (std::size_t x = 0U; x <= side; ++x)
+					vertices.emplace_back(static_cast<float>(x), static_cast<float>(y),
+										  4.0f * std::sin(static_cast<float>(x + y) * 0.05f));
+
+			std::vector<std::array<unsigned int, 3U>> quads;
+
+			for (std::size_t y = 0U; y < side; ++y)
+				for (std::size_t x = 0U; x < side; ++x) {
+					const auto a = static_cast<unsigned int>((y * (side + 1U)) + x);
+					const auto c = static_cast<unsigned int>(a + side + 1U);
+					quads.push_back({a, a + 1U, c + 1U});
+					quads.push_back({a, c + 1U, c});
+				}
+
+			for (std::size_t i = quads.size(); i > 1U; --i)
+				std::swap(quads[i - 1U], quads[benchmark::next() % i]);
+
+			for (const auto& q : quads)
+				indexes.insert(indexes.end(), q.begin(), q.end());
+
+			ok = run("shuffled grid", grid, true) && ok;
+		}
+
+		// mixed corpus, random topology (little to gain, nothing to lose)
+		{
+			const std::string path = dir + "/engine_corpus_" + std::to_string(faces) + ".obj";
+			const auto bytes = benchmark::generate_mixed(path.data(), faces);
+			static_cast<void>(bytes);
+
+			const engine::mapped_file file{path.data()};
+
+			if (not file)
+				throw std::runtime_error{"failed to map corpus"};
+
+			engine::model corpus;
+
+			if (not engine::wavefront::load(file.begin(), file.end(), corpus))
+				throw std::runtime_error{"failed to parse corpus"};
+
+			ok = run(path.data(), corpus, false) && ok;
+		}
+
+		if (not ok)
+			return EXIT_FAILURE;
+
+	} catch (const std::exception& except) {
+		std::cerr << except.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,226 @@
+#include "mesh_simplifier.hpp"
+#include "mesh_optimizer.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+
+// -- mesh simplifier benchmark -----------------------------------------------
+
+/* builds lod chains for a textured sphere (uv seam, poles) and a wavy open
+   grid split in two materials, prints triangles, error and measured
+   deviation per level, then times the chains of several copies built one
+   after the other and in parallel, fails on an index out of range, a
+   degenerate or duplicated triangle, a level that does not shrink or an
+   error that does not grow
+   usage: mesh_simplifier [rings] [grid side] [copies] */
+
+
+/* uv sphere of radius 10 with a texture seam */
+static auto sphere(const std::size_t rings) -> engine::model {
+
+	engine::model model;
+	auto& [vertices, indexes] = model.package;
+
+	const std::size_t segments = rings * 2U;
+	const float pi = 3.14159265358979f;
+
+	for (std::size_t r = 0U; r <= rings; ++r)
+		for (std::size_t s = 0U; s <= segments; ++s) {
+			const float theta = pi * static_cast<float>(r) / static_cast<float>(rings);
+			const float phi   = 2.0f * pi * static_cast<float>(s % segments) / static_cast<float>(segments);
+			const float x = std::sin(theta) * std::cos(phi);
+			const float y = std::cos(theta);
+			const float z = std::sin(theta) * std::sin(phi);
+			vertices.emplace_back(10.0f * x, 10.0f * y, 10.0f * z, x, y, z,
+								  static_cast<float>(s) / static_cast<float>(segments),
+								  static_cast<float>(r) / static_cast<float>(rings));
+		}
+
+	for (std::size_t r = 0U; r < rings; ++r)
+		for (std::size_t s = 0U; s < segments; ++s) {
+			const auto a = static_cast<unsigned int>((r * (segments + 1U)) + s);
+			const auto b = static_cast<unsigned int>(a + segments + 1U);
+			if (r != 0U)
+				indexes.insert(indexes.end(), {a, b, a + 1U});
+			if (r + 1U != rings)
+				indexes.insert(indexes.end(), {a + 1U, b, b + 1U});
+		}
+
+	return model;
+}
+
+/* open grid on a sine wave, left and right halves in their own submesh */
+static auto grid(const std::size_t side) -> engine::model {
+
+	engine::model model;
+	auto& [vertices, indexes] = model.package;
+
+	for (std::size_t y = 0U; y <= side; ++y)
+		for (std::size_t x = 0U; x <= side; ++x) {
+			const float fx = static_cast<float>(x), fy = static_cast<float>(y);
+			vertices.emplace_back(fx, fy, 4.0f * std::sin(fx * 0.05f) * std::cos(fy * 0.03f), 0.0f, 0.0f, 1.0f,
+								  fx / static_cast<float>(side), fy / static_cast<float>(side));
+		}
+
+	for (std::uint32_t half = 0U; half < 2U; ++half) {
+
+		const auto offset = static_cast<std::uint32_t>(indexes.size());
+
+		for (std::size_t y = 0U; y < side; ++y)
+			for (std::size_t x = half * (side / 2U); x < (half == 0U ? side / 2U : side); ++x) {
+				const auto a = static_cast<unsigned int>((y * (side + 1U)) + x);
+				const auto c = static_cast<unsigned int>(a + side + 1U);
+				indexes.insert(indexes.end(), {a, a + 1U, c + 1U, a, c + 1U, c});
+			}
+
+		model.submeshes.push_back(engine::submesh{offset, static_cast<std::uint32_t>(indexes.size()) - offset,
+												  half, 0U, engine::bounds::at(vertices[0U])});
+	}
+
+	model.materials = {"left", "right"};
+	return model;
+}
+
+/* print the chain with the deviation measured on each level, false on a broken chain */
+template <typename D>
+static auto check(const char* name, const engine::model& model, const double ms, D&& deviation) -> bool {
+
+	const auto vcount = model.package.first.size();
+	bool ok = true;
+
+	std::printf("%s: %zu triangles, %zu levels in %.1f ms\n", name, model.package.second.size() / 3U, model.lods.size(), ms);
+
+	std::size_t previous = model.package.second.size();
+	float error = 0.0f;
+
+	for (std::size_t l = 0U; l < model.lods.size(); ++l) {
+
+		const auto& lod = model.lods[l];
+		const unsigned int* first = model.lod_indexes.data() + lod.index_offset;
+		std::size_t bad = 0U;
+
+		for (std::uint32_t i = 0U; i + 2U < lod.index_count; i += 3U) {
+			const unsigned int a = first[i], b = first[i + 1U], c = first[i + 2U];
+			bad += (a >= vcount || b >= vcount || c >= vcount || a == b || b == c || a == c) ? 1U : 0U;
+		}
+
+		const double measured = bad == 0U ? deviation(first, lod.index_count) : 0.0;
+
+		std::printf("  lod %zu  %7u triangles (%5.1f%%)  error %.5f  measured %.5f%s\n",
+					l + 1U, lod.index_count / 3U,
+					100.0 * static_cast<double>(lod.index_count) / static_cast<double>(model.package.second.size()),
+					static_cast<double>(lod.error), measured, bad != 0U ? "  broken triangles" : "");
+
+		ok = ok && bad == 0U && lod.index_count < previous && lod.error >= error;
+		previous = lod.index_count;
+		error    = lod.error;
+	}
+
+	if (not model.submeshes.empty() && model.lod_submeshes.size() != model.lods.size() * model.submeshes.size()) {
+		std::printf("  level submesh tables do not match\n");
+		ok = false;
+	}
+
+	return ok;
+}
+
+
+int main(int ac, char** av) {
+
+	const std::size_t rings  = ac > 1 ? std::strtoull(av[1], nullptr, 10) : 200U;
+	const std::size_t side   = ac > 2 ? std::strtoull(av[2], nullptr, 10) : 256U;
+	const std::size_t copies = ac > 3 ? std::strtoull(av[3], nullptr, 10) : 8U;
+
+	try {
+		bool ok = true;
+
+		auto timed = [](engine::model& model) -> double {
+			const auto start = std::chrono::steady_clock::now();
+			engine::mesh_simplifier::build(model);
+			const auto end   = std::chrono::steady_clock::now();
+			return std::chrono::duration<double, std::milli>(end - start).count();
+		};
+
+		{
+			engine::model model = sphere(rings);
+			engine::mesh_optimizer::optimize(model);
+			const double ms = timed(model);
+
+			const auto& vertices = model.package.first;
+
+			// centroids sink under the sphere, their depth is the surface error
+			ok = check("sphere", model, ms, [&vertices](const unsigned int* indexes, const std::uint32_t count) -> double {
+				double worst = 0.0;
+				for (std::uint32_t i = 0U; i + 2U < count; i += 3U) {
+					double c[3] { 0.0, 0.0, 0.0 };
+					for (std::uint32_t k = 0U; k < 3U; ++k) {
+						const auto& v = vertices[indexes[i + k]];
+						c[0] += v.px() / 3.0; c[1] += v.py() / 3.0; c[2] += v.pz() / 3.0;
+					}
+					worst = std::max(worst, 10.0 - std::sqrt(c[0] * c[0] + c[1] * c[1] + c[2] * c[2]));
+				}
+				return worst;
+			}) && ok;
+		}
+
+		{
+			engine::model model = grid(side);
+			engine::mesh_optimizer::optimize(model);
+			const double ms = timed(model);
+
+			const auto& vertices = model.package.first;
+
+			// centroid height against the wave
+			ok = check("grid", model, ms, [&vertices](const unsigned int* indexes, const std::uint32_t count) -> double {
+				double worst = 0.0;
+				for (std::uint32_t i = 0U; i + 2U < count; i += 3U) {
+					double c[3] { 0.0, 0.0, 0.0 };
+					for (std::uint32_t k = 0U; k < 3U; ++k) {
+						const auto& v = vertices[indexes[i + k]];
+						c[0] += v.px() / 3.0; c[1] += v.py() / 3.0; c[2] += v.pz() / 3.0;
+					}
+					const double wave = 4.0 * std::sin(c[0] * 0.05) * std::cos(c[1] * 0.03);
+					worst = std::max(worst, std::abs(c[2] - wave));
+				}
+				return worst;
+			}) && ok;
+		}
+
+		// several meshes, one after the other then one per worker
+		{
+			std::vector<engine::model> models(copies, sphere(rings));
+
+			for (auto& model : models)
+				engine::mesh_optimizer::optimize(model);
+
+			auto serial = models;
+
+			const auto start = std::chrono::steady_clock::now();
+			for (auto& model : serial)
+				engine::mesh_simplifier::build(model);
+			const auto middle = std::chrono::steady_clock::now();
+			engine::mesh_simplifier::build(models.data(), models.size());
+			const auto end = std::chrono::steady_clock::now();
+
+			std::printf("%zu spheres: serial %.1f ms, parallel %.1f ms\n", copies,
+						std::chrono::duration<double, std::milli>(middle - start).count(),
+						std::chrono::duration<double, std::milli>(end - middle).count());
+
+			for (std::size_t i = 0U; i < copies; ++i)
+				ok = ok && models[i].lod_indexes == serial[i].lod_indexes;
+		}
+
+		if (not ok)
+			return EXIT_FAILURE;
+
+	} catch (const std::exception& except) {
+		std::cerr << except.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,235 @@
+#include "cluster_culling.hpp"
+#include "mesh_optimizer.hpp"
+#include "meshlet.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+
+// -- meshlet culling benchmark -----------------------------------------------
+
+/* builds meshlets over an optimized dense sphere (a stand in for a scanned
+   mesh), culls them from cameras around and inside it, prints the triangles
+   rejected by the frustum and the normal cones, fails when a meshlet breaks
+   the size limits or when a rejected triangle could have been visible
+   usage: meshlet_culling [rings] [passes] */
+
+
+/* column major matrix from four columns */
+static auto columns(const engine::simd::float4 c0, const engine::simd::float4 c1,
+					const engine::simd::float4 c2, const engine::simd::float4 c3) -> engine::simd::float4x4 {
+	engine::simd::float4x4 m;
+	m.columns[0] = c0;
+	m.columns[1] = c1;
+	m.columns[2] = c2;
+	m.columns[3] = c3;
+	return m;
+}
+
+/* projection as engine::camera builds it (left handed, metal depth) */
+static auto projection(const float fov, const float ratio) -> engine::simd::float4x4 {
+	const float ys = 1.0f / std::tan(fov * 0.5f);
+	const float xs = ys / ratio;
+	const float zs = 1000.0f / (0.01f - 1000.0f);
+	return columns({xs, 0.0f, 0.0f, 0.0f}, {0.0f, ys, 0.0f, 0.0f},
+				   {0.0f, 0.0f, -zs, 1.0f}, {0.0f, 0.0f, zs * 0.1f, 0.0f});
+}
+
+/* view looking down +z after a yaw, from eye */
+static auto view(const engine::simd::float3 eye, const float yaw) -> engine::simd::float4x4 {
+	const float c = std::cos(yaw), s = std::sin(yaw);
+	// rotation transposed, then translated by -eye
+	const float tx = -(c * eye.x - s * eye.z);
+	const float tz = -(s * eye.x + c * eye.z);
+	return columns({c, 0.0f, s, 0.0f}, {0.0f, 1.0f, 0.0f, 0.0f},
+				   {-s, 0.0f, c, 0.0f}, {tx, -eye.y, tz, 1.0f});
+}
+
+/* element at row r, column c */
+static auto at(const engine::simd::float4x4& m, const unsigned int r, const unsigned int c) -> float {
+	const engine::simd::float4& column = m.columns[c];
+	return r == 0U ? column.x : r == 1U ? column.y : r == 2U ? column.z : column.w;
+}
+
+/* clip space position */
+static auto clip(const engine::simd::float4x4& m, const float x, const float y, const float z, float (&out)[4]) -> void {
+	for (unsigned int r = 0U; r < 4U; ++r)
+		out[r] = at(m, r, 0U) * x + at(m, r, 1U) * y + at(m, r, 2U) * z + at(m, r, 3U);
+}
+
+/* column major a * b */
+static auto multiply(const engine::simd::float4x4& a, const engine::simd::float4x4& b) -> engine::simd::float4x4 {
+	float out[4][4];
+	for (unsigned int c = 0U; c < 4U; ++c)
+		for (unsigned int r = 0U; r < 4U; ++r)
+			out[c][r] = at(a, r, 0U) * at(b, 0U, c) + at(a, r, 1U) * at(b, 1U, c)
+					  + at(a, r, 2U) * at(b, 2U, c) + at(a, r, 3U) * at(b, 3U, c);
+	return columns({out[0][0], out[0][1], out[0][2], out[0][3]}, {out[1][0], out[1][1], out[1][2], out[1][3]},
+				   {out[2][0], out[2][1], out[2][2], out[2][3]}, {out[3][0], out[3][1], out[3][2], out[3][3]});
+}
+
+/* uv sphere, outward normals */
+static auto sphere(const std::size_t rings) -> engine::model {
+
+	engine::model model;
+	auto& [vertices, indexes] = model.package;
+
+	const std::size_t segments = rings * 2U;
+	const float pi = 3.14159265358979f;
+
+	for (std::size_t r = 0U; r <= rings; ++r)
+		for (std::size_t s = 0U; s <= segments; ++s) {
+			const float theta = pi * static_cast<float>(r) / static_cast<float>(rings);
+			const float phi   = 2.0f * pi * static_cast<float>(s) / static_cast<float>(segments);
+			const float x = std::sin(theta) * std::cos(phi);
+			const float y = std::cos(theta);
+			const float z = std::sin(theta) * std::sin(phi);
+			vertices.emplace_back(10.0f * x, 10.0f * y, 10.0f * z, x, y, z);
+		}
+
+	for (std::size_t r = 0U; r < rings; ++r)
+		for (std::size_t s = 0U; s < segments; ++s) {
+			const auto a = static_cast<unsigned int>((r * (segments + 1U)) + s);
+			const auto b = static_cast<unsigned int>(a + segments + 1U);
+			indexes.insert(indexes.end(), {a, b, a + 1U, a + 1U, b, b + 1U});
+		}
+
+	return model;
+}
+
+
+int main(int ac, char** av) {
+
+	const std::size_t rings  = ac > 1 ? std::strtoull(av[1], nullptr, 10) : 700U;
+	const std::size_t passes = ac > 2 ? std::strtoull(av[2], nullptr, 10) : 20U;
+
+	try {
+		engine::model model = sphere(rings);
+		engine::mesh_optimizer::optimize(model);
+
+		const auto& vertices = model.package.first;
+		const auto& indexes  = model.package.second;
+
+		const auto start_build = std::chrono::steady_clock::now();
+		const engine::meshlets meshlets = engine::meshlet_builder::build(model);
+		const auto end_build   = std::chrono::steady_clock::now();
+
+		std::size_t covered = 0U, limits = 0U;
+		for (const auto& m : meshlets) {
+			covered += m.index_count;
+			limits  += (m.vertex_count > engine::meshlet_builder::MAX_VERTICES
+					 || m.index_count / 3U > engine::meshlet_builder::MAX_TRIANGLES) ? 1U : 0U;
+		}
+
+		std::printf("%zu triangles, %zu meshlets (%.1f triangles each), built in %.1f ms\n",
+					indexes.size() / 3U, meshlets.size(),
+					static_cast<double>(indexes.size() / 3U) / static_cast<double>(meshlets.size()),
+					std::chrono::duration<double, std::milli>(end_build - start_build).count());
+
+		if (covered != indexes.size() || limits != 0U)
+			throw std::runtime_error{"meshlets do not cover the mesh within limits"};
+
+		const auto proj = projection(1.0472f, 16.0f / 9.0f);
+		const engine::simd::float4x4 identity = columns({1.0f, 0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f, 0.0f},
+												{0.0f, 0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 0.0f, 1.0f});
+
+		struct shot final {
+			const char* name;
+			engine::simd::float3 eye;
+			float yaw;
+		};
+
+		const shot shots[] {
+			{"outside, facing", {0.0f, 0.0f, -30.0f}, 0.0f},
+			{"outside, close",  {0.0f, 0.0f, -14.0f}, 0.0f},
+			{"outside, aside",  {0.0f, 0.0f, -30.0f}, 0.6f},
+			{"inside",          {0.0f, 0.0f, 0.0f},   0.0f},
+			{"behind",          {0.0f, 0.0f, -30.0f}, 3.1416f},
+		};
+
+		bool safe = true;
+
+		for (const auto& s : shots) {
+
+			const auto v = view(s.eye, s.yaw);
+			const auto viewproj = multiply(proj, v);
+
+			std::vector<engine::cluster_culling::range> ranges;
+			engine::cluster_culling culling{proj, v, s.eye};
+
+			const auto start = std::chrono::steady_clock::now();
+			for (std::size_t p = 0U; p < passes; ++p) {
+				ranges.clear();
+				culling.reset();
+				culling.cull(meshlets, identity, ranges);
+			}
+			const auto end = std::chrono::steady_clock::now();
+
+			const auto& st = culling.stats();
+
+			// every triangle outside the ranges must be outside the frustum or facing away
+			std::vector<std::uint8_t> kept(indexes.size() / 3U, 0U);
+			for (const auto& r : ranges)
+				for (std::uint32_t t = r.index_offset / 3U; t < (r.index_offset + r.index_count) / 3U; ++t)
+					kept[t] = 1U;
+
+			std::size_t unsafe = 0U;
+
+			for (std::size_t t = 0U; t < kept.size(); ++t) {
+
+				if (kept[t] != 0U)
+					continue;
+
+				const auto& a = vertices[indexes[(t * 3U) + 0U]];
+				const auto& b = vertices[indexes[(t * 3U) + 1U]];
+				const auto& c = vertices[indexes[(t * 3U) + 2U]];
+
+				float ca[4], cb[4], cc[4];
+				clip(viewproj, a.px(), a.py(), a.pz(), ca);
+				clip(viewproj, b.px(), b.py(), b.pz(), cb);
+				clip(viewproj, c.px(), c.py(), c.pz(), cc);
+
+				auto out = [&](auto plane) -> bool {
+					return plane(ca) < 0.0f && plane(cb) < 0.0f && plane(cc) < 0.0f;
+				};
+
+				const bool culled_by_frustum =
+					   out([](const float (&p)[4]) { return p[3] + p[0]; }) || out([](const float (&p)[4]) { return p[3] - p[0]; })
+					|| out([](const float (&p)[4]) { return p[3] + p[1]; }) || out([](const float (&p)[4]) { return p[3] - p[1]; })
+					|| out([](const float (&p)[4]) { return p[2]; })        || out([](const float (&p)[4]) { return p[3] - p[2]; });
+
+				const double e1[3] { b.px() - a.px(), b.py() - a.py(), b.pz() - a.pz() };
+				const double e2[3] { c.px() - a.px(), c.py() - a.py(), c.pz() - a.pz() };
+				double n[3] { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+				if (n[0] * (a.nx() + b.nx() + c.nx()) + n[1] * (a.ny() + b.ny() + c.ny()) + n[2] * (a.nz() + b.nz() + c.nz()) < 0.0)
+					for (auto& k : n) k = -k;
+
+				const double facing = n[0] * (a.px() - s.eye.x) + n[1] * (a.py() - s.eye.y) + n[2] * (a.pz() - s.eye.z);
+
+				if (not culled_by_frustum && facing < 0.0)
+					++unsafe;
+			}
+
+			std::printf("  %-16s %6zu / %6zu meshlets  frustum %8zu  backface %8zu  rejected %5.1f%%  %8.3f ms  %zu unsafe\n",
+						s.name, st.visible, st.meshlets, st.frustum_rejected, st.backface_rejected,
+						100.0 * static_cast<double>(st.frustum_rejected + st.backface_rejected)
+							  / static_cast<double>(st.triangles),
+						std::chrono::duration<double, std::milli>(end - start).count() / static_cast<double>(passes),
+						unsafe);
+
+			safe = safe && unsafe == 0U;
+		}
+
+		if (not safe)
+			return EXIT_FAILURE;
+
+	} catch (const std::exception& except) {
+		std::cerr << except.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,178 @@
+#include "primitives.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <tuple>
+#include <type_traits>
+
+
+// -- primitives benchmark ----------------------------------------------------
+
+/* checks every baked primitive: indexes in range, no degenerate triangle,
+   faces wound outward (centroid side for the closed convex shapes, normal
+   side for all), unit normals and no duplicated vertex record, prints the
+   sizes in the binary and times a runtime copy against building the same
+   sphere with std::sin and std::cos
+   usage: primitives [passes] */
+
+
+/* compile time results */
+static constexpr auto grid        = engine::primitives::grid<32U>();
+static constexpr auto lines       = engine::primitives::grid_lines<20U>();
+static constexpr auto cuboid      = engine::primitives::cuboid<8U>();
+static constexpr auto sphere      = engine::primitives::sphere<24U, 48U>();
+static constexpr auto cylinder    = engine::primitives::cylinder<48U>();
+static constexpr auto cone        = engine::primitives::cone<48U>();
+static constexpr auto torus       = engine::primitives::torus<24U, 48U>();
+static constexpr auto icosahedron = engine::primitives::icosahedron();
+static constexpr auto octahedron  = engine::primitives::octahedron();
+static constexpr auto circle      = engine::primitives::circle<320U>();
+
+
+/* print sizes and problems, false on any */
+template <typename P>
+static auto check(const char* name, const P& p, const bool convex) -> bool {
+
+	const std::size_t vcount = p.vertices.size();
+	std::size_t range = 0U, degenerate = 0U, inward = 0U, flipped = 0U, normals = 0U, duplicates = 0U;
+
+	for (std::size_t i = 0U; i + 2U < p.indexes.size(); i += 3U) {
+
+		const std::size_t ia = p.indexes[i], ib = p.indexes[i + 1U], ic = p.indexes[i + 2U];
+
+		if (ia >= vcount || ib >= vcount || ic >= vcount) {
+			++range;
+			continue;
+		}
+
+		const auto& a = p.vertices[ia];
+		const auto& b = p.vertices[ib];
+		const auto& c = p.vertices[ic];
+
+		const double e1[3] { b.px() - a.px(), b.py() - a.py(), b.pz() - a.pz() };
+		const double e2[3] { c.px() - a.px(), c.py() - a.py(), c.pz() - a.pz() };
+		const double n[3] { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+		const double area = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+		if (area < 1e-9) {
+			++degenerate;
+			continue;
+		}
+
+		const double centroid[3] { a.px() + b.px() + c.px(), a.py() + b.py() + c.py(), a.pz() + b.pz() + c.pz() };
+		if (convex && n[0] * centroid[0] + n[1] * centroid[1] + n[2] * centroid[2] <= 0.0)
+			++inward;
+
+		const double normal[3] { a.nx() + b.nx() + c.nx(), a.ny() + b.ny() + c.ny(), a.nz() + b.nz() + c.nz() };
+		if (n[0] * normal[0] + n[1] * normal[1] + n[2] * normal[2] <= 0.0)
+			++flipped;
+	}
+
+	std::map<std::tuple<float, float, float, float, float, float, float, float>, std::size_t> seen;
+
+	for (const auto& v : p.vertices) {
+		const double length = std::sqrt(v.nx() * v.nx() + v.ny() * v.ny() + v.nz() * v.nz());
+		normals += std::abs(length - 1.0) > 1e-5 ? 1U : 0U;
+		duplicates += ++seen[{v.px(), v.py(), v.pz(), v.nx(), v.ny(), v.nz(), v.tu(), v.tv()}] > 1U ? 1U : 0U;
+	}
+
+	std::printf("  %-12s %6zu vertices %6zu triangles %8zu bytes (%zu-bit indexes)",
+				name, vcount, p.indexes.size() / 3U, sizeof(p), sizeof(typename P::index_type) * 8U);
+
+	const bool ok = range == 0U && degenerate == 0U && inward == 0U && flipped == 0U && normals == 0U && duplicates == 0U;
+
+	if (not ok)
+		std::printf("  range %zu degenerate %zu inward %zu flipped %zu normals %zu duplicates %zu",
+					range, degenerate, inward, flipped, normals, duplicates);
+
+	std::printf("\n");
+	return ok;
+}
+
+
+int main(int ac, char** av) {
+
+	const std::size_t passes = ac > 1 ? std::strtoull(av[1], nullptr, 10) : 1000U;
+
+	try {
+		bool ok = true;
+
+		ok = check("grid",        grid,        false) && ok;
+		ok = check("cuboid",      cuboid,      true)  && ok;
+		ok = check("sphere",      sphere,      true)  && ok;
+		ok = check("cylinder",    cylinder,    true)  && ok;
+		ok = check("cone",        cone,        true)  && ok;
+		ok = check("torus",       torus,       false) && ok;
+		ok = check("icosahedron", icosahedron, true)  && ok;
+		ok = check("octahedron",  octahedron,  true)  && ok;
+
+		// line list, two indexes per segment
+		std::size_t range = 0U;
+		for (const auto i : lines.indexes)
+			range += i >= lines.vertices.size() ? 1U : 0U;
+		std::printf("  %-12s %6zu vertices %6zu lines     %8zu bytes\n", "grid lines",
+					lines.vertices.size(), lines.indexes.size() / 2U, sizeof(lines));
+		ok = ok && range == 0U;
+
+		// 2D fan, every rim vertex on the unit circle
+		std::size_t off = 0U;
+		for (std::size_t i = 1U; i < circle.vertices.size(); ++i) {
+			const auto& p = circle.vertices[i].position();
+			off += std::abs(std::sqrt(p.x * p.x + p.y * p.y) - 1.0f) > 1e-5f ? 1U : 0U;
+		}
+		std::printf("  %-12s %6zu vertices %6zu triangles %8zu bytes\n", "circle",
+					circle.vertices.size(), circle.indexes.size() / 3U, sizeof(circle));
+		ok = ok && off == 0U;
+
+		// baked table against the same sphere built at runtime
+		std::remove_const_t<decltype(sphere)> copy{};
+		std::remove_const_t<decltype(sphere)> built{};
+
+		const auto start = std::chrono::steady_clock::now();
+		for (std::size_t p = 0U; p < passes; ++p) {
+			copy = sphere;
+			asm volatile("" : : "r"(copy.vertices.data()) : "memory");
+		}
+		const auto middle = std::chrono::steady_clock::now();
+		for (std::size_t p = 0U; p < passes; ++p) {
+			const float pi = 3.14159265358979f;
+			for (std::size_t r = 0U; r <= 24U; ++r)
+				for (std::size_t s = 0U; s <= 48U; ++s) {
+					const float theta = pi * static_cast<float>(r) / 24.0f;
+					const float phi   = 2.0f * pi * static_cast<float>(s % 48U) / 48.0f;
+					const float x = std::sin(theta) * std::cos(phi), y = std::cos(theta), z = std::sin(theta) * std::sin(phi);
+					built.vertices[r * 49U + s] = engine::vertex{x, y, z, x, y, z, static_cast<float>(s) / 48.0f,
+																 static_cast<float>(r) / 24.0f};
+				}
+			asm volatile("" : : "r"(built.vertices.data()) : "memory");
+		}
+		const auto end = std::chrono::steady_clock::now();
+
+		// the generators and the c library agree
+		float worst = 0.0f;
+		for (std::size_t i = 0U; i < sphere.vertices.size(); ++i)
+			worst = std::max({worst, std::abs(sphere.vertices[i].px() - built.vertices[i].px()),
+									 std::abs(sphere.vertices[i].py() - built.vertices[i].py()),
+									 std::abs(sphere.vertices[i].pz() - built.vertices[i].pz())});
+
+		std::printf("sphere: copy %.3f us, runtime build %.3f us, largest difference %g\n",
+					std::chrono::duration<double, std::micro>(middle - start).count() / static_cast<double>(passes),
+					std::chrono::duration<double, std::micro>(end - middle).count() / static_cast<double>(passes),
+					static_cast<double>(worst));
+
+		ok = ok && worst < 1e-5f;
+
+		if (not ok)
+			return EXIT_FAILURE;
+
+	} catch (const std::exception& except) {
+		std::cerr << except.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
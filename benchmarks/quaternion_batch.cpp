@@ -0,0 +1,145 @@
+#include "quaternion_batch.hpp"
+#include "generator.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+
+// -- quaternion batch benchmark ----------------------------------------------
+
+/* runs products, rotated vectors, rotation matrices, nlerp and slerp of
+   random unit quaternions through the soa batch and through the
+   simd::quatf functions one at a time, checks that they agree and
+   times both
+   usage: quaternion_batch [count] [passes] */
+
+
+/* quaternions as four arrays */
+struct soa final {
+
+	explicit soa(const std::size_t count)
+	: x(count), y(count), z(count), w(count) {}
+
+	auto set(const std::size_t i, const engine::simd::quatf& q) -> void {
+		x[i] = q.vector.x; y[i] = q.vector.y; z[i] = q.vector.z; w[i] = q.vector.w;
+	}
+
+	auto get(const std::size_t i) const -> engine::simd::quatf {
+		return engine::simd::quatf{x[i], y[i], z[i], w[i]};
+	}
+
+	std::vector<float> x, y, z, w;
+};
+
+
+int main(int ac, char** av) {
+
+	const std::size_t count  = ac > 1 ? std::strtoull(av[1], nullptr, 10) : 100003U;
+	const std::size_t passes = ac > 2 ? std::strtoull(av[2], nullptr, 10) : 32U;
+
+	namespace simd = engine::simd;
+	using batch = engine::quaternion_batch;
+
+	try {
+		std::vector<simd::quatf> a(count), b(count), products(count), nlerps(count), slerps(count);
+		std::vector<simd::float3> v(count), rotated(count);
+		std::vector<simd::float4x4> matrices(count), batched(count);
+		std::vector<float> t(count);
+
+		soa sa{count}, sb{count}, sp{count}, sn{count}, ss{count};
+		std::vector<float> vx(count), vy(count), vz(count), rx(count), ry(count), rz(count);
+
+		for (std::size_t i = 0U; i < count; ++i) {
+			a[i] = simd::quatf{benchmark::uniform() * 3.0f, simd::normalize(simd::float3{benchmark::uniform(), benchmark::uniform(), benchmark::uniform()})};
+			// every fourth pair nearly parallel, the nlerp branch of slerp
+			b[i] = (i & 3U) == 0U ? simd::normalize(simd::quatf{a[i].vector + simd::float4{benchmark::uniform() * 0.01f}})
+								  : simd::quatf{benchmark::uniform() * 3.0f, simd::normalize(simd::float3{benchmark::uniform(), benchmark::uniform(), benchmark::uniform()})};
+			v[i] = simd::float3{benchmark::uniform() * 10.0f, benchmark::uniform() * 10.0f, benchmark::uniform() * 10.0f};
+			t[i] = (benchmark::uniform() + 1.0f) * 0.5f;
+
+			sa.set(i, a[i]); sb.set(i, b[i]);
+			vx[i] = v[i].x; vy[i] = v[i].y; vz[i] = v[i].z;
+		}
+
+		auto one_by_one = [&](void) -> void {
+			for (std::size_t i = 0U; i < count; ++i) {
+				products[i] = a[i] * b[i];
+				rotated[i]  = simd::act(a[i], v[i]);
+				matrices[i] = simd::matrix4x4(a[i]);
+				nlerps[i]   = simd::nlerp(a[i], b[i], t[i]);
+				slerps[i]   = simd::slerp(a[i], b[i], t[i]);
+			}
+		};
+
+		auto batched_all = [&](void) -> void {
+			batch::multiply({sa.x.data(), sa.y.data(), sa.z.data(), sa.w.data()},
+							{sb.x.data(), sb.y.data(), sb.z.data(), sb.w.data()},
+							{sp.x.data(), sp.y.data(), sp.z.data(), sp.w.data()}, count);
+			batch::rotate({sa.x.data(), sa.y.data(), sa.z.data(), sa.w.data()},
+						  {vx.data(), vy.data(), vz.data()}, {rx.data(), ry.data(), rz.data()}, count);
+			batch::matrices({sa.x.data(), sa.y.data(), sa.z.data(), sa.w.data()}, batched.data(), count);
+			batch::nlerp({sa.x.data(), sa.y.data(), sa.z.data(), sa.w.data()},
+						 {sb.x.data(), sb.y.data(), sb.z.data(), sb.w.data()}, t.data(),
+						 {sn.x.data(), sn.y.data(), sn.z.data(), sn.w.data()}, count);
+			batch::slerp({sa.x.data(), sa.y.data(), sa.z.data(), sa.w.data()},
+						 {sb.x.data(), sb.y.data(), sb.z.data(), sb.w.data()}, t.data(),
+						 {ss.x.data(), ss.y.data(), ss.z.data(), ss.w.data()}, count);
+		};
+
+		// -- correctness ---------------------------------------------------
+		one_by_one();
+		batched_all();
+
+		double product = 0.0, rotation = 0.0, matrix = 0.0, nlerp = 0.0, slerp = 0.0;
+
+		for (std::size_t i = 0U; i < count; ++i) {
+			for (unsigned int k = 0U; k < 4U; ++k) {
+				product = std::max(product, static_cast<double>(std::abs(sp.get(i).vector[k] - products[i].vector[k])));
+				nlerp   = std::max(nlerp,   static_cast<double>(std::abs(sn.get(i).vector[k] - nlerps[i].vector[k])));
+				slerp   = std::max(slerp,   static_cast<double>(std::abs(ss.get(i).vector[k] - slerps[i].vector[k])));
+				for (unsigned int r = 0U; r < 4U; ++r)
+					matrix = std::max(matrix, static_cast<double>(std::abs(batched[i].columns[k][r] - matrices[i].columns[k][r])));
+			}
+			rotation = std::max({rotation, static_cast<double>(std::abs(rx[i] - rotated[i].x)),
+										   static_cast<double>(std::abs(ry[i] - rotated[i].y)),
+										   static_cast<double>(std::abs(rz[i] - rotated[i].z))});
+		}
+
+		std::printf("%zu quaternions, %zu per iteration: differences product %.3g, rotate %.3g, matrix %.3g, nlerp %.3g, slerp %.3g\n",
+					count, simd::width(), product, rotation, matrix, nlerp, slerp);
+
+		// -- timings -------------------------------------------------------
+		const auto t0 = std::chrono::steady_clock::now();
+		for (std::size_t p = 0U; p < passes; ++p) {
+			one_by_one();
+			asm volatile("" : : "r"(products.data()), "r"(slerps.data()) : "memory");
+		}
+		const auto t1 = std::chrono::steady_clock::now();
+		for (std::size_t p = 0U; p < passes; ++p) {
+			batched_all();
+			asm volatile("" : : "r"(sp.x.data()), "r"(ss.x.data()) : "memory");
+		}
+		const auto t2 = std::chrono::steady_clock::now();
+
+		const double n  = static_cast<double>(count * passes);
+		const double one = std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+		const double all = std::chrono::duration<double, std::nano>(t2 - t1).count() / n;
+
+		std::printf("product + rotate + matrix + nlerp + slerp per quaternion: one by one %.2f ns, batch %.2f ns (%.1fx)\n",
+					one, all, one / all);
+
+		if (product > 1e-6 || rotation > 1e-5 || matrix > 1e-6 || nlerp > 1e-6 || slerp > 1e-5)
+			return EXIT_FAILURE;
+
+	} catch (const std::exception& except) {
+		std::cerr << except.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,219 @@
+#include "simd.hpp"
+#include "generator.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+
+// -- simd benchmark ----------------------------------------------------------
+
+/* checks the selected backend against double precision references (vector
+   arithmetic, dot, cross, normalize, matrix products, transpose, inverses,
+   quaternion rotation and slerp), checks that the float3 padding lane stays
+   zero, prints a checksum of the results (equal across backends built
+   without fp contraction) and times matrix products and point transforms;
+   build with -DENGINE_SIMD_SCALAR to compare against the plain loops
+   usage: simd [count] [passes] */
+
+
+static auto random3(void) -> engine::simd::float3 {
+	return engine::simd::float3{benchmark::uniform(), benchmark::uniform(), benchmark::uniform()};
+}
+
+static auto random4(void) -> engine::simd::float4 {
+	return engine::simd::float4{benchmark::uniform(), benchmark::uniform(), benchmark::uniform(), benchmark::uniform()};
+}
+
+/* well conditioned matrix: diagonal dominant */
+static auto random4x4(void) -> engine::simd::float4x4 {
+	engine::simd::float4x4 m;
+	for (unsigned int c = 0U; c < 4U; ++c) {
+		m.columns[c] = random4();
+		m.columns[c][c] += 4.0f;
+	}
+	return m;
+}
+
+/* bytes folded into a checksum */
+static auto fold(std::uint64_t& sum, const void* data, const std::size_t size) -> void {
+	const auto* p = static_cast<const unsigned char*>(data);
+	for (std::size_t i = 0U; i < size; ++i)
+		sum = (sum ^ p[i]) * 0x100000001b3ULL;
+}
+
+
+int main(int ac, char** av) {
+
+	const std::size_t count  = ac > 1 ? std::strtoull(av[1], nullptr, 10) : 4096U;
+	const std::size_t passes = ac > 2 ? std::strtoull(av[2], nullptr, 10) : 256U;
+
+	namespace simd = engine::simd;
+
+	try {
+		double worst = 0.0;
+		std::size_t padding = 0U;
+		std::uint64_t sum = 0xcbf29ce484222325ULL;
+
+		auto check = [&](const double got, const double want) -> void {
+			worst = std::max(worst, std::abs(got - want) / std::max(1.0, std::abs(want)));
+		};
+
+		// -- vectors -------------------------------------------------------
+		for (std::size_t i = 0U; i < count; ++i) {
+
+			const auto a = random3(), b = random3();
+			const float s = benchmark::uniform() + 2.0f;
+
+			const simd::float3 results[] { a + b, a - b, a * b, a / (b + simd::float3{4.0f}), a * s, a / s, -a,
+										   simd::cross(a, b), simd::normalize(a), simd::min(a, b), simd::max(a, b),
+										   simd::abs(a), simd::mix(a, b, 0.25f) };
+
+			for (const auto& r : results) {
+				padding += r._pad != 0.0f ? 1U : 0U;
+				fold(sum, &r, sizeof(r));
+			}
+
+			const double ax = a.x, ay = a.y, az = a.z, bx = b.x, by = b.y, bz = b.z;
+
+			check(results[0].y, ay + by);
+			check(results[2].z, az * bz);
+			check(results[3].x, ax / (bx + 4.0));
+			check(results[5].z, az / s);
+			check(results[7].x, ay * bz - az * by);
+			check(results[7].y, az * bx - ax * bz);
+			check(results[7].z, ax * by - ay * bx);
+			check(simd::dot(a, b), ax * bx + ay * by + az * bz);
+			check(simd::length(results[8]), 1.0);
+			check(simd::distance(a, b), std::sqrt((ax - bx) * (ax - bx) + (ay - by) * (ay - by) + (az - bz) * (az - bz)));
+
+			const auto c = random4(), d = random4();
+			check(simd::dot(c, d), double{c.x} * d.x + double{c.y} * d.y + double{c.z} * d.z + double{c.w} * d.w);
+
+			const float dots[] { simd::dot(a, b), simd::dot(c, d) };
+			fold(sum, dots, sizeof(dots));
+		}
+
+		// -- matrices ------------------------------------------------------
+		for (std::size_t i = 0U; i < count; ++i) {
+
+			const auto a = random4x4(), b = random4x4();
+			const auto v = random4();
+
+			const auto ab = a * b;
+			const auto av = a * v;
+			const auto t  = simd::transpose(a);
+			const auto ai = simd::inverse(a);
+			const auto id = a * ai;
+
+			for (unsigned int r = 0U; r < 4U; ++r) {
+				double row = 0.0;
+				for (unsigned int k = 0U; k < 4U; ++k)
+					row += double{a.columns[k][r]} * v[k];
+				check(av[r], row);
+
+				for (unsigned int c = 0U; c < 4U; ++c) {
+					double dot = 0.0;
+					for (unsigned int k = 0U; k < 4U; ++k)
+						dot += double{a.columns[k][r]} * b.columns[c][k];
+					check(ab.columns[c][r], dot);
+					check(t.columns[c][r], a.columns[r][c]);
+					check(id.columns[c][r], r == c ? 1.0 : 0.0);
+				}
+			}
+
+			fold(sum, &ab, sizeof(ab));
+			fold(sum, &av, sizeof(av));
+			fold(sum, &t, sizeof(t));
+
+			simd::float3x3 m3{random3(), random3(), random3()};
+			for (unsigned int c = 0U; c < 3U; ++c)
+				m3.columns[c][c] += 4.0f;
+			const auto i3 = m3 * simd::inverse(m3);
+			for (unsigned int c = 0U; c < 3U; ++c) {
+				for (unsigned int r = 0U; r < 3U; ++r)
+					check(i3.columns[c][r], r == c ? 1.0 : 0.0);
+				padding += i3.columns[c]._pad != 0.0f ? 1U : 0U;
+			}
+		}
+
+		// -- quaternions ---------------------------------------------------
+		for (std::size_t i = 0U; i < count; ++i) {
+
+			const auto axis = simd::normalize(random3());
+			const float angle = benchmark::uniform() * 3.0f;
+			const simd::quatf q{angle, axis};
+			const simd::quatf p{benchmark::uniform() * 3.0f, simd::normalize(random3())};
+			const auto v = random3();
+
+			// act against the rotation matrix, products against composed rotations
+			const auto rotated = simd::act(q, v);
+			const auto matrix  = simd::matrix3x3(q) * v;
+			const auto twice   = simd::act(q * p, v);
+			const auto chained = simd::act(q, simd::act(p, v));
+			const auto back    = simd::act(simd::inverse(q), rotated);
+
+			for (unsigned int k = 0U; k < 3U; ++k) {
+				check(rotated[k], matrix[k]);
+				check(twice[k], chained[k]);
+				check(back[k], v[k]);
+			}
+
+			// slerp ends on its inputs and stays unit
+			const auto s0 = simd::slerp(q, p, 0.0f), s1 = simd::slerp(q, p, 1.0f), sh = simd::slerp(q, p, 0.5f);
+			check(std::abs(simd::dot(s0, q)), 1.0);
+			check(std::abs(simd::dot(s1, p)), 1.0);
+			check(simd::length(sh), 1.0);
+
+			padding += rotated._pad != 0.0f ? 1U : 0U;
+			fold(sum, &rotated, sizeof(rotated));
+		}
+
+		std::printf("backend %s: worst relative error %.3g, %zu dirty padding lanes, checksum %016llx\n",
+					simd::backend, worst, padding, static_cast<unsigned long long>(sum));
+
+		// -- timings -------------------------------------------------------
+		std::vector<simd::float4x4> models(count), products(count);
+		std::vector<simd::float4> points(count), moved(count);
+
+		for (std::size_t i = 0U; i < count; ++i) {
+			models[i] = random4x4();
+			points[i] = random4();
+		}
+
+		const simd::float4x4 viewproj = random4x4();
+
+		const auto start = std::chrono::steady_clock::now();
+		for (std::size_t p = 0U; p < passes; ++p) {
+			for (std::size_t i = 0U; i < count; ++i)
+				products[i] = viewproj * models[i];
+			asm volatile("" : : "r"(products.data()) : "memory");
+		}
+		const auto middle = std::chrono::steady_clock::now();
+		for (std::size_t p = 0U; p < passes; ++p) {
+			for (std::size_t i = 0U; i < count; ++i)
+				moved[i] = models[i & 63U] * points[i];
+			asm volatile("" : : "r"(moved.data()) : "memory");
+		}
+		const auto end = std::chrono::steady_clock::now();
+
+		const double n = static_cast<double>(count * passes);
+		std::printf("float4x4 * float4x4 %.2f ns, float4x4 * float4 %.2f ns\n",
+					std::chrono::duration<double, std::nano>(middle - start).count() / n,
+					std::chrono::duration<double, std::nano>(end - middle).count() / n);
+
+		if (worst > 1e-4 || padding != 0U)
+			return EXIT_FAILURE;
+
+	} catch (const std::exception& except) {
+		std::cerr << except.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
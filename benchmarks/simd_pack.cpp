@@ -0,0 +1,228 @@
+#include "simd_pack.hpp"
+#include "generator.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+
+// -- simd pack benchmark -----------------------------------------------------
+
+/* runs the dispatched kernels (world matrix composition, quaternion
+   products, rotated vectors, rotation matrices, nlerp and slerp) through
+   the copy of every instruction set the cpu runs, checks that each set
+   gets the bits of the scalar set (targets without fma, built with
+   -ffp-contract=off as the makefile does), then times them against it;
+   the makefile builds it without -march, as a fleet binary, since under
+   -march=native every set may use the wider encodings of the host
+   usage: simd_pack [count] [passes], ENGINE_SIMD=<set> picks the set of
+   the dispatch */
+
+
+namespace simd = engine::simd;
+
+
+/* fused multiply-adds may contract differently in the copies of each set */
+#if defined(__FMA__) || defined(__ARM_FEATURE_FMA)
+static constexpr bool contracted = true;
+#else
+static constexpr bool contracted = false;
+#endif
+
+
+// -- sets --------------------------------------------------------------------
+
+/* the copies of the kernels of one set */
+struct kernels final {
+	simd::isa set;
+	decltype(&simd::scalar::transform_kernels::compose) compose;
+	decltype(&simd::scalar::quaternion_kernels::multiply) multiply;
+	decltype(&simd::scalar::quaternion_kernels::rotate) rotate;
+	decltype(&simd::scalar::quaternion_kernels::matrices) matrices;
+	decltype(&simd::scalar::quaternion_kernels::nlerp) nlerp;
+	decltype(&simd::scalar::quaternion_kernels::slerp) slerp;
+};
+
+/* every set compiled in, in the order of simd::sets */
+static const kernels compiled[] {
+	{simd::SCALAR, &simd::scalar::transform_kernels::compose, &simd::scalar::quaternion_kernels::multiply,
+				   &simd::scalar::quaternion_kernels::rotate, &simd::scalar::quaternion_kernels::matrices,
+				   &simd::scalar::quaternion_kernels::nlerp, &simd::scalar::quaternion_kernels::slerp},
+	#if defined(ENGINE_SIMD_DISPATCH)
+	{simd::SSE42, &simd::sse42::transform_kernels::compose, &simd::sse42::quaternion_kernels::multiply,
+				  &simd::sse42::quaternion_kernels::rotate, &simd::sse42::quaternion_kernels::matrices,
+				  &simd::sse42::quaternion_kernels::nlerp, &simd::sse42::quaternion_kernels::slerp},
+	{simd::AVX2, &simd::avx2::transform_kernels::compose, &simd::avx2::quaternion_kernels::multiply,
+				 &simd::avx2::quaternion_kernels::rotate, &simd::avx2::quaternion_kernels::matrices,
+				 &simd::avx2::quaternion_kernels::nlerp, &simd::avx2::quaternion_kernels::slerp},
+	{simd::AVX512, &simd::avx512::transform_kernels::compose, &simd::avx512::quaternion_kernels::multiply,
+				   &simd::avx512::quaternion_kernels::rotate, &simd::avx512::quaternion_kernels::matrices,
+				   &simd::avx512::quaternion_kernels::nlerp, &simd::avx512::quaternion_kernels::slerp},
+	#elif defined(ENGINE_SIMD_NEON)
+	{simd::NEON, &simd::neon::transform_kernels::compose, &simd::neon::quaternion_kernels::multiply,
+				 &simd::neon::quaternion_kernels::rotate, &simd::neon::quaternion_kernels::matrices,
+				 &simd::neon::quaternion_kernels::nlerp, &simd::neon::quaternion_kernels::slerp},
+	#endif
+};
+
+
+// -- data --------------------------------------------------------------------
+
+/* inputs as soa arrays */
+struct inputs final {
+
+	explicit inputs(const std::size_t count)
+	: position{}, scale{}, a{}, b{}, v{}, t(count) {
+		for (auto* array : {&position[0], &position[1], &position[2], &scale[0], &scale[1], &scale[2],
+							&a[0], &a[1], &a[2], &a[3], &b[0], &b[1], &b[2], &b[3], &v[0], &v[1], &v[2]})
+			array->resize(count);
+
+		for (std::size_t i = 0U; i < count; ++i) {
+			const auto p = simd::quatf{benchmark::uniform() * 3.0f, simd::normalize(simd::float3{benchmark::uniform(), benchmark::uniform(), benchmark::uniform()})};
+			// every fourth pair nearly parallel, the nlerp branch of slerp
+			const auto q = (i & 3U) == 0U ? simd::normalize(simd::quatf{p.vector + simd::float4{benchmark::uniform() * 0.01f}})
+										  : simd::quatf{benchmark::uniform() * 3.0f, simd::normalize(simd::float3{benchmark::uniform(), benchmark::uniform(), benchmark::uniform()})};
+			for (unsigned int k = 0U; k < 4U; ++k) {
+				a[k][i] = p.vector[k];
+				b[k][i] = q.vector[k];
+			}
+			for (unsigned int k = 0U; k < 3U; ++k) {
+				position[k][i] = benchmark::uniform() * 100.0f;
+				scale[k][i]    = benchmark::uniform() + 2.0f;
+				v[k][i]        = benchmark::uniform() * 10.0f;
+			}
+			t[i] = (benchmark::uniform() + 1.0f) * 0.5f;
+		}
+	}
+
+	std::vector<float> position[3], scale[3], a[4], b[4], v[3], t;
+};
+
+/* outputs of one set */
+struct outputs final {
+
+	explicit outputs(const std::size_t count)
+	: world(count), rotations(count), product{}, rotated{}, nlerp{}, slerp{} {
+		for (unsigned int k = 0U; k < 4U; ++k) {
+			product[k].resize(count); nlerp[k].resize(count); slerp[k].resize(count);
+		}
+		for (unsigned int k = 0U; k < 3U; ++k)
+			rotated[k].resize(count);
+	}
+
+	/* true when every output has the bits of o */
+	auto same(const outputs& o) const -> bool {
+		bool same = std::memcmp(world.data(), o.world.data(), world.size() * sizeof(simd::float4x4)) == 0
+				 && std::memcmp(rotations.data(), o.rotations.data(), rotations.size() * sizeof(simd::float4x4)) == 0;
+		for (unsigned int k = 0U; k < 4U; ++k)
+			same = same && product[k] == o.product[k] && nlerp[k] == o.nlerp[k] && slerp[k] == o.slerp[k];
+		for (unsigned int k = 0U; k < 3U; ++k)
+			same = same && rotated[k] == o.rotated[k];
+		return same;
+	}
+
+	std::vector<simd::float4x4> world, rotations;
+	std::vector<float> product[4], rotated[3], nlerp[4], slerp[4];
+};
+
+
+// -- benchmark ---------------------------------------------------------------
+
+/* kernels timed */
+enum kernel : unsigned int { COMPOSE, MULTIPLY, ROTATE, MATRICES, NLERP, SLERP, KERNELS };
+
+/* kernel names */
+static constexpr const char* names[KERNELS] { "compose", "multiply", "rotate", "matrices", "nlerp", "slerp" };
+
+/* run kernel k of set s over the inputs */
+static auto run(const kernels& s, const unsigned int k, const inputs& in, outputs& out) -> void {
+
+	const std::size_t count = in.t.size();
+	const float* const p[3] { in.position[0].data(), in.position[1].data(), in.position[2].data() };
+	const float* const c[3] { in.scale[0].data(), in.scale[1].data(), in.scale[2].data() };
+	const float* const a[4] { in.a[0].data(), in.a[1].data(), in.a[2].data(), in.a[3].data() };
+	const float* const b[4] { in.b[0].data(), in.b[1].data(), in.b[2].data(), in.b[3].data() };
+	const float* const v[3] { in.v[0].data(), in.v[1].data(), in.v[2].data() };
+	float* const q[4] { out.product[0].data(), out.product[1].data(), out.product[2].data(), out.product[3].data() };
+	float* const r[3] { out.rotated[0].data(), out.rotated[1].data(), out.rotated[2].data() };
+	float* const n[4] { out.nlerp[0].data(), out.nlerp[1].data(), out.nlerp[2].data(), out.nlerp[3].data() };
+	float* const l[4] { out.slerp[0].data(), out.slerp[1].data(), out.slerp[2].data(), out.slerp[3].data() };
+
+	switch (k) {
+		case COMPOSE:  s.compose(p, a, c, count, out.world.data()); break;
+		case MULTIPLY: s.multiply(a, b, q, count); break;
+		case ROTATE:   s.rotate(a, v, r, count); break;
+		case MATRICES: s.matrices(a, out.rotations.data(), count); break;
+		case NLERP:    s.nlerp(a, b, in.t.data(), n, count); break;
+		default:       s.slerp(a, b, in.t.data(), l, count); break;
+	}
+}
+
+
+int main(int ac, char** av) {
+
+	const std::size_t count  = ac > 1 ? std::strtoull(av[1], nullptr, 10) : 100003U;
+	const std::size_t passes = ac > 2 ? std::strtoull(av[2], nullptr, 10) : 32U;
+
+	try {
+		const inputs in{count};
+
+		std::printf("%zu elements, selected set %s (%zu per pack):", count,
+					simd::name(simd::selected()), simd::width());
+		for (const auto& s : compiled)
+			std::printf(" %s%s", simd::name(s.set), simd::available(s.set) ? "" : " (not on this cpu)");
+		std::printf("\n");
+
+		// -- correctness ---------------------------------------------------
+		outputs scalar{count};
+		for (unsigned int k = 0U; k < KERNELS; ++k)
+			run(compiled[0], k, in, scalar);
+
+		bool good = true;
+		double ns[sizeof(compiled) / sizeof(compiled[0])][KERNELS] {};
+
+		for (std::size_t i = 0U; i < sizeof(compiled) / sizeof(compiled[0]); ++i) {
+			const auto& s = compiled[i];
+			if (simd::available(s.set) == false)
+				continue;
+
+			outputs out{count};
+			for (unsigned int k = 0U; k < KERNELS; ++k)
+				run(s, k, in, out);
+
+			const bool same = out.same(scalar);
+			good = good && (contracted || same);
+
+			// -- timings ---------------------------------------------------
+			for (unsigned int k = 0U; k < KERNELS; ++k) {
+				const auto t0 = std::chrono::steady_clock::now();
+				for (std::size_t p = 0U; p < passes; ++p) {
+					run(s, k, in, out);
+					asm volatile("" : : "r"(&out) : "memory");
+				}
+				const auto t1 = std::chrono::steady_clock::now();
+				ns[i][k] = std::chrono::duration<double, std::nano>(t1 - t0).count() / static_cast<double>(count * passes);
+			}
+
+			std::printf("%-7s", simd::name(s.set));
+			for (unsigned int k = 0U; k < KERNELS; ++k)
+				std::printf(" %s %5.2f ns (%4.1fx)", names[k], ns[i][k], ns[0][k] / ns[i][k]);
+			std::printf(", %s\n", same ? "bits of scalar" : "differs from scalar");
+		}
+
+		if (!good) {
+			std::puts("a set disagrees with the scalar set (built without -ffp-contract=off?)");
+			return EXIT_FAILURE;
+		}
+
+	} catch (const std::exception& except) {
+		std::cerr << except.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
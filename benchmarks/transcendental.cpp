@@ -0,0 +1,300 @@
+#include "transcendental.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+
+// -- transcendental benchmark ------------------------------------------------
+
+/* runs every math kernel, fast and accurate, through the scalar
+   functions, on the scalar lanes and on each register width of the
+   target over random inputs of its range; measures
+   the largest error in ulp against the double precision libm, checks it
+   against the documented bound, checks that every width gets the bits of
+   the scalar kernel (targets without fma), then times them against the
+   float libm
+   usage: transcendental [count] [passes] */
+
+
+namespace math = engine::math;
+namespace simd = engine::simd;
+
+
+/* deterministic generator state */
+static std::uint64_t state = 0x853c49e6748fea9bULL;
+
+/* uniform double in [0, 1) */
+static auto uniform(void) -> double {
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return static_cast<double>(state >> 11) / 9007199254740992.0;
+}
+
+/* uniform float in [a, b] */
+static auto between(const double a, const double b) -> float {
+	return static_cast<float>(a + (b - a) * uniform());
+}
+
+/* log-uniform positive float in [a, b] */
+static auto spread(const double a, const double b) -> float {
+	return static_cast<float>(std::exp(std::log(a) + (std::log(b) - std::log(a)) * uniform()));
+}
+
+/* error of y in ulp of the float nearest the reference */
+static auto ulp(const float y, const double reference) -> double {
+	const float r = static_cast<float>(reference);
+	if (r == 0.0f || std::isinf(r))
+		return y == r ? 0.0 : std::abs(static_cast<double>(y) - reference) / std::ldexp(1.0, -149);
+	const double unit = std::ldexp(1.0, std::max(std::ilogb(r), -126) - 23);
+	return std::abs(static_cast<double>(y) - reference) / unit;
+}
+
+
+// -- functions ---------------------------------------------------------------
+
+/* each function: name, its inputs, the kernel, the references and the
+   documented bounds (fast, accurate) */
+
+/* fused multiply-adds contract differently in the scalar and vector code
+   and move the errors a little off the documented bounds */
+#if defined(__FMA__) || defined(__ARM_FEATURE_FMA)
+static constexpr bool contracted = true;
+static constexpr double slack = 1.1;
+#else
+static constexpr bool contracted = false;
+static constexpr double slack = 1.0;
+#endif
+
+struct sine final {
+	static constexpr const char* name = "sin";
+	static constexpr double bound[2] { 26.1, 1.6 };
+	static auto input(float& x, float&) -> void { x = between(-100.0, 100.0); }
+	template <typename K> static auto kernel(const typename K::reg x, const typename K::reg) noexcept { return K::sin(x); }
+	template <math::tier T> static auto one(const float x, const float) noexcept { return math::sin<T>(x); }
+	static auto reference(const double x, const double) -> double { return std::sin(x); }
+	static auto libm(const float x, const float) -> float { return std::sin(x); }
+};
+
+struct cosine final {
+	static constexpr const char* name = "cos";
+	static constexpr double bound[2] { 26.1, 1.6 };
+	static auto input(float& x, float&) -> void { x = between(-100.0, 100.0); }
+	template <typename K> static auto kernel(const typename K::reg x, const typename K::reg) noexcept { return K::cos(x); }
+	template <math::tier T> static auto one(const float x, const float) noexcept { return math::cos<T>(x); }
+	static auto reference(const double x, const double) -> double { return std::cos(x); }
+	static auto libm(const float x, const float) -> float { return std::cos(x); }
+};
+
+struct reciprocal_root final {
+	static constexpr const char* name = "rsqrt";
+	static constexpr double bound[2] { 5.0, 1.5 };
+	static auto input(float& x, float&) -> void { x = spread(1e-30, 1e30); }
+	template <typename K> static auto kernel(const typename K::reg x, const typename K::reg) noexcept { return K::rsqrt(x); }
+	template <math::tier T> static auto one(const float x, const float) noexcept { return math::rsqrt<T>(x); }
+	static auto reference(const double x, const double) -> double { return 1.0 / std::sqrt(x); }
+	static auto libm(const float x, const float) -> float { return 1.0f / std::sqrt(x); }
+};
+
+struct exponential final {
+	static constexpr const char* name = "exp";
+	static constexpr double bound[2] { 70.0, 1.0 };
+	static auto input(float& x, float&) -> void { x = between(-87.0, 88.7); }
+	template <typename K> static auto kernel(const typename K::reg x, const typename K::reg) noexcept { return K::exp(x); }
+	template <math::tier T> static auto one(const float x, const float) noexcept { return math::exp<T>(x); }
+	static auto reference(const double x, const double) -> double { return std::exp(x); }
+	static auto libm(const float x, const float) -> float { return std::exp(x); }
+};
+
+struct logarithm final {
+	static constexpr const char* name = "log";
+	static constexpr double bound[2] { 208.0, 0.9 };
+	static auto input(float& x, float&) -> void { x = spread(1e-37, 1e38); }
+	template <typename K> static auto kernel(const typename K::reg x, const typename K::reg) noexcept { return K::log(x); }
+	template <math::tier T> static auto one(const float x, const float) noexcept { return math::log<T>(x); }
+	static auto reference(const double x, const double) -> double { return std::log(x); }
+	static auto libm(const float x, const float) -> float { return std::log(x); }
+};
+
+struct arc_tangent final {
+	static constexpr const char* name = "atan2";
+	static constexpr double bound[2] { 600.0, 3.0 };
+	static auto input(float& y, float& x) -> void { y = between(-1.0, 1.0) * spread(1e-3, 1e3); x = between(-1.0, 1.0) * spread(1e-3, 1e3); }
+	template <typename K> static auto kernel(const typename K::reg y, const typename K::reg x) noexcept { return K::atan2(y, x); }
+	template <math::tier T> static auto one(const float y, const float x) noexcept { return math::atan2<T>(y, x); }
+	static auto reference(const double y, const double x) -> double { return std::atan2(y, x); }
+	static auto libm(const float y, const float x) -> float { return std::atan2(y, x); }
+};
+
+struct arc_cosine final {
+	static constexpr const char* name = "acos";
+	static constexpr double bound[2] { 760.0, 1.3 };
+	static auto input(float& x, float&) -> void { x = between(-1.0, 1.0); }
+	template <typename K> static auto kernel(const typename K::reg x, const typename K::reg) noexcept { return K::acos(x); }
+	template <math::tier T> static auto one(const float x, const float) noexcept { return math::acos<T>(x); }
+	static auto reference(const double x, const double) -> double { return std::acos(x); }
+	static auto libm(const float x, const float) -> float { return std::acos(x); }
+};
+
+
+// -- runs --------------------------------------------------------------------
+
+/* the kernel of tier T on lanes L over whole registers of the inputs */
+template <typename F, typename L, math::tier T>
+static auto run(const std::vector<float>& a, const std::vector<float>& b, std::vector<float>& out) -> void {
+	using K = math::kernel<L, T>;
+	for (std::size_t i = 0U; i < out.size(); i += L::size)
+		L::store(out.data() + i, F::template kernel<K>(L::load(a.data() + i), L::load(b.data() + i)));
+}
+
+/* nanoseconds per value of f over passes */
+template <typename G>
+static auto timed(const std::size_t values, const std::size_t passes, G&& f) -> double {
+	const auto t0 = std::chrono::steady_clock::now();
+	for (std::size_t p = 0U; p < passes; ++p)
+		f();
+	const auto t1 = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(t1 - t0).count() / static_cast<double>(values * passes);
+}
+
+/* largest error and count of values that differ from the scalar kernel */
+struct outcome final {
+	double error;
+	std::size_t differ;
+	double ns;
+};
+
+template <typename F, typename L, math::tier T>
+static auto measure(const std::vector<float>& a, const std::vector<float>& b,
+					const std::vector<float>& scalar, const std::size_t passes) -> outcome {
+
+	std::vector<float> out(a.size());
+	run<F, L, T>(a, b, out);
+
+	outcome o{0.0, 0U, 0.0};
+	for (std::size_t i = 0U; i < out.size(); ++i) {
+		o.error = std::max(o.error, ulp(out[i], F::reference(a[i], b[i])));
+		o.differ += std::memcmp(&out[i], &scalar[i], sizeof(float)) != 0 ? 1U : 0U;
+	}
+
+	o.ns = timed(out.size(), passes, [&](void) {
+		run<F, L, T>(a, b, out);
+		asm volatile("" : : "r"(out.data()) : "memory");
+	});
+	return o;
+}
+
+/* the scalar function, one float at a time */
+template <typename F, math::tier T>
+static auto measure(const std::vector<float>& a, const std::vector<float>& b,
+					const std::vector<float>& scalar, const std::size_t passes) -> outcome {
+
+	std::vector<float> out(a.size());
+	auto single = [&](void) {
+		for (std::size_t i = 0U; i < out.size(); ++i)
+			out[i] = F::template one<T>(a[i], b[i]);
+	};
+	single();
+
+	outcome o{0.0, 0U, 0.0};
+	for (std::size_t i = 0U; i < out.size(); ++i) {
+		o.error = std::max(o.error, ulp(out[i], F::reference(a[i], b[i])));
+		o.differ += std::memcmp(&out[i], &scalar[i], sizeof(float)) != 0 ? 1U : 0U;
+	}
+
+	o.ns = timed(out.size(), passes, [&](void) {
+		single();
+		asm volatile("" : : "r"(out.data()) : "memory");
+	});
+	return o;
+}
+
+/* every tier and width of F, false past a bound or on differing bits */
+template <typename F>
+static auto bench(const std::size_t count, const std::size_t passes) -> bool {
+
+	std::vector<float> a(count), b(count), out(count);
+	for (std::size_t i = 0U; i < count; ++i)
+		F::input(a[i], b[i]);
+
+	double worst = 0.0;
+	for (std::size_t i = 0U; i < count; ++i)
+		worst = std::max(worst, ulp(F::libm(a[i], b[i]), F::reference(a[i], b[i])));
+
+	const double libm = timed(count, passes, [&](void) {
+		for (std::size_t i = 0U; i < count; ++i)
+			out[i] = F::libm(a[i], b[i]);
+		asm volatile("" : : "r"(out.data()) : "memory");
+	});
+
+	std::printf("%-6s libm %5.2f ns %8.2f ulp\n", F::name, libm, worst);
+
+	bool good = true;
+
+	auto tier = [&]<math::tier T>(const char* label) {
+		std::vector<float> scalar(count);
+		run<F, simd::wide_scalar, T>(a, b, scalar);
+
+		auto report = [&](const char* width, const outcome& o) {
+			std::printf("%-6s %-8s %-7s %5.2f ns %8.2f ulp (%4.1fx), %zu differ from scalar%s\n",
+						F::name, label, width, o.ns, o.error, libm / o.ns, o.differ,
+						o.error > F::bound[T] * slack ? ", over the bound" : "");
+			good = good && o.error <= F::bound[T] * slack && (contracted || o.differ == 0U);
+		};
+
+		report("one", measure<F, T>(a, b, scalar, passes));
+		report("scalar", measure<F, simd::wide_scalar, T>(a, b, scalar, passes));
+		#if defined(ENGINE_SIMD_SSE)
+		report("sse", measure<F, simd::wide_sse, T>(a, b, scalar, passes));
+		#endif
+		#if defined(ENGINE_SIMD_NEON)
+		report("neon", measure<F, simd::wide_neon, T>(a, b, scalar, passes));
+		#endif
+		#if defined(ENGINE_SIMD_SSE) && defined(__AVX2__)
+		report("avx2", measure<F, simd::wide_avx, T>(a, b, scalar, passes));
+		#endif
+		#if defined(ENGINE_SIMD_SSE) && defined(__AVX512F__)
+		report("avx512", measure<F, simd::wide_avx512, T>(a, b, scalar, passes));
+		#endif
+	};
+
+	tier.template operator()<math::FAST>("fast");
+	tier.template operator()<math::ACCURATE>("accurate");
+	return good;
+}
+
+
+int main(int ac, char** av) {
+
+	// whole registers of the widest lanes
+	const std::size_t count  = (ac > 1 ? std::strtoull(av[1], nullptr, 10) : 1U << 20) & ~std::size_t{15U};
+	const std::size_t passes = ac > 2 ? std::strtoull(av[2], nullptr, 10) : 16U;
+
+	try {
+		bool good = true;
+		good = bench<sine>(count, passes) && good;
+		good = bench<cosine>(count, passes) && good;
+		good = bench<reciprocal_root>(count, passes) && good;
+		good = bench<exponential>(count, passes) && good;
+		good = bench<logarithm>(count, passes) && good;
+		good = bench<arc_tangent>(count, passes) && good;
+		good = bench<arc_cosine>(count, passes) && good;
+
+		if (!good) {
+			std::puts("error bound exceeded or widths disagree");
+			return EXIT_FAILURE;
+		}
+
+	} catch (const std::exception& except) {
+		std::cerr << except.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,143 @@
+#include "transform_batch.hpp"
+#include "generator.hpp"
+#include "matrix.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+
+// -- transform batch benchmark -----------------------------------------------
+
+/* composes world matrices for random transforms four ways: the matrix
+   product chain of euler angles (reset, translate, three rotations,
+   scale), matrix::trs of the euler angles, matrix::trs of the quaternion
+   of those angles and the soa batch of the quaternions; checks the closed
+   forms against the chain and the batch against the quaternion trs (bit
+   for bit without fp contraction), checks that an object composed alone
+   gets the bits it gets inside the batch, then times the four
+   usage: transform_batch [count] [passes] */
+
+
+/* the product chain */
+static auto chain(const engine::simd::float3& p, const engine::simd::float3& r, const engine::simd::float3& s) -> engine::simd::float4x4 {
+	engine::matrix m;
+	m.reset();
+	m.translate(p);
+	m.rotate(r);
+	m.scale(s);
+	return m.get();
+}
+
+/* largest difference between two matrices */
+static auto difference(const engine::simd::float4x4& a, const engine::simd::float4x4& b) -> double {
+	double worst = 0.0;
+	for (unsigned int c = 0U; c < 4U; ++c)
+		for (unsigned int r = 0U; r < 4U; ++r)
+			worst = std::max(worst, static_cast<double>(std::abs(a.columns[c][r] - b.columns[c][r])));
+	return worst;
+}
+
+
+int main(int ac, char** av) {
+
+	const std::size_t count  = ac > 1 ? std::strtoull(av[1], nullptr, 10) : 100003U;
+	const std::size_t passes = ac > 2 ? std::strtoull(av[2], nullptr, 10) : 32U;
+
+	namespace simd = engine::simd;
+
+	try {
+		engine::transform_batch batch;
+		std::vector<simd::float3> positions, rotations, scales;
+		std::vector<simd::quatf> quaternions;
+
+		for (std::size_t i = 0U; i < count; ++i) {
+			positions.push_back(simd::float3{benchmark::uniform() * 100.0f, benchmark::uniform() * 100.0f, benchmark::uniform() * 100.0f});
+			// a few turns either way
+			rotations.push_back(simd::float3{benchmark::uniform() * 20.0f, benchmark::uniform() * 20.0f, benchmark::uniform() * 20.0f});
+			scales.push_back(simd::float3{benchmark::uniform() + 2.0f, benchmark::uniform() + 2.0f, benchmark::uniform() + 2.0f});
+			quaternions.push_back(engine::matrix::rotation(rotations.back()));
+			batch.push(positions.back(), quaternions.back(), scales.back());
+		}
+
+		std::vector<simd::float4x4> chained(count), closed(count), turned(count);
+
+		// -- correctness ---------------------------------------------------
+		batch.update();
+
+		double closed_error = 0.0, quaternion_error = 0.0, batch_error = 0.0;
+		std::size_t differ = 0U;
+		for (std::size_t i = 0U; i < count; ++i) {
+			chained[i] = chain(positions[i], rotations[i], scales[i]);
+			closed[i]  = engine::matrix::trs(positions[i], rotations[i], scales[i]);
+			turned[i]  = engine::matrix::trs(positions[i], quaternions[i], scales[i]);
+			closed_error = std::max(closed_error, difference(closed[i], chained[i]));
+			quaternion_error = std::max(quaternion_error, difference(turned[i], chained[i]));
+			batch_error = std::max(batch_error, difference(batch.matrices()[i], turned[i]));
+		}
+
+		// alone, the object goes through the scalar tail
+		for (std::size_t i = 0U; i < count; i += 997U) {
+			const auto& q = quaternions[i].vector;
+			simd::float4x4 alone;
+			engine::transform_batch::compose({&positions[i].x, &positions[i].y, &positions[i].z},
+											 {&q.x, &q.y, &q.z, &q.w},
+											 {&scales[i].x, &scales[i].y, &scales[i].z}, 1U, &alone);
+			differ += std::memcmp(&alone, &batch.matrices()[i], sizeof(alone)) != 0 ? 1U : 0U;
+		}
+
+		std::printf("%zu objects, %zu per iteration: euler closed form error %.3g, quaternion error %.3g, "
+					"batch error %.3g, %zu differ alone\n",
+					count, engine::transform_batch::width(), closed_error, quaternion_error, batch_error, differ);
+
+		// -- timings -------------------------------------------------------
+		const auto t0 = std::chrono::steady_clock::now();
+		for (std::size_t p = 0U; p < passes; ++p) {
+			for (std::size_t i = 0U; i < count; ++i)
+				chained[i] = chain(positions[i], rotations[i], scales[i]);
+			asm volatile("" : : "r"(chained.data()) : "memory");
+		}
+		const auto t1 = std::chrono::steady_clock::now();
+		for (std::size_t p = 0U; p < passes; ++p) {
+			for (std::size_t i = 0U; i < count; ++i)
+				closed[i] = engine::matrix::trs(positions[i], rotations[i], scales[i]);
+			asm volatile("" : : "r"(closed.data()) : "memory");
+		}
+		const auto t2 = std::chrono::steady_clock::now();
+		for (std::size_t p = 0U; p < passes; ++p) {
+			for (std::size_t i = 0U; i < count; ++i)
+				turned[i] = engine::matrix::trs(positions[i], quaternions[i], scales[i]);
+			asm volatile("" : : "r"(turned.data()) : "memory");
+		}
+		const auto t3 = std::chrono::steady_clock::now();
+		for (std::size_t p = 0U; p < passes; ++p) {
+			batch.update();
+			asm volatile("" : : "r"(batch.matrices().data()) : "memory");
+		}
+		const auto t4 = std::chrono::steady_clock::now();
+
+		const double n = static_cast<double>(count * passes);
+		const double a = std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+		const double b = std::chrono::duration<double, std::nano>(t2 - t1).count() / n;
+		const double c = std::chrono::duration<double, std::nano>(t3 - t2).count() / n;
+		const double d = std::chrono::duration<double, std::nano>(t4 - t3).count() / n;
+
+		std::printf("per object: product chain %.2f ns, euler closed form %.2f ns (%.1fx), "
+					"quaternion closed form %.2f ns (%.1fx), batch %.2f ns (%.1fx)\n",
+					a, b, a / b, c, a / c, d, a / d);
+
+		if (closed_error > 1e-3 || quaternion_error > 1e-3 || batch_error > 1e-5 || differ != 0U)
+			return EXIT_FAILURE;
+
+	} catch (const std::exception& except) {
+		std::cerr << except.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
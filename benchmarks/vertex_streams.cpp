@@ -0,0 +1,125 @@
+#include "vertex_streams.hpp"
+#include "generator.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+
+// -- vertex streams benchmark ------------------------------------------------
+
+/* checks split / merge and deinterleave / interleave round trips and the
+   plane bounds against engine::bounds, then compares a bounds pass over
+   interleaved vertices with one over position planes (bytes touched and
+   Mvertices/s), and the conversion throughput
+   usage: vertex_streams [vertices] [passes] */
+
+
+/* seconds per call of f, best of passes */
+template <typename F>
+static auto best(const std::size_t passes, F&& f) -> double {
+	double seconds = 1e30;
+	for (std::size_t p = 0U; p < passes; ++p) {
+		const auto start = std::chrono::steady_clock::now();
+		f();
+		const auto end   = std::chrono::steady_clock::now();
+		const double s = std::chrono::duration<double>(end - start).count();
+		seconds = s < seconds ? s : seconds;
+	}
+	return seconds;
+}
+
+/* same box */
+static auto same(const engine::bounds& a, const engine::bounds& b) noexcept -> bool {
+	for (unsigned int i = 0U; i < 3U; ++i)
+		if (a.min[i] != b.min[i] || a.max[i] != b.max[i])
+			return false;
+	return true;
+}
+
+
+int main(int ac, char** av) {
+
+	const std::size_t count  = ac > 1 ? std::strtoull(av[1], nullptr, 10) : 4'000'000U;
+	const std::size_t passes = ac > 2 ? std::strtoull(av[2], nullptr, 10) : 10U;
+
+	try {
+		engine::vertices vertices(count);
+
+		for (auto& v : vertices)
+			v = engine::vertex{benchmark::uniform(-100.0f, 100.0f), benchmark::uniform(-100.0f, 100.0f),
+							   benchmark::uniform(-100.0f, 100.0f), benchmark::uniform(-1.0f, 1.0f),
+							   benchmark::uniform(-1.0f, 1.0f),     benchmark::uniform(-1.0f, 1.0f),
+							   benchmark::uniform(0.0f, 1.0f),      benchmark::uniform(0.0f, 1.0f)};
+
+		// round trips
+		std::vector<float> positions(count * 3U);
+		engine::attribute_stream attributes(count);
+		engine::vertex_streams::split(vertices.data(), count, positions.data(), attributes.data());
+
+		engine::vertices merged(count);
+		engine::vertex_streams::merge(positions.data(), attributes.data(), count, merged.data());
+
+		engine::position_stream planes = engine::vertex_streams::deinterleave(vertices);
+
+		engine::vertices interleaved(count);
+		engine::vertex_streams::interleave(planes.x.data(), planes.y.data(), planes.z.data(),
+										   count, interleaved.data());
+
+		for (std::size_t i = 0U; i < count; ++i) {
+			const auto& v = vertices[i];
+			const auto& m = merged[i];
+			const auto& p = interleaved[i];
+			if (m.px() != v.px() || m.py() != v.py() || m.pz() != v.pz()
+			 || m.nx() != v.nx() || m.ny() != v.ny() || m.nz() != v.nz()
+			 || m.tu() != v.tu() || m.tv() != v.tv()
+			 || p.px() != v.px() || p.py() != v.py() || p.pz() != v.pz())
+				throw std::runtime_error{"stream round trip mismatch"};
+		}
+
+		// bounds, interleaved reference
+		engine::bounds aos{};
+		engine::bounds soa{};
+
+		const double aos_s = best(passes, [&]() {
+			aos = engine::bounds::at(vertices[0U]);
+			for (const auto& v : vertices)
+				aos.expand(v);
+		});
+
+		const double soa_s = best(passes, [&]() {
+			soa = engine::vertex_streams::bounds(planes);
+		});
+
+		if (not same(aos, soa))
+			throw std::runtime_error{"plane bounds mismatch"};
+
+		const double mv = static_cast<double>(count) / 1e6;
+
+		std::printf("%zu vertices, best of %zu\n", count, passes);
+		std::printf("  bounds (interleaved) %9.3f ms %10.1f Mvertices/s %8.1f MiB touched\n",
+					aos_s * 1e3, mv / aos_s, static_cast<double>(count * sizeof(engine::vertex)) / (1024.0 * 1024.0));
+		std::printf("  bounds (planes)      %9.3f ms %10.1f Mvertices/s %8.1f MiB touched %6.2fx\n",
+					soa_s * 1e3, mv / soa_s, static_cast<double>(count * sizeof(float) * 3U) / (1024.0 * 1024.0),
+					aos_s / soa_s);
+
+		const double split_s = best(passes, [&]() {
+			engine::vertex_streams::split(vertices.data(), count, positions.data(), attributes.data());
+		});
+
+		const double planes_s = best(passes, [&]() {
+			engine::vertex_streams::deinterleave(vertices.data(), count,
+												 planes.x.data(), planes.y.data(), planes.z.data());
+		});
+
+		std::printf("  split                %9.3f ms %10.1f Mvertices/s\n", split_s * 1e3, mv / split_s);
+		std::printf("  deinterleave         %9.3f ms %10.1f Mvertices/s\n", planes_s * 1e3, mv / planes_s);
+
+	} catch (const std::exception& except) {
+		std::cerr << except.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,202 @@
+#include "wavefront.hpp"
+#include "generator.hpp"
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+
+// -- wavefront corpus benchmark ----------------------------------------------
+
+/* runs every loader over a deterministic mixed corpus (all face forms,
+   n-gons, negative indices, comments, crlf) of 10K faces up to max faces
+   by decades, each run in a child process, reports MB/s, faces/s, peak rss
+   and heap allocations, fails when loaders disagree on the triangle count
+   usage: wavefront_corpus [max faces] [directory] */
+
+
+/* heap allocation counters (this process and its children) */
+static std::atomic<std::size_t> allocations{0U};
+static std::atomic<std::size_t> allocated{0U};
+
+/* counted malloc */
+static auto counted(const std::size_t size) -> void* {
+	allocations.fetch_add(1U, std::memory_order_relaxed);
+	allocated.fetch_add(size, std::memory_order_relaxed);
+	if (void* p = std::malloc(size != 0U ? size : 1U))
+		return p;
+	throw std::bad_alloc{};
+}
+
+auto operator new(const std::size_t size) -> void* {
+	return counted(size);
+}
+
+auto operator new[](const std::size_t size) -> void* {
+	return counted(size);
+}
+
+auto operator delete(void* p) noexcept -> void {
+	std::free(p);
+}
+
+auto operator delete[](void* p) noexcept -> void {
+	std::free(p);
+}
+
+auto operator delete(void* p, std::size_t) noexcept -> void {
+	std::free(p);
+}
+
+auto operator delete[](void* p, std::size_t) noexcept -> void {
+	std::free(p);
+}
+
+
+/* child report */
+struct report final {
+	double seconds;
+	std::size_t allocations;
+	std::size_t allocated;
+	std::size_t triangles;
+};
+
+/* peak rss in MiB (ru_maxrss is bytes on darwin, KiB elsewhere) */
+static auto peak_mib(const struct rusage& usage) -> double {
+#if defined(__APPLE__)
+	return static_cast<double>(usage.ru_maxrss) / (1024.0 * 1024.0);
+#else
+	return static_cast<double>(usage.ru_maxrss) / 1024.0;
+#endif
+}
+
+/* run load in a child, print one row, return its report (zeroed on failure) */
+template <typename F>
+static auto measure(const char* name, const std::size_t bytes, const std::size_t faces, F&& load) -> report {
+
+	int fds[2];
+
+	if (::pipe(fds) == -1)
+		throw std::runtime_error{"failed to create pipe"};
+
+	const pid_t pid = ::fork();
+
+	if (pid == -1)
+		throw std::runtime_error{"failed to fork"};
+
+	if (pid == 0) {
+		::close(fds[0]);
+
+		allocations.store(0U);
+		allocated.store(0U);
+
+		engine::vpackage package;
+
+		const auto start = std::chrono::steady_clock::now();
+		const bool ok    = load(package);
+		const auto end   = std::chrono::steady_clock::now();
+
+		const report r{std::chrono::duration<double>(end - start).count(),
+					   allocations.load(), allocated.load(),
+					   // parse2 leaves the mesh unindexed
+					   (package.second.empty() ? package.first.size() : package.second.size()) / 3U};
+
+		const bool sent = ::write(fds[1], &r, sizeof(r)) == static_cast<::ssize_t>(sizeof(r));
+		::_exit(ok && sent ? EXIT_SUCCESS : EXIT_FAILURE);
+	}
+
+	::close(fds[1]);
+
+	report r{};
+	const bool received = ::read(fds[0], &r, sizeof(r)) == static_cast<::ssize_t>(sizeof(r));
+	::close(fds[0]);
+
+	int status = 0;
+	struct rusage usage{};
+
+	if (::wait4(pid, &status, 0, &usage) != pid)
+		throw std::runtime_error{"failed to wait child"};
+
+	if (not received || not WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS) {
+		std::printf("  %-16s failed\n", name);
+		return report{};
+	}
+
+	const double mbytes = static_cast<double>(bytes) / (1024.0 * 1024.0);
+
+	std::printf("  %-16s %9.3f s %9.2f MB/s %12.0f faces/s %9.1f MiB rss %11zu allocs %9.1f MiB heap\n",
+				name, r.seconds, mbytes / r.seconds, static_cast<double>(faces) / r.seconds,
+				peak_mib(usage), r.allocations, static_cast<double>(r.allocated) / (1024.0 * 1024.0));
+
+	return r;
+}
+
+
+int main(int ac, char** av) {
+
+	const std::size_t max = ac > 1 ? std::strtoull(av[1], nullptr, 10) : 1'000'000U;
+	const std::string dir = ac > 2 ? av[2] : "/tmp";
+
+	try {
+		bool agree = true;
+
+		for (std::size_t faces = 10'000U; faces <= max; faces *= 10U) {
+
+			const std::string file = dir + "/engine_corpus_" + std::to_string(faces) + ".obj";
+			const char* path = file.data();
+
+			const auto bytes = benchmark::generate_mixed(path, faces);
+
+			std::printf("%s (%.2f MB, %zu faces)\n", path,
+						static_cast<double>(bytes) / (1024.0 * 1024.0), faces);
+
+			const report reports[] {
+
+				measure("parse2", bytes, faces, [&](engine::vpackage& package) -> bool {
+					engine::wavefront{path}.parse2(package);
+					return not package.first.empty();
+				}),
+
+				measure("parse (stream)", bytes, faces, [&](engine::vpackage& package) -> bool {
+					engine::wavefront::data data;
+					if (not engine::wavefront{path}.parse(data))
+						return false;
+					return engine::welder::weld(data, package);
+				}),
+
+				measure("parse_mapped 1", bytes, faces, [&](engine::vpackage& package) -> bool {
+					engine::wavefront{path}.parse_mapped(package, 1U);
+					return not package.second.empty();
+				}),
+
+				measure("parse_mapped N", bytes, faces, [&](engine::vpackage& package) -> bool {
+					engine::wavefront{path}.parse_mapped(package, 0U);
+					return not package.second.empty();
+				})
+			};
+
+			// same corpus, same triangles
+			for (const auto& r : reports)
+				if (r.triangles != reports[0].triangles || r.triangles == 0U) {
+					std::printf("  loaders disagree (triangle count)\n");
+					agree = false;
+					break;
+				}
+		}
+
+		if (not agree)
+			return EXIT_FAILURE;
+
+	} catch (const std::exception& except) {
+		std::cerr << except.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
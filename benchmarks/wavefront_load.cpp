@@ -0,0 +1,56 @@
+#include "wavefront.hpp"
+#include "generator.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+
+// -- wavefront load benchmark ------------------------------------------------
+
+/* compares the getline based parse2 against the memory mapped loader
+   usage: wavefront_load [faces] [path] */
+
+
+/* measure loader */
+template <typename F>
+static auto measure(const char* name, const std::size_t bytes, F&& load) -> void {
+
+	const auto start = std::chrono::steady_clock::now();
+	engine::vpackage package;
+	load(package);
+	const auto end   = std::chrono::steady_clock::now();
+
+	const double seconds = std::chrono::duration<double>(end - start).count();
+	const double mbytes  = static_cast<double>(bytes) / (1024.0 * 1024.0);
+
+	std::printf("%-14s %10.3f s %10.2f MB/s %12zu vertices\n",
+				name, seconds, mbytes / seconds, package.first.size());
+}
+
+
+int main(int ac, char** av) {
+
+	const std::size_t faces = ac > 1 ? std::strtoull(av[1], nullptr, 10) : 2'000'000U;
+	const char* path        = ac > 2 ? av[2] : "/tmp/engine_wavefront_load.obj";
+
+	try {
+		const auto bytes = benchmark::generate(path, faces);
+
+		std::printf("file: %s (%.2f MB, %zu faces)\n", path,
+					static_cast<double>(bytes) / (1024.0 * 1024.0), faces);
+
+		measure("parse2", bytes, [&](engine::vpackage& package) {
+			engine::wavefront{path}.parse2(package);
+		});
+
+		measure("parse_mapped", bytes, [&](engine::vpackage& package) {
+			engine::wavefront{path}.parse_mapped(package);
+		});
+
+	} catch (const std::exception& except) {
+		std::cerr << except.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
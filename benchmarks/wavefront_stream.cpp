@@ -0,0 +1,113 @@
+#include "wavefront.hpp"
+#include "generator.hpp"
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+
+// -- wavefront streaming benchmark -------------------------------------------
+
+/* streams the same file through a counting sink at several read sizes, each
+   run in a child process so its peak rss is measured alone, then compares
+   with the memory mapped loader
+   usage: wavefront_stream [faces] [path] */
+
+
+/* counting sink */
+struct counter final {
+
+	std::size_t elements = 0U;
+
+	auto new_position(float, float, float) noexcept -> void { ++elements; }
+	auto new_texcoord(float, float) noexcept -> void { ++elements; }
+	auto new_normal(float, float, float) noexcept -> void { ++elements; }
+	auto new_face(std::uint32_t, std::uint32_t, std::uint32_t,
+				  std::uint32_t, std::uint32_t, std::uint32_t,
+				  std::uint32_t, std::uint32_t, std::uint32_t) noexcept -> void { ++elements; }
+};
+
+/* peak rss in KiB (ru_maxrss is bytes on darwin, KiB elsewhere) */
+static auto peak_kib(const struct rusage& usage) -> double {
+#if defined(__APPLE__)
+	return static_cast<double>(usage.ru_maxrss) / 1024.0;
+#else
+	return static_cast<double>(usage.ru_maxrss);
+#endif
+}
+
+/* run load in a child, report time and peak rss */
+template <typename F>
+static auto measure(const char* name, const std::size_t bytes, F&& load) -> bool {
+
+	const auto start = std::chrono::steady_clock::now();
+
+	const pid_t pid = ::fork();
+
+	if (pid == -1)
+		throw std::runtime_error{"failed to fork"};
+
+	if (pid == 0)
+		::_exit(load() ? EXIT_SUCCESS : EXIT_FAILURE);
+
+	int status = 0;
+	struct rusage usage{};
+
+	if (::wait4(pid, &status, 0, &usage) != pid)
+		throw std::runtime_error{"failed to wait child"};
+
+	const auto end = std::chrono::steady_clock::now();
+
+	const double seconds = std::chrono::duration<double>(end - start).count();
+	const double mbytes  = static_cast<double>(bytes) / (1024.0 * 1024.0);
+
+	std::printf("%-18s %10.3f s %10.2f MB/s %12.0f KiB peak rss\n",
+				name, seconds, mbytes / seconds, peak_kib(usage));
+
+	return WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS;
+}
+
+
+int main(int ac, char** av) {
+
+	const std::size_t faces = ac > 1 ? std::strtoull(av[1], nullptr, 10) : 2'000'000U;
+	const char* path        = ac > 2 ? av[2] : "/tmp/engine_wavefront_stream.obj";
+
+	try {
+		const auto bytes = benchmark::generate(path, faces);
+
+		std::printf("file: %s (%.2f MB, %zu faces)\n", path,
+					static_cast<double>(bytes) / (1024.0 * 1024.0), faces);
+
+		bool ok = true;
+
+		for (const std::size_t chunk : {256U, 1024U, 4096U, 16384U, 65536U}) {
+
+			char name[32];
+			std::snprintf(name, sizeof(name), "stream %zu B", chunk);
+
+			ok &= measure(name, bytes, [&]() -> bool {
+				counter sink;
+				return engine::wavefront{path}.parse(sink, chunk);
+			});
+		}
+
+		ok &= measure("parse_mapped", bytes, [&]() -> bool {
+			engine::vpackage package;
+			engine::wavefront{path}.parse_mapped(package);
+			return not package.first.empty();
+		});
+
+		if (not ok)
+			throw std::runtime_error{"failed to parse benchmark file"};
+
+	} catch (const std::exception& except) {
+		std::cerr << except.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
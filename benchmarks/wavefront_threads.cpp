@@ -0,0 +1,57 @@
+#include "wavefront.hpp"
+#include "generator.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+
+// -- wavefront thread scaling benchmark --------------------------------------
+
+/* parses the same mapped file at 1/2/4/8/16 threads (chunk split + merge)
+   usage: wavefront_threads [faces] [path] */
+
+
+int main(int ac, char** av) {
+
+	const std::size_t faces = ac > 1 ? std::strtoull(av[1], nullptr, 10) : 4'000'000U;
+	const char* path        = ac > 2 ? av[2] : "/tmp/engine_wavefront_threads.obj";
+
+	try {
+		const auto bytes  = benchmark::generate(path, faces);
+		const double mbytes = static_cast<double>(bytes) / (1024.0 * 1024.0);
+
+		std::printf("file: %s (%.2f MB, %zu faces, %zu cores)\n",
+					path, mbytes, faces, engine::parallel::concurrency());
+
+		const engine::mapped_file file{path};
+
+		if (not file)
+			throw std::runtime_error{"failed to map benchmark file"};
+
+		double base = 0.0;
+
+		for (const std::size_t threads : {1U, 2U, 4U, 8U, 16U}) {
+
+			engine::wavefront::data data;
+
+			const auto start = std::chrono::steady_clock::now();
+			const bool ok    = engine::wavefront::parse_chunks(file.begin(), file.end(), threads, data);
+			const auto end   = std::chrono::steady_clock::now();
+
+			if (not ok)
+				throw std::runtime_error{"failed to parse benchmark file"};
+
+			const double seconds = std::chrono::duration<double>(end - start).count();
+			base = (threads == 1U) ? seconds : base;
+
+			std::printf("%3zu threads %10.3f s %10.2f MB/s %8.2fx %12zu faces\n",
+						threads, seconds, mbytes / seconds, base / seconds, data._faces.size());
+		}
+
+	} catch (const std::exception& except) {
+		std::cerr << except.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,70 @@
+#include "wavefront.hpp"
+#include "welder.hpp"
+#include "generator.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+
+// -- wavefront welding benchmark ---------------------------------------------
+
+/* welds the same parsed mesh (vertices with w or a color, texcoords with w)
+   at 1/2/4/8/16 threads
+   usage: wavefront_weld [faces] [path] */
+
+
+int main(int ac, char** av) {
+
+	const std::size_t faces = ac > 1 ? std::strtoull(av[1], nullptr, 10) : 4'000'000U;
+	const char* path        = ac > 2 ? av[2] : "/tmp/engine_wavefront_weld.obj";
+
+	try {
+		benchmark::generate(path, faces);
+
+		const engine::mapped_file file{path};
+
+		if (not file)
+			throw std::runtime_error{"failed to map benchmark file"};
+
+		engine::wavefront::data data;
+
+		if (not engine::wavefront::parse_chunks(file.begin(), file.end(), engine::parallel::concurrency(), data))
+			throw std::runtime_error{"failed to parse benchmark file"};
+
+		// vertices with w or a color and texcoords with w are all kept
+		if (data._positions.size() != faces / 2U + 3U || data._texcoords.size() != faces / 2U + 3U)
+			throw std::runtime_error{"vertices lost while parsing"};
+
+		const double corners = static_cast<double>(data._faces.size() * 3U);
+
+		std::printf("file: %s (%zu faces, %zu cores)\n",
+					path, faces, engine::parallel::concurrency());
+
+		double base = 0.0;
+
+		for (const std::size_t threads : {1U, 2U, 4U, 8U, 16U}) {
+
+			engine::vpackage package;
+
+			const auto start = std::chrono::steady_clock::now();
+			const bool ok    = engine::welder::weld(data, package, threads);
+			const auto end   = std::chrono::steady_clock::now();
+
+			if (not ok)
+				throw std::runtime_error{"failed to weld benchmark mesh"};
+
+			const double seconds = std::chrono::duration<double>(end - start).count();
+			base = (threads == 1U) ? seconds : base;
+
+			std::printf("%3zu threads %10.3f s %10.2f Mcorners/s %8.2fx %12zu vertices (%.2f%% of corners)\n",
+						threads, seconds, corners / seconds / 1e6, base / seconds,
+						package.first.size(), 100.0 * static_cast<double>(package.first.size()) / corners);
+		}
+
+	} catch (const std::exception& except) {
+		std::cerr << except.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,88 @@
+# -- E X E C U T A B L E S ----------------------------------------------------
+
+# shared by the benchmark and tool makefiles, one optimized executable per
+# source of the including directory; the includer sets KIND (build log
+# label), OPT (optimization flags) and ARCH (target instruction set)
+
+
+# -- S E T T I N G S ----------------------------------------------------------
+
+# set default target
+.DEFAULT_GOAL := all
+
+# use one shell for all commands
+.ONESHELL:
+
+# delete intermediate files on error
+.DELETE_ON_ERROR:
+
+# set shell program
+override SHELL := $(shell which zsh)
+
+# set shell flags
+.SHELLFLAGS := --no-rcs --no-globalrcs --errexit --no-unset -c -o pipefail
+
+
+# -- D I R E C T O R I E S ----------------------------------------------------
+
+# root directory
+override ROOTDIR := ..
+
+# binary directory
+override BINDIR := bin
+
+# include directory
+override INCDIR := $(ROOTDIR)/includes
+
+# xns library directory
+override XNSDIR := $(ROOTDIR)/xns
+
+
+# -- C O M P I L E R  S E T T I N G S -----------------------------------------
+
+# compiler
+override CXX := clang++
+
+# compiler standard
+override STD := -std=c++2a
+
+# warning flags
+override CXXFLAGS := -Wall -Wextra -Werror -Wno-unused -Wno-unused-parameter \
+					 -Wno-unused-variable -Wno-unused-function
+
+# include flags
+override INCLUDES := $(addprefix -I, $(shell find $(INCDIR) -type d) $(XNSDIR))
+
+# linker flags
+override LDFLAGS := -L$(XNSDIR) -lxns
+
+
+# -- S O U R C E S ------------------------------------------------------------
+
+# one executable per source
+override SRCS := $(wildcard *.cpp)
+
+# pattern substitution for executables
+override BINS := $(patsubst %.cpp, $(BINDIR)/%, $(SRCS))
+
+
+# -- T A R G E T S ------------------------------------------------------------
+
+.PHONY: all clean fclean re
+
+
+all: $(BINS)
+
+$(BINDIR)/%: %.cpp Makefile $(ROOTDIR)/executables.mk | $(BINDIR)
+	@echo '\x1b[32m$(KIND)\x1b[0m compiling -> $<'
+	@$(CXX) $(STD) $(OPT) $(ARCH) $(CXXFLAGS) $(INCLUDES) $< -o $@ $(LDFLAGS)
+
+$(BINDIR):
+	@mkdir -pv $@
+
+clean:
+	@rm -rvf $(BINDIR)
+
+fclean: clean
+
+re: fclean all
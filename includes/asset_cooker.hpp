@@ -0,0 +1,320 @@
+#ifndef ENGINE_ASSET_COOKER_HPP
+#define ENGINE_ASSET_COOKER_HPP
+
+#include "wavefront.hpp"
+#include "cooked_mesh.hpp"
+#include "mesh_optimizer.hpp"
+#include "mesh_simplifier.hpp"
+#include "mapped_file.hpp"
+#include "parallel.hpp"
+#include "hash.hpp"
+
+#include <sys/stat.h>
+#include <dirent.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- A S S E T  C O O K E R ----------------------------------------------
+
+	/* obj sources to cooked meshes: load, weld, optimize, build the lod
+	   chain and write; a cooked file is keyed by the hash of its source
+	   bytes seeded with the cook settings, so unchanged sources are skipped
+	   and a settings change cooks everything again; the runtime library
+	   and the offline tool share this pipeline and this key */
+
+	class asset_cooker final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::asset_cooker;
+
+			/* size type */
+			using size_type = std::size_t;
+
+			/* key type */
+			using key_type = std::uint64_t;
+
+
+			// -- S E T T I N G S ---------------------------------------------
+
+			struct settings final {
+
+				/* default constructor (the runtime library cooks with these) */
+				inline settings(void) noexcept
+				: cache{engine::mesh_optimizer::CACHE_SIZE},
+				  threshold{engine::mesh_optimizer::OVERDRAW_THRESHOLD},
+				  levels{engine::mesh_simplifier::MAX_LEVELS} {}
+
+				/* simulated post-transform cache size */
+				size_type cache;
+
+				/* accepted cache efficiency loss for overdraw ordering */
+				double threshold;
+
+				/* lod levels */
+				size_type levels;
+			};
+
+
+			// -- public constants --------------------------------------------
+
+			enum status_type : unsigned int {
+				COOKED,
+				SKIPPED,
+				FAILED
+			};
+
+
+			// -- R E S U L T -------------------------------------------------
+
+			struct result final {
+
+				/* source path */
+				std::string path;
+
+				/* outcome */
+				status_type status;
+
+				/* wall time of the job */
+				double milliseconds;
+
+				/* source size */
+				size_type bytes;
+
+				/* base level triangles (cooked only) */
+				size_type triangles;
+
+				/* failure reason */
+				std::string error;
+			};
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* non-instanciable class */
+			asset_cooker(void) = delete;
+
+
+			// -- public static methods ---------------------------------------
+
+			/* content key of source bytes under settings */
+			static auto key(const char* begin, const char* end, const settings& s = settings{}) noexcept -> key_type {
+
+				// everything that changes the output seeds the source hash
+				const std::uint64_t fields[] {
+					engine::cooked_mesh::VERSION,
+					sizeof(engine::vertex),
+					s.cache,
+					std::bit_cast<std::uint64_t>(s.threshold),
+					s.levels
+				};
+
+				return engine::hash::compute(begin, static_cast<size_type>(end - begin),
+											 engine::hash::compute(fields, sizeof(fields)));
+			}
+
+			/* cooked file next to the source holds this key */
+			static auto current(const char* path, const key_type key) -> bool {
+				const engine::cooked_mesh cooked{engine::cooked_mesh::path(path).data()};
+				return cooked && cooked.source_hash() == key;
+			}
+
+			/* size and modification time of the source (zero time when it can't be read) */
+			static auto stamp(const char* path) noexcept -> engine::cooked_mesh::stamp {
+
+				struct ::stat st{};
+
+				if (::stat(path, &st) == -1)
+					return engine::cooked_mesh::stamp{0U, 0U};
+
+#if defined(__APPLE__)
+				const auto& t = st.st_mtimespec;
+#else
+				const auto& t = st.st_mtim;
+#endif
+				return engine::cooked_mesh::stamp{static_cast<std::uint64_t>(st.st_size),
+					(static_cast<std::uint64_t>(t.tv_sec) * 1000000000U) + static_cast<std::uint64_t>(t.tv_nsec)};
+			}
+
+			/* cooked file stamped with the current size and modification time of
+			   the source, trusted without hashing it (reads the cooked header only);
+			   a source restored with an older time (rsync -a, tar, cp -p) no longer
+			   matches and goes through its hash */
+			static auto fresh(const char* path) noexcept -> bool {
+				return engine::cooked_mesh::stamped(engine::cooked_mesh::path(path).data(), self::stamp(path));
+			}
+
+			/* restamp a cooked file found current by hash (best effort) */
+			static auto touch(const char* path, const char* begin, const char* end) noexcept -> void {
+				engine::cooked_mesh::restamp(engine::cooked_mesh::path(path).data(), self::stamp(path, begin, end));
+			}
+
+			/* parse source bytes into a cooked model and write it under key,
+			   throws on a parse failure (false when the cooked file can't be written) */
+			static auto cook(const char* path, const char* begin, const char* end, const key_type key,
+							 engine::model& model, const settings& s = settings{}, const size_type threads = 0U) -> bool {
+
+				if (not engine::wavefront::load(begin, end, model, threads))
+					throw std::runtime_error{std::string{"can't parse "} + path};
+
+				// cooked files store the optimized order and the lod chain
+				engine::mesh_optimizer::optimize(model, s.cache, s.threshold);
+				engine::mesh_simplifier::build(model, s.levels);
+
+				return engine::cooked_mesh::write(engine::cooked_mesh::path(path).data(), model, key,
+												  self::stamp(path, begin, end));
+			}
+
+			/* cook sources across threads, largest first, skipping those whose
+			   cooked file holds their key unless forced (results in input order) */
+			static auto cook(const std::vector<std::string>& paths, const settings& s = settings{},
+							 size_type threads = 0U, const bool force = false) -> std::vector<result> {
+
+				std::vector<result> results;
+				std::vector<size_type> order(paths.size());
+
+				results.reserve(paths.size());
+
+				for (const auto& path : paths) {
+					struct ::stat st{};
+					results.push_back(result{path, FAILED, 0.0,
+						::stat(path.data(), &st) == 0 ? static_cast<size_type>(st.st_size) : 0U, 0U, {}});
+				}
+
+				// big sources first, small ones fill the tail
+				std::iota(order.begin(), order.end(), size_type{0U});
+				std::stable_sort(order.begin(), order.end(), [&](const size_type a, const size_type b) {
+					return results[a].bytes > results[b].bytes;
+				});
+
+				if (threads == 0U)
+					threads = engine::parallel::concurrency();
+				threads = std::max(std::min(threads, paths.size()), size_type{1U});
+
+				// a lone source keeps the parallel loader
+				const size_type inner = threads == 1U ? 0U : 1U;
+
+				std::atomic<size_type> next{0U};
+
+				engine::parallel::run(threads, [&](const size_type) {
+					for (size_type i = next++; i < order.size(); i = next++)
+						self::job(results[order[i]], s, inner, force);
+				});
+
+				return results;
+			}
+
+			/* append obj files under directory, recursively, sorted (false when unreadable) */
+			static auto sources(const std::string& directory, std::vector<std::string>& out) -> bool {
+
+				DIR* dir = ::opendir(directory.data());
+
+				if (dir == nullptr)
+					return false;
+
+				std::vector<std::string> files, directories;
+
+				while (const ::dirent* entry = ::readdir(dir)) {
+
+					const char* name = entry->d_name;
+
+					if (name[0] == '.')
+						continue;
+
+					const std::string path = directory + (directory.ends_with('/') ? "" : "/") + name;
+
+					struct ::stat st{};
+					if (::stat(path.data(), &st) == -1)
+						continue;
+
+					if (S_ISDIR(st.st_mode))
+						directories.push_back(path);
+					else if (S_ISREG(st.st_mode) && path.ends_with(".obj"))
+						files.push_back(path);
+				}
+
+				::closedir(dir);
+
+				std::sort(files.begin(), files.end());
+				std::sort(directories.begin(), directories.end());
+
+				out.insert(out.end(), files.begin(), files.end());
+
+				for (const auto& sub : directories)
+					self::sources(sub, out);
+
+				return true;
+			}
+
+
+		private:
+
+			// -- private static methods --------------------------------------
+
+			/* stamp of the source the bytes were read from (zero time when it
+			   changed size since, the cooked file is then never trusted unhashed) */
+			static auto stamp(const char* path, const char* begin, const char* end) noexcept -> engine::cooked_mesh::stamp {
+				const auto s = self::stamp(path);
+				return s.size == static_cast<std::uint64_t>(end - begin) ? s : engine::cooked_mesh::stamp{0U, 0U};
+			}
+
+			/* one source (worker thread) */
+			static auto job(result& r, const settings& s, const size_type threads, const bool force) -> void {
+
+				const auto start = std::chrono::steady_clock::now();
+
+				try {
+					const engine::mapped_file source{r.path.data()};
+
+					if (not source)
+						r.error = "can't read " + r.path;
+					else {
+						const key_type k = self::key(source.begin(), source.end(), s);
+
+						if (not force && self::current(r.path.data(), k)) {
+							self::touch(r.path.data(), source.begin(), source.end());
+							r.status = SKIPPED;
+						}
+						else {
+							engine::model model;
+
+							if (not self::cook(r.path.data(), source.begin(), source.end(), k, model, s, threads))
+								r.error = "can't write " + engine::cooked_mesh::path(r.path.data());
+							else {
+								r.status    = COOKED;
+								r.triangles = model.package.second.size() / 3U;
+							}
+						}
+					}
+				} catch (const std::exception& except) {
+					r.error = except.what();
+				}
+
+				r.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			}
+
+	};
+
+}
+
+#endif // ENGINE_ASSET_COOKER_HPP
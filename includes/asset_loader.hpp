@@ -0,0 +1,609 @@
+#ifndef ENGINE_ASSET_LOADER_HPP
+#define ENGINE_ASSET_LOADER_HPP
+
+#include "io_ring.hpp"
+#include "parallel.hpp"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- A S S E T  L O A D E R ----------------------------------------------
+
+	/* background asset service: one thread reads whole files through an
+	   io_ring, worker threads cook the bytes into assets, both stages serve
+	   the highest priority first (fifo among equals); results come back as
+	   handles polled or waited on by the caller */
+
+	class asset_loader final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::asset_loader;
+
+			/* size type */
+			using size_type = std::size_t;
+
+			/* priority type (higher first) */
+			using priority_type = int;
+
+
+			// -- public constants --------------------------------------------
+
+			enum : priority_type {
+				BACKGROUND = 0,
+				NORMAL     = 100,
+				VISIBLE    = 200,
+				IMMEDIATE  = 300
+			};
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* request stage */
+			enum class stage : unsigned {
+				READ_QUEUED,
+				READING,
+				COOK_QUEUED,
+				COOKING
+			};
+
+
+			// -- R E Q U E S T -----------------------------------------------
+
+			struct request final {
+
+				/* file path */
+				std::string path{};
+
+				/* current priority */
+				priority_type priority{0};
+
+				/* queue entry version (older entries are stale) */
+				unsigned version{0U};
+
+				/* stage */
+				enum stage stage{stage::READ_QUEUED};
+
+				/* file descriptor while reading */
+				int fd{-1};
+
+				/* bytes read so far */
+				size_type offset{0U};
+
+				/* file contents */
+				std::vector<char> bytes{};
+
+				/* cook bytes and publish the result (worker thread) */
+				std::function<void(const char*, const char*)> cook{};
+
+				/* publish failure */
+				std::function<void(std::exception_ptr)> fail{};
+			};
+
+			/* queue entry (snapshot of the request priority) */
+			struct entry final {
+
+				/* priority */
+				priority_type priority;
+
+				/* submission order */
+				std::uint64_t sequence;
+
+				/* request version at push */
+				unsigned version;
+
+				/* request */
+				std::shared_ptr<struct request> request;
+
+				/* heap order */
+				inline auto operator<(const entry& other) const noexcept -> bool {
+					return priority != other.priority ? priority < other.priority
+													  : sequence > other.sequence;
+				}
+			};
+
+			/* priority queue */
+			using queue = std::priority_queue<entry>;
+
+
+			// -- S T A T E ---------------------------------------------------
+
+			template <typename T>
+			struct state final {
+
+				/* completion guard */
+				std::mutex mutex{};
+
+				/* completion signal */
+				std::condition_variable signal{};
+
+				/* completed (value or error set) */
+				std::atomic<bool> done{false};
+
+				/* asset */
+				std::optional<T> value{};
+
+				/* failure */
+				std::exception_ptr error{};
+
+				/* publish value */
+				inline auto set(T&& asset) -> void {
+					const std::lock_guard lock{mutex};
+					value.emplace(std::move(asset));
+					done.store(true, std::memory_order_release);
+					signal.notify_all();
+				}
+
+				/* publish failure (first one wins) */
+				inline auto set(std::exception_ptr except) -> void {
+					const std::lock_guard lock{mutex};
+					if (done.load(std::memory_order_relaxed))
+						return;
+					error = except;
+					done.store(true, std::memory_order_release);
+					signal.notify_all();
+				}
+			};
+
+
+		public:
+
+			// -- H A N D L E -------------------------------------------------
+
+			template <typename T>
+			class handle final {
+
+
+				public:
+
+					// -- public lifecycle ------------------------------------
+
+					/* default constructor */
+					inline handle(void) noexcept
+					: _state{}, _request{} {}
+
+					/* state constructor */
+					inline handle(std::shared_ptr<state<T>> state,
+								  std::shared_ptr<struct request> request) noexcept
+					: _state{std::move(state)}, _request{std::move(request)} {}
+
+
+					// -- public accessors ------------------------------------
+
+					/* refers to a request */
+					explicit inline operator bool(void) const noexcept {
+						return _state != nullptr;
+					}
+
+					/* completed, successfully or not */
+					inline auto done(void) const noexcept -> bool {
+						return _state && _state->done.load(std::memory_order_acquire);
+					}
+
+					/* asset resident */
+					inline auto ready(void) const noexcept -> bool {
+						return self::done() && _state->value.has_value();
+					}
+
+					/* block until completed */
+					auto wait(void) const -> void {
+						std::unique_lock lock{_state->mutex};
+						_state->signal.wait(lock, [this](void) noexcept {
+							return _state->done.load(std::memory_order_acquire);
+						});
+					}
+
+					/* asset, waits for it (rethrows the cook failure) */
+					auto get(void) const -> T& {
+						self::wait();
+						if (_state->error)
+							std::rethrow_exception(_state->error);
+						return *_state->value;
+					}
+
+
+					// -- public modifiers ------------------------------------
+
+					/* change priority while still queued */
+					inline auto priority(const priority_type priority) const -> void {
+						if (_request)
+							asset_loader::shared().reprioritize(_request, priority);
+					}
+
+
+				private:
+
+					// -- private types ---------------------------------------
+
+					/* self type */
+					using self = handle<T>;
+
+
+					// -- private members -------------------------------------
+
+					/* shared result */
+					std::shared_ptr<state<T>> _state;
+
+					/* request (reprioritization) */
+					std::shared_ptr<struct request> _request;
+
+			};
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* non-assignable class */
+			non_assignable(asset_loader);
+
+			/* destructor (in flight requests complete, queued ones fail) */
+			~asset_loader(void) noexcept {
+
+				{
+					const std::lock_guard lock{_mutex};
+					_stop = true;
+				}
+
+				_read_signal.notify_all();
+				_cook_signal.notify_all();
+
+				_reader.join();
+				for (auto& worker : _workers)
+					worker.join();
+
+				const auto abandoned = std::make_exception_ptr(std::runtime_error{"asset loader: stopped"});
+
+				for (queue* q : {&_reads, &_cooks})
+					for (; not q->empty(); q->pop())
+						q->top().request->fail(abandoned);
+			}
+
+
+			// -- public static methods ---------------------------------------
+
+			/* shared instance */
+			static auto shared(void) -> self& {
+				static self instance;
+				return instance;
+			}
+
+
+			// -- public methods ----------------------------------------------
+
+			/* read path, then cook(begin, end) on a worker, the result is the handle value */
+			template <typename F>
+			auto load(std::string path, const priority_type priority, F&& cook)
+				-> handle<std::invoke_result_t<F&, const char*, const char*>> {
+
+				using value_type = std::invoke_result_t<F&, const char*, const char*>;
+
+				auto state   = std::make_shared<struct state<value_type>>();
+				auto request = std::make_shared<struct request>();
+
+				request->path     = std::move(path);
+				request->priority = priority;
+				request->cook     = [state, cook = std::forward<F>(cook)](const char* begin, const char* end) mutable -> void {
+					state->set(cook(begin, end));
+				};
+				request->fail     = [state](std::exception_ptr except) -> void {
+					state->set(except);
+				};
+
+				{
+					const std::lock_guard lock{_mutex};
+					_reads.push(entry{priority, _sequence++, 0U, request});
+				}
+				_read_signal.notify_one();
+
+				return handle<value_type>{std::move(state), std::move(request)};
+			}
+
+			/* requeue a waiting request at a new priority (no effect once started) */
+			auto reprioritize(const std::shared_ptr<struct request>& request, const priority_type priority) -> void {
+
+				{
+					const std::lock_guard lock{_mutex};
+
+					queue* target = request->stage == stage::READ_QUEUED ? &_reads
+								  : request->stage == stage::COOK_QUEUED ? &_cooks
+								  : nullptr;
+
+					if (target == nullptr || request->priority == priority)
+						return;
+
+					request->priority = priority;
+					target->push(entry{priority, _sequence++, ++request->version, request});
+				}
+				_read_signal.notify_one();
+				_cook_signal.notify_one();
+			}
+
+			/* io_uring in use */
+			inline auto uring(void) const noexcept -> bool {
+				return _uring.load(std::memory_order_relaxed);
+			}
+
+
+		private:
+
+			// -- private constants -------------------------------------------
+
+			/* reads in flight */
+			static constexpr unsigned QUEUE_DEPTH = 32U;
+
+
+			// -- private lifecycle -------------------------------------------
+
+			/* default constructor (one reader, cores - 1 cooks) */
+			asset_loader(void)
+			: _mutex{}, _read_signal{}, _cook_signal{}, _reads{}, _cooks{},
+			  _sequence{0U}, _stop{false}, _uring{false}, _reader{}, _workers{} {
+
+				const size_type count = engine::parallel::concurrency() > 1U
+									  ? engine::parallel::concurrency() - 1U : 1U;
+
+				_reader = std::thread{[this](void) { self::read_loop(); }};
+
+				_workers.reserve(count);
+				for (size_type i = 0U; i < count; ++i)
+					_workers.emplace_back([this](void) { self::cook_loop(); });
+			}
+
+
+			// -- private methods ---------------------------------------------
+
+			/* pop the best live entry of q (lock held), nullptr when none */
+			static auto pop(queue& q) -> std::shared_ptr<struct request> {
+				while (not q.empty()) {
+					entry e = q.top();
+					q.pop();
+					if (e.version == e.request->version)
+						return std::move(e.request);
+				}
+				return nullptr;
+			}
+
+			/* queue request for cooking (reader thread) */
+			auto cooked(std::shared_ptr<struct request> request) -> void {
+				if (request->fd != -1) {
+					::close(request->fd);
+					request->fd = -1;
+				}
+				{
+					const std::lock_guard lock{_mutex};
+					request->stage = stage::COOK_QUEUED;
+					_cooks.push(entry{request->priority, _sequence++, ++request->version, request});
+				}
+				_cook_signal.notify_one();
+			}
+
+			/* fail request (reader thread) */
+			static auto failed(const std::shared_ptr<struct request>& request, const char* reason) -> void {
+				if (request->fd != -1) {
+					::close(request->fd);
+					request->fd = -1;
+				}
+				request->fail(std::make_exception_ptr(
+					std::runtime_error{std::string{"asset loader: "} + reason + " " + request->path}));
+			}
+
+			/* finish a read with pread (kernel rejected the ring operation) */
+			static auto read_blocking(struct request& request) noexcept -> bool {
+				while (request.offset < request.bytes.size()) {
+					const ::ssize_t bytes = ::pread(request.fd, request.bytes.data() + request.offset,
+													request.bytes.size() - request.offset,
+													static_cast<::off_t>(request.offset));
+					if (bytes <= 0) {
+						if (bytes < 0 && errno == EINTR)
+							continue;
+						return false;
+					}
+					request.offset += static_cast<size_type>(bytes);
+				}
+				return true;
+			}
+
+			/* reader thread */
+			auto read_loop(void) -> void {
+
+				engine::io_ring ring{QUEUE_DEPTH};
+				_uring.store(ring.uring(), std::memory_order_relaxed);
+
+				// requests in flight (ring tags are raw pointers)
+				std::vector<std::shared_ptr<struct request>> flight;
+				std::vector<std::shared_ptr<struct request>> started;
+				std::vector<engine::io_ring::completion> completions;
+
+				while (true) {
+
+					{
+						std::unique_lock lock{_mutex};
+
+						_read_signal.wait(lock, [&](void) noexcept {
+							return _stop || ring.pending() != 0U
+								|| (not _reads.empty() && flight.size() < QUEUE_DEPTH);
+						});
+
+						if (_stop)
+							break;
+
+						while (flight.size() + started.size() < QUEUE_DEPTH) {
+							auto request = self::pop(_reads);
+							if (request == nullptr)
+								break;
+							request->stage = stage::READING;
+							started.push_back(std::move(request));
+						}
+					}
+
+					for (auto& request : started) {
+
+						request->fd = ::open(request->path.data(), O_RDONLY | O_CLOEXEC);
+
+						struct ::stat st{};
+
+						if (request->fd == -1 || ::fstat(request->fd, &st) == -1) {
+							self::failed(request, "can't open");
+							continue;
+						}
+
+						request->bytes.resize(static_cast<size_type>(st.st_size));
+
+						if (request->bytes.empty()) {
+							self::cooked(std::move(request));
+							continue;
+						}
+
+						ring.read(request->fd, request->bytes.data(), request->bytes.size(), 0U, request.get());
+						flight.push_back(std::move(request));
+					}
+					started.clear();
+
+					completions.clear();
+					ring.wait(completions);
+
+					for (const auto& c : completions) {
+
+						auto it = std::find_if(flight.begin(), flight.end(), [&c](const auto& r) noexcept {
+							return r.get() == c.tag;
+						});
+
+						auto request = std::move(*it);
+						flight.erase(it);
+
+						if (c.result < 0) {
+							// unsupported opcode or odd descriptor, finish synchronously
+							if (not self::read_blocking(*request)) {
+								self::failed(request, "can't read");
+								continue;
+							}
+						}
+						else if (c.result == 0) {
+							self::failed(request, "truncated");
+							continue;
+						}
+						else
+							request->offset += static_cast<size_type>(c.result);
+
+						if (request->offset < request->bytes.size()) {
+							ring.read(request->fd, request->bytes.data() + request->offset,
+									  request->bytes.size() - request->offset, request->offset, request.get());
+							flight.push_back(std::move(request));
+							continue;
+						}
+
+						self::cooked(std::move(request));
+					}
+				}
+
+				// drain the ring before the buffers go away
+				while (ring.pending() != 0U) {
+					completions.clear();
+					ring.wait(completions);
+				}
+				for (auto& request : flight)
+					self::failed(request, "stopped reading");
+			}
+
+			/* worker thread */
+			auto cook_loop(void) -> void {
+
+				while (true) {
+
+					std::shared_ptr<struct request> request;
+
+					{
+						std::unique_lock lock{_mutex};
+
+						_cook_signal.wait(lock, [this](void) noexcept {
+							return _stop || not _cooks.empty();
+						});
+
+						if (_stop)
+							return;
+
+						request = self::pop(_cooks);
+
+						if (request == nullptr)
+							continue;
+
+						request->stage = stage::COOKING;
+					}
+
+					try {
+						request->cook(request->bytes.data(), request->bytes.data() + request->bytes.size());
+					} catch (...) {
+						request->fail(std::current_exception());
+					}
+
+					request->bytes = std::vector<char>{};
+				}
+			}
+
+
+			// -- private members ---------------------------------------------
+
+			/* queues guard */
+			std::mutex _mutex;
+
+			/* reader wake up */
+			std::condition_variable _read_signal;
+
+			/* worker wake up */
+			std::condition_variable _cook_signal;
+
+			/* requests waiting for a read */
+			queue _reads;
+
+			/* requests waiting for a worker */
+			queue _cooks;
+
+			/* submission counter */
+			std::uint64_t _sequence;
+
+			/* shutting down */
+			bool _stop;
+
+			/* io_uring in use */
+			std::atomic<bool> _uring;
+
+			/* reader thread */
+			std::thread _reader;
+
+			/* worker threads */
+			std::vector<std::thread> _workers;
+
+	};
+
+}
+
+#endif // ENGINE_ASSET_LOADER_HPP
@@ -6,6 +6,7 @@
 #include "event.hpp"
 #include "screen.hpp"
 #include "matrix.hpp"
+#include "transcendental.hpp"
 #include "game_object.hpp"
 
 //#include <unordered_set>
@@ -71,7 +72,7 @@ namespace engine {
 
 			/* default constructor */
 			inline camera(void) noexcept
-			: _projection{matrix_identity_float4x4},
+			: _projection{simd::float4x4{1.0f}},
 				    _view{},
 			    _position{simd::float3{0.0f, 2.0f, 0.0f}},
 			    _rotation{simd::float3{0.0f, 0.0f, 0.0f}},
@@ -195,12 +196,15 @@ namespace engine {
 			/* update projection */
 			inline auto update_projection(void) noexcept -> void {
 
-				const float ys = 1 / std::tan(((_fov / 180.0f) * M_PI) * 0.5f);
+				// cot of half the fov
+				float s, c;
+				math::sincos((_fov / 180.0f) * static_cast<float>(M_PI) * 0.5f, s, c);
+				const float ys = c / s;
 				const float xs = ys / engine::screen::ratio();
 				const float zs = 1000.0f / (0.01f - 1000.0f);
 				const float zt = zs * 0.1f;
 
-				_projection = matrix_float4x4{
+				_projection = simd::float4x4{
 					simd::float4{+xs,   0,   0,   0},
 					simd::float4{  0, +ys,   0,   0},
 					simd::float4{  0,   0, -zs,   1},
@@ -217,8 +221,7 @@ namespace engine {
 
 			/* update direction */
 			inline auto update_direction(void) noexcept -> void {
-				_direction.x = std::sin(_rotation.y);
-				_direction.y = std::cos(_rotation.y);
+				math::sincos(_rotation.y, _direction.x, _direction.y);
 			}
 
 
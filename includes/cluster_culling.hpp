@@ -0,0 +1,322 @@
+#ifndef ENGINE_CLUSTER_CULLING_HPP
+#define ENGINE_CLUSTER_CULLING_HPP
+
+#include "meshlet.hpp"
+#include "model.hpp"
+
+#include "simd.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- C L U S T E R  C U L L I N G ----------------------------------------
+
+	/* per frame meshlet culling on the cpu: bounding spheres against the
+	   view frustum, normal cones against the camera position (single sided
+	   meshes, skipped under non uniform scale), visible meshlets merged into
+	   index ranges, rejected triangles counted until reset; also picks the
+	   coarsest lod whose error projects under LOD_THRESHOLD pixels */
+
+	class cluster_culling final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::cluster_culling;
+
+			/* size type */
+			using size_type = std::size_t;
+
+
+			// -- S T A T I S T I C S -----------------------------------------
+
+			struct statistics final {
+
+				/* meshlets tested */
+				size_type meshlets;
+
+				/* meshlets kept */
+				size_type visible;
+
+				/* triangles tested */
+				size_type triangles;
+
+				/* triangles rejected by the frustum */
+				size_type frustum_rejected;
+
+				/* triangles rejected by the normal cones */
+				size_type backface_rejected;
+			};
+
+
+			// -- R A N G E ---------------------------------------------------
+
+			struct range final {
+
+				/* first index */
+				std::uint32_t index_offset;
+
+				/* index count */
+				std::uint32_t index_count;
+
+				/* owning submesh */
+				std::uint32_t submesh;
+			};
+
+
+			// -- public constants --------------------------------------------
+
+			/* largest lod error on screen, in pixels */
+			static constexpr float LOD_THRESHOLD = 1.0f;
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* camera constructor (column major projection and view, eye in world space,
+			   viewport height in pixels, 0: base level only) */
+			inline cluster_culling(const simd::float4x4& projection, const simd::float4x4& view,
+								   const simd::float3& eye, const float height = 0.0f) noexcept
+			: _planes{}, _eye{eye.x, eye.y, eye.z}, _pixels{projection.columns[1].y * height * 0.5f},
+			  _stats{0U, 0U, 0U, 0U, 0U} {
+
+				float p[16], v[16], clip[16];
+				self::load(projection, p);
+				self::load(view, v);
+				self::multiply(p, v, clip);
+
+				// row r of the column major clip matrix
+				auto row = [&clip](const unsigned int r, const unsigned int c) noexcept -> float {
+					return clip[(c * 4U) + r];
+				};
+
+				// left, right, bottom, top, near (metal depth starts at 0), far
+				const float sign[6] { +1.0f, -1.0f, +1.0f, -1.0f, 0.0f, -1.0f };
+				const unsigned int axis[6] { 0U, 0U, 1U, 1U, 2U, 2U };
+
+				for (unsigned int i = 0U; i < 6U; ++i) {
+
+					float plane[4];
+					for (unsigned int c = 0U; c < 4U; ++c)
+						plane[c] = (i == 4U) ? row(2U, c) : row(3U, c) + sign[i] * row(axis[i], c);
+
+					const float length = std::sqrt(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+					const float inv = length > 0.0f ? 1.0f / length : 0.0f;
+
+					for (unsigned int c = 0U; c < 4U; ++c)
+						_planes[i][c] = plane[c] * inv;
+				}
+			}
+
+			/* destructor */
+			inline ~cluster_culling(void) noexcept = default;
+
+
+			// -- public accessors --------------------------------------------
+
+			/* statistics since construction or reset */
+			inline auto stats(void) const noexcept -> const statistics& {
+				return _stats;
+			}
+
+
+			// -- public modifiers --------------------------------------------
+
+			/* clear statistics */
+			inline auto reset(void) noexcept -> void {
+				_stats = statistics{0U, 0U, 0U, 0U, 0U};
+			}
+
+			/* append the visible index ranges of meshlets placed by world, adjacent ones merged */
+			auto cull(const engine::meshlet* meshlets, const size_type count,
+					  const simd::float4x4& world, std::vector<range>& out) noexcept -> void {
+
+				float w[16];
+				self::load(world, w);
+
+				float smin = 0.0f;
+				const float smax = self::scale(w, smin);
+
+				const bool cones = smax > 0.0f && (smax - smin) <= smax * 1e-3f;
+
+				for (size_type i = 0U; i < count; ++i) {
+
+					const auto& m = meshlets[i];
+					const size_type triangles = m.index_count / 3U;
+
+					++_stats.meshlets;
+					_stats.triangles += triangles;
+
+					float center[3];
+					self::transform(w, m.center, center);
+
+					const float radius = m.radius * smax;
+
+					if (self::outside(center, radius)) {
+						_stats.frustum_rejected += triangles;
+						continue;
+					}
+
+					if (cones && m.cone_cutoff < 1.0f) {
+
+						float axis[3];
+						for (unsigned int r = 0U; r < 3U; ++r)
+							axis[r] = (w[r] * m.cone_axis[0] + w[4U + r] * m.cone_axis[1] + w[8U + r] * m.cone_axis[2]) / smax;
+
+						const float d[3] { center[0] - _eye[0], center[1] - _eye[1], center[2] - _eye[2] };
+						const float distance = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+
+						// every face points away from the eye
+						if (d[0] * axis[0] + d[1] * axis[1] + d[2] * axis[2] >= m.cone_cutoff * distance + radius) {
+							_stats.backface_rejected += triangles;
+							continue;
+						}
+					}
+
+					++_stats.visible;
+
+					if (not out.empty() && out.back().submesh == m.submesh
+					 && out.back().index_offset + out.back().index_count == m.index_offset)
+						out.back().index_count += m.index_count;
+					else
+						out.push_back(range{m.index_offset, m.index_count, m.submesh});
+				}
+			}
+
+			/* append the visible index ranges of a meshlet table */
+			inline auto cull(const engine::meshlets& meshlets, const simd::float4x4& world,
+							 std::vector<range>& out) noexcept -> void {
+				self::cull(meshlets.data(), meshlets.size(), world, out);
+			}
+
+			/* lod to draw for a mesh bounded by sphere (xyz center, w radius) placed by world,
+			   0 for the base mesh, levels sorted by growing error */
+			auto level(const engine::lod* lods, const size_type count, const simd::float4& sphere,
+					   const simd::float4x4& world) const noexcept -> size_type {
+
+				if (count == 0U || _pixels <= 0.0f)
+					return 0U;
+
+				float w[16];
+				self::load(world, w);
+
+				float smin = 0.0f;
+				const float smax = self::scale(w, smin);
+
+				const float local[3] { sphere.x, sphere.y, sphere.z };
+				float center[3];
+				self::transform(w, local, center);
+
+				const float d[3] { center[0] - _eye[0], center[1] - _eye[1], center[2] - _eye[2] };
+				const float distance = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]) - (sphere.w * smax);
+
+				// eye inside the bounds
+				if (distance <= 0.0f)
+					return 0U;
+
+				const float pixels = (_pixels * smax) / distance;
+
+				for (size_type i = count; i != 0U; --i)
+					if (lods[i - 1U].error * pixels <= LOD_THRESHOLD)
+						return i;
+				return 0U;
+			}
+
+			/* sphere (xyz center, w radius) placed by world entirely outside the frustum */
+			inline auto outside(const simd::float4& sphere, const simd::float4x4& world) const noexcept -> bool {
+
+				float w[16];
+				self::load(world, w);
+
+				float smin = 0.0f;
+				const float smax = self::scale(w, smin);
+
+				const float local[3] { sphere.x, sphere.y, sphere.z };
+				float center[3];
+				self::transform(w, local, center);
+
+				return self::outside(center, sphere.w * smax);
+			}
+
+
+		private:
+
+			// -- private static methods --------------------------------------
+
+			/* column major floats of a simd matrix */
+			static inline auto load(const simd::float4x4& m, float (&out)[16]) noexcept -> void {
+				for (unsigned int c = 0U; c < 4U; ++c) {
+					out[(c * 4U) + 0U] = m.columns[c].x;
+					out[(c * 4U) + 1U] = m.columns[c].y;
+					out[(c * 4U) + 2U] = m.columns[c].z;
+					out[(c * 4U) + 3U] = m.columns[c].w;
+				}
+			}
+
+			/* column major a * b */
+			static inline auto multiply(const float (&a)[16], const float (&b)[16], float (&out)[16]) noexcept -> void {
+				for (unsigned int c = 0U; c < 4U; ++c)
+					for (unsigned int r = 0U; r < 4U; ++r)
+						out[(c * 4U) + r] = a[r] * b[c * 4U] + a[4U + r] * b[(c * 4U) + 1U]
+										  + a[8U + r] * b[(c * 4U) + 2U] + a[12U + r] * b[(c * 4U) + 3U];
+			}
+
+
+			/* largest axis scale of a column major matrix, smallest in smin */
+			static inline auto scale(const float (&w)[16], float& smin) noexcept -> float {
+				float smax = 0.0f;
+				for (unsigned int c = 0U; c < 3U; ++c) {
+					const float s = std::sqrt(w[c * 4U] * w[c * 4U] + w[c * 4U + 1U] * w[c * 4U + 1U]
+											+ w[c * 4U + 2U] * w[c * 4U + 2U]);
+					smax = (c == 0U || s > smax) ? s : smax;
+					smin = (c == 0U || s < smin) ? s : smin;
+				}
+				return smax;
+			}
+
+			/* point placed by a column major matrix */
+			static inline auto transform(const float (&w)[16], const float (&p)[3], float (&out)[3]) noexcept -> void {
+				for (unsigned int r = 0U; r < 3U; ++r)
+					out[r] = w[r] * p[0] + w[4U + r] * p[1] + w[8U + r] * p[2] + w[12U + r];
+			}
+
+
+			// -- private methods ---------------------------------------------
+
+			/* sphere entirely behind one plane */
+			inline auto outside(const float (&center)[3], const float radius) const noexcept -> bool {
+				for (const auto& p : _planes)
+					if (p[0] * center[0] + p[1] * center[1] + p[2] * center[2] + p[3] < -radius)
+						return true;
+				return false;
+			}
+
+
+			// -- private members ---------------------------------------------
+
+			/* frustum planes, world space, inside positive */
+			float _planes[6][4];
+
+			/* eye position */
+			float _eye[3];
+
+			/* pixels per unit at unit distance */
+			float _pixels;
+
+			/* rejection counters */
+			statistics _stats;
+
+	};
+
+}
+
+#endif // ENGINE_CLUSTER_CULLING_HPP
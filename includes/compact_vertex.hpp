@@ -0,0 +1,358 @@
+#ifndef ENGINE_COMPACT_VERTEX_HPP
+#define ENGINE_COMPACT_VERTEX_HPP
+
+#include "vertex.hpp"
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- V E R T E X  F O R M A T --------------------------------------------
+
+	/* gpu vertex layout */
+	enum class vertex_format : unsigned int {
+		/* engine::vertex as is (48 bytes) */
+		FULL,
+		/* engine::compact_vertex (16 bytes) */
+		COMPACT,
+		/* packed positions (12 bytes) and engine::vertex_attributes (20 bytes) in two buffers */
+		SPLIT
+	};
+
+
+	// -- C O M P A C T  V E R T E X ------------------------------------------
+
+	/* quantized vertex, matches the compact_3D vertex descriptor */
+	struct compact_vertex final {
+
+		/* position, unorm16 in the mesh box (w unused) */
+		std::uint16_t position[4];
+
+		/* octahedral normal, snorm16 */
+		std::int16_t normal[2];
+
+		/* texture coordinate, half float */
+		std::uint16_t texcoord[2];
+	};
+
+	static_assert(sizeof(engine::compact_vertex) == 16U, "compact vertex must stay 16 bytes");
+
+	/* compact vertex vector */
+	using compact_vertices = std::vector<engine::compact_vertex>;
+
+
+	// -- D E Q U A N T I Z E -------------------------------------------------
+
+	/* position = offset + unorm * scale, bound at vertex buffer 5 */
+	struct dequantize final {
+
+		/* box extent (w unused) */
+		simd::float4 scale;
+
+		/* box minimum (w unused) */
+		simd::float4 offset;
+	};
+
+
+	// -- V E R T E X  C O D E C ----------------------------------------------
+
+	/* compact vertex encode / decode, four lanes per step */
+
+	class vertex_codec final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::vertex_codec;
+
+			/* size type */
+			using size_type = std::size_t;
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* non-instanciable class */
+			vertex_codec(void) = delete;
+
+
+			// -- public static methods ---------------------------------------
+
+			/* bounding box of the positions as scale / offset (zero extents kept at one) */
+			static auto quantization(const engine::vertex* vertices, const size_type count) noexcept -> engine::dequantize {
+
+				if (count == 0U)
+					return engine::dequantize{{1.0f, 1.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 0.0f, 0.0f}};
+
+				f32x4 lo = self::load_position(vertices[0U]);
+				f32x4 hi = lo;
+
+				for (size_type i = 1U; i < count; ++i) {
+					const f32x4 p = self::load_position(vertices[i]);
+					lo = self::select(p < lo, p, lo);
+					hi = self::select(p > hi, p, hi);
+				}
+
+				const f32x4 extent = hi - lo;
+				const f32x4 scale  = self::select(extent > 0.0f, extent, f32x4{1.0f, 1.0f, 1.0f, 1.0f});
+
+				return engine::dequantize{{scale[0], scale[1], scale[2], 0.0f},
+										  {lo[0], lo[1], lo[2], 0.0f}};
+			}
+
+			/* encode count vertices */
+			static auto encode(const engine::vertex* in, const size_type count,
+							   const engine::dequantize& q, engine::compact_vertex* out) noexcept -> void {
+
+				const f32x4 offset{q.offset.x, q.offset.y, q.offset.z, 0.0f};
+				const f32x4 inverse{1.0f / q.scale.x, 1.0f / q.scale.y, 1.0f / q.scale.z, 0.0f};
+
+				size_type i = 0U;
+
+				for (; i + 4U <= count; i += 4U)
+					self::encode4(in + i, offset, inverse, out + i);
+
+				// tail through a padded batch
+				if (i < count) {
+					engine::vertex tail[4];
+					engine::compact_vertex packed[4];
+					for (size_type j = 0U; j < 4U; ++j)
+						tail[j] = in[i + (j < count - i ? j : 0U)];
+					self::encode4(tail, offset, inverse, packed);
+					std::memcpy(out + i, packed, (count - i) * sizeof(engine::compact_vertex));
+				}
+			}
+
+			/* decode count vertices */
+			static auto decode(const engine::compact_vertex* in, const size_type count,
+							   const engine::dequantize& q, engine::vertex* out) noexcept -> void {
+
+				const f32x4 offset{q.offset.x, q.offset.y, q.offset.z, 0.0f};
+				const f32x4 scale{q.scale.x / 65535.0f, q.scale.y / 65535.0f, q.scale.z / 65535.0f, 0.0f};
+
+				size_type i = 0U;
+
+				for (; i + 4U <= count; i += 4U)
+					self::decode4(in + i, offset, scale, out + i);
+
+				if (i < count) {
+					engine::compact_vertex tail[4];
+					engine::vertex unpacked[4];
+					for (size_type j = 0U; j < 4U; ++j)
+						tail[j] = in[i + (j < count - i ? j : 0U)];
+					self::decode4(tail, offset, scale, unpacked);
+					for (size_type j = 0U; j < count - i; ++j)
+						out[i + j] = unpacked[j];
+				}
+			}
+
+			/* encode a vertex vector, scale / offset from its bounds */
+			static auto encode(const engine::vertices& vertices, engine::dequantize& q) -> engine::compact_vertices {
+				q = self::quantization(vertices.data(), vertices.size());
+				engine::compact_vertices out(vertices.size());
+				self::encode(vertices.data(), vertices.size(), q, out.data());
+				return out;
+			}
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* four floats */
+			using f32x4 = float __attribute__((vector_size(16)));
+
+			/* four signed integers */
+			using i32x4 = std::int32_t __attribute__((vector_size(16)));
+
+
+			// -- private static methods --------------------------------------
+
+			/* lane select (mask lanes all ones or zero) */
+			static inline auto select(const i32x4 mask, const f32x4 a, const f32x4 b) noexcept -> f32x4 {
+				const i32x4 ia = std::bit_cast<i32x4>(a);
+				const i32x4 ib = std::bit_cast<i32x4>(b);
+				return std::bit_cast<f32x4>((ia & mask) | (ib & ~mask));
+			}
+
+			/* integer lane select */
+			static inline auto select(const i32x4 mask, const i32x4 a, const i32x4 b) noexcept -> i32x4 {
+				return (a & mask) | (b & ~mask);
+			}
+
+			/* absolute value */
+			static inline auto abs(const f32x4 v) noexcept -> f32x4 {
+				return std::bit_cast<f32x4>(std::bit_cast<i32x4>(v) & 0x7fffffff);
+			}
+
+			/* magnitude of a with the sign of b */
+			static inline auto copysign(const f32x4 a, const f32x4 b) noexcept -> f32x4 {
+				const i32x4 sign = std::bit_cast<i32x4>(b) & static_cast<std::int32_t>(0x80000000U);
+				return std::bit_cast<f32x4>((std::bit_cast<i32x4>(a) & 0x7fffffff) | sign);
+			}
+
+			/* clamp */
+			static inline auto clamp(const f32x4 v, const float lo, const float hi) noexcept -> f32x4 {
+				const f32x4 l = self::select(v < lo, f32x4{lo, lo, lo, lo}, v);
+				return self::select(l > hi, f32x4{hi, hi, hi, hi}, l);
+			}
+
+			/* round half away from zero to integer */
+			static inline auto round(const f32x4 v) noexcept -> i32x4 {
+				return __builtin_convertvector(v + self::copysign(f32x4{0.5f, 0.5f, 0.5f, 0.5f}, v), i32x4);
+			}
+
+			/* position as four lanes (w zero) */
+			static inline auto load_position(const engine::vertex& v) noexcept -> f32x4 {
+				return f32x4{v.px(), v.py(), v.pz(), 0.0f};
+			}
+
+			/* float to half, round to nearest even, overflow to infinity, nan kept quiet */
+			static inline auto to_half(const f32x4 f) noexcept -> i32x4 {
+
+				const i32x4 bits = std::bit_cast<i32x4>(f);
+				const i32x4 sign = (bits >> 16) & 0x8000;
+				const i32x4 mag  = bits & 0x7fffffff;
+
+				// too large: infinity or nan
+				const i32x4 big = self::select(mag > (255 << 23), i32x4{0x7e00, 0x7e00, 0x7e00, 0x7e00},
+															      i32x4{0x7c00, 0x7c00, 0x7c00, 0x7c00});
+
+				// subnormal: let the fpu round by adding a magic denormal
+				const f32x4 magic = std::bit_cast<f32x4>(i32x4{126 << 23, 126 << 23, 126 << 23, 126 << 23});
+				const i32x4 small = std::bit_cast<i32x4>(std::bit_cast<f32x4>(mag) + magic) - (126 << 23);
+
+				// normal: rebias, round to nearest even
+				const i32x4 odd    = (mag >> 13) & 1;
+				const i32x4 normal = (mag + ((15 - 127) << 23) + 0xfff + odd) >> 13;
+
+				i32x4 h = self::select(mag < (113 << 23), small, normal);
+				h = self::select(mag >= ((127 + 16) << 23), big, h);
+				return h | sign;
+			}
+
+			/* half to float */
+			static inline auto from_half(const i32x4 h) noexcept -> f32x4 {
+
+				constexpr std::int32_t shifted = 0x7c00 << 13;
+
+				i32x4 o = (h & 0x7fff) << 13;
+				const i32x4 exp = o & shifted;
+				o += (127 - 15) << 23;
+
+				// infinity or nan: extra exponent adjust
+				const i32x4 special = o + ((128 - 16) << 23);
+
+				// subnormal: renormalize through the fpu
+				const f32x4 magic = std::bit_cast<f32x4>(i32x4{113 << 23, 113 << 23, 113 << 23, 113 << 23});
+				const i32x4 denormal = std::bit_cast<i32x4>(std::bit_cast<f32x4>(o + (1 << 23)) - magic);
+
+				o = self::select(exp == shifted, special, o);
+				o = self::select(exp == 0, denormal, o);
+
+				return std::bit_cast<f32x4>(o | ((h & 0x8000) << 16));
+			}
+
+			/* encode four vertices */
+			static inline auto encode4(const engine::vertex* in, const f32x4 offset, const f32x4 inverse,
+									   engine::compact_vertex* out) noexcept -> void {
+
+				// positions, one vertex per vector
+				for (unsigned int j = 0U; j < 4U; ++j) {
+					const f32x4 unit = self::clamp((self::load_position(in[j]) - offset) * inverse, 0.0f, 1.0f);
+					const i32x4 q    = self::round(unit * 65535.0f);
+					out[j].position[0] = static_cast<std::uint16_t>(q[0]);
+					out[j].position[1] = static_cast<std::uint16_t>(q[1]);
+					out[j].position[2] = static_cast<std::uint16_t>(q[2]);
+					out[j].position[3] = 0U;
+				}
+
+				// normals, one component per vector
+				f32x4 x{in[0].nx(), in[1].nx(), in[2].nx(), in[3].nx()};
+				f32x4 y{in[0].ny(), in[1].ny(), in[2].ny(), in[3].ny()};
+				const f32x4 z{in[0].nz(), in[1].nz(), in[2].nz(), in[3].nz()};
+
+				// project on the octahedron (zero normals come back as +z)
+				const f32x4 l1  = self::abs(x) + self::abs(y) + self::abs(z);
+				const f32x4 inv = self::select(l1 > 0.0f, 1.0f / self::select(l1 > 0.0f, l1, f32x4{1.0f, 1.0f, 1.0f, 1.0f}),
+											   f32x4{0.0f, 0.0f, 0.0f, 0.0f});
+				x *= inv;
+				y *= inv;
+
+				// fold the lower hemisphere
+				const i32x4 lower = (z * inv) < 0.0f;
+				const f32x4 fx = self::copysign(1.0f - self::abs(y), x);
+				const f32x4 fy = self::copysign(1.0f - self::abs(x), y);
+				x = self::select(lower, fx, x);
+				y = self::select(lower, fy, y);
+
+				const i32x4 nx = self::round(self::clamp(x, -1.0f, 1.0f) * 32767.0f);
+				const i32x4 ny = self::round(self::clamp(y, -1.0f, 1.0f) * 32767.0f);
+
+				// texture coordinates
+				const i32x4 tu = self::to_half(f32x4{in[0].tu(), in[1].tu(), in[2].tu(), in[3].tu()});
+				const i32x4 tv = self::to_half(f32x4{in[0].tv(), in[1].tv(), in[2].tv(), in[3].tv()});
+
+				for (unsigned int j = 0U; j < 4U; ++j) {
+					out[j].normal[0]   = static_cast<std::int16_t>(nx[j]);
+					out[j].normal[1]   = static_cast<std::int16_t>(ny[j]);
+					out[j].texcoord[0] = static_cast<std::uint16_t>(tu[j]);
+					out[j].texcoord[1] = static_cast<std::uint16_t>(tv[j]);
+				}
+			}
+
+			/* decode four vertices */
+			static inline auto decode4(const engine::compact_vertex* in, const f32x4 offset, const f32x4 scale,
+									   engine::vertex* out) noexcept -> void {
+
+				// octahedral normals
+				f32x4 x{static_cast<float>(in[0].normal[0]), static_cast<float>(in[1].normal[0]),
+						static_cast<float>(in[2].normal[0]), static_cast<float>(in[3].normal[0])};
+				f32x4 y{static_cast<float>(in[0].normal[1]), static_cast<float>(in[1].normal[1]),
+						static_cast<float>(in[2].normal[1]), static_cast<float>(in[3].normal[1])};
+
+				x = self::clamp(x * (1.0f / 32767.0f), -1.0f, 1.0f);
+				y = self::clamp(y * (1.0f / 32767.0f), -1.0f, 1.0f);
+
+				f32x4 z = 1.0f - self::abs(x) - self::abs(y);
+
+				// unfold the lower hemisphere
+				const f32x4 t = self::select(z < 0.0f, -z, f32x4{0.0f, 0.0f, 0.0f, 0.0f});
+				x -= self::copysign(t, x);
+				y -= self::copysign(t, y);
+
+				const f32x4 length2 = x * x + y * y + z * z;
+				f32x4 inv{};
+				for (unsigned int j = 0U; j < 4U; ++j)
+					inv[j] = length2[j] > 0.0f ? 1.0f / std::sqrt(length2[j]) : 0.0f;
+				x *= inv;
+				y *= inv;
+				z *= inv;
+
+				const f32x4 tu = self::from_half(i32x4{in[0].texcoord[0], in[1].texcoord[0], in[2].texcoord[0], in[3].texcoord[0]});
+				const f32x4 tv = self::from_half(i32x4{in[0].texcoord[1], in[1].texcoord[1], in[2].texcoord[1], in[3].texcoord[1]});
+
+				for (unsigned int j = 0U; j < 4U; ++j) {
+					const f32x4 q{static_cast<float>(in[j].position[0]),
+								  static_cast<float>(in[j].position[1]),
+								  static_cast<float>(in[j].position[2]), 0.0f};
+					const f32x4 p = offset + q * scale;
+					out[j] = engine::vertex{p[0], p[1], p[2], x[j], y[j], z[j], tu[j], tv[j]};
+				}
+			}
+
+	};
+
+}
+
+#endif // ENGINE_COMPACT_VERTEX_HPP
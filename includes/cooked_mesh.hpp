@@ -0,0 +1,671 @@
+#ifndef ENGINE_COOKED_MESH_HPP
+#define ENGINE_COOKED_MESH_HPP
+
+#include "vertex.hpp"
+#include "model.hpp"
+#include "meshlet.hpp"
+#include "welder.hpp"
+#include "mapped_file.hpp"
+#include "hash.hpp"
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- C O O K E D  M E S H ------------------------------------------------
+
+	/* versioned binary mesh container, mapped read-only and handed as is
+	   to the gpu buffers (no parsing, no conversion on load)
+
+	   layout: header | submesh table | meshlet table | lod table | lod
+	   submesh tables | names | vertex stream | tangent stream | index
+	   stream,
+	   streams start on STREAM_ALIGN boundaries, indexes are 16-bit when
+	   the vertex count allows it, lod indexes follow the base ones in the
+	   index stream (lod offsets are relative to their start), names are
+	   material names then library paths in fixed NAME_SIZE records; the
+	   source stamp lets a loader trust the file without hashing the source */
+
+	class cooked_mesh final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::cooked_mesh;
+
+			/* size type */
+			using size_type = std::size_t;
+
+
+			// -- public constants --------------------------------------------
+
+			/* file version, bump on any layout or cooking change */
+			enum : std::uint32_t { VERSION = 7U };
+
+			/* stream alignment */
+			enum : size_type { STREAM_ALIGN = 64U };
+
+			/* name record size (nul terminated) */
+			enum : size_type { NAME_SIZE = 64U };
+
+
+			// -- N A M E -----------------------------------------------------
+
+			struct name final {
+
+				/* nul terminated */
+				char value[NAME_SIZE];
+			};
+
+
+			// -- S T A M P ---------------------------------------------------
+
+			struct stamp final {
+
+				/* source size */
+				std::uint64_t size;
+
+				/* source modification time (ns, 0: unknown, never matches) */
+				std::uint64_t time;
+
+				/* same source file */
+				inline auto operator==(const stamp& other) const noexcept -> bool {
+					return time != 0U && size == other.size && time == other.time;
+				}
+			};
+
+
+			// -- H E A D E R -------------------------------------------------
+
+			struct header final {
+
+				/* "EMSH" */
+				char magic[4];
+
+				/* file version */
+				std::uint32_t version;
+
+				/* key of the source bytes and cook settings (asset_cooker::key) */
+				std::uint64_t source_hash;
+
+				/* size and modification time of the source at cook time */
+				struct stamp source;
+
+				/* sizeof(engine::vertex) at cook time */
+				std::uint32_t vertex_size;
+
+				/* vertex count */
+				std::uint32_t vertex_count;
+
+				/* 2 or 4 */
+				std::uint32_t index_size;
+
+				/* index count */
+				std::uint32_t index_count;
+
+				/* submesh count */
+				std::uint32_t submesh_count;
+
+				/* material name count */
+				std::uint32_t material_count;
+
+				/* library path count */
+				std::uint32_t library_count;
+
+				/* meshlet count */
+				std::uint32_t meshlet_count;
+
+				/* lod count (base excluded) */
+				std::uint32_t lod_count;
+
+				/* lod index count (after the base indexes) */
+				std::uint32_t lod_index_count;
+
+				/* tangent count (0 or vertex count) */
+				std::uint32_t tangent_count;
+
+				/* reserved */
+				std::uint32_t reserved;
+
+				/* mesh bounds */
+				engine::bounds bounds;
+
+				/* stream offsets */
+				std::uint64_t submesh_offset;
+				std::uint64_t meshlet_offset;
+				std::uint64_t lod_offset;
+				std::uint64_t lod_submesh_offset;
+				std::uint64_t name_offset;
+				std::uint64_t vertex_offset;
+				std::uint64_t tangent_offset;
+				std::uint64_t index_offset;
+
+				/* total size */
+				std::uint64_t file_size;
+			};
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* default constructor */
+			inline cooked_mesh(void) noexcept
+			: _file{}, _header{nullptr} {}
+
+			/* path constructor (invalid on missing, truncated or foreign file) */
+			inline cooked_mesh(const char* path) noexcept
+			: _file{path}, _header{nullptr} {
+
+				if (not _file || not self::valid(_file.data(), _file.size()))
+					return;
+
+				_header = reinterpret_cast<const struct header*>(_file.data());
+			}
+
+			/* bytes constructor, a view valid while they live (invalid on a
+			   truncated or foreign file, bytes aligned as operator new does) */
+			inline cooked_mesh(const char* begin, const char* end) noexcept
+			: _file{}, _header{nullptr} {
+
+				if (not self::valid(begin, static_cast<size_type>(end - begin)))
+					return;
+
+				_header = reinterpret_cast<const struct header*>(begin);
+			}
+
+			/* non-copyable class */
+			non_copyable(cooked_mesh);
+
+			/* move constructor */
+			inline cooked_mesh(self&& other) noexcept
+			: _file{std::move(other._file)}, _header{other._header} {
+				other._header = nullptr;
+			}
+
+			/* destructor */
+			inline ~cooked_mesh(void) noexcept = default;
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* move assignment operator */
+			inline auto operator=(self&& other) noexcept -> self& {
+				if (this == &other) return *this;
+				_file   = std::move(other._file);
+				_header = other._header;
+				other._header = nullptr;
+				return *this;
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* source key */
+			inline auto source_hash(void) const noexcept -> std::uint64_t {
+				return _header->source_hash;
+			}
+
+			/* source stamp at cook time */
+			inline auto source_stamp(void) const noexcept -> const struct stamp& {
+				return _header->source;
+			}
+
+			/* vertex data */
+			inline auto vertices(void) const noexcept -> const void* {
+				return self::base() + _header->vertex_offset;
+			}
+
+			/* vertex count */
+			inline auto vertex_count(void) const noexcept -> size_type {
+				return _header->vertex_count;
+			}
+
+			/* vertex bytes */
+			inline auto vertex_bytes(void) const noexcept -> size_type {
+				return static_cast<size_type>(_header->vertex_count) * _header->vertex_size;
+			}
+
+			/* tangent data (xyz tangent, w bitangent sign) */
+			inline auto tangents(void) const noexcept -> const simd::float4* {
+				return reinterpret_cast<const simd::float4*>(self::base() + _header->tangent_offset);
+			}
+
+			/* tangent count (0 or vertex count) */
+			inline auto tangent_count(void) const noexcept -> size_type {
+				return _header->tangent_count;
+			}
+
+			/* index data */
+			inline auto indexes(void) const noexcept -> const void* {
+				return self::base() + _header->index_offset;
+			}
+
+			/* index count */
+			inline auto index_count(void) const noexcept -> size_type {
+				return _header->index_count;
+			}
+
+			/* index size (2 or 4) */
+			inline auto index_size(void) const noexcept -> size_type {
+				return _header->index_size;
+			}
+
+			/* index bytes (base and lod indexes) */
+			inline auto index_bytes(void) const noexcept -> size_type {
+				return (static_cast<size_type>(_header->index_count) + _header->lod_index_count) * _header->index_size;
+			}
+
+			/* mesh bounds */
+			inline auto bounds(void) const noexcept -> const engine::bounds& {
+				return _header->bounds;
+			}
+
+			/* submesh table */
+			inline auto submeshes(void) const noexcept -> const engine::submesh* {
+				return reinterpret_cast<const engine::submesh*>(self::base() + _header->submesh_offset);
+			}
+
+			/* submesh count */
+			inline auto submesh_count(void) const noexcept -> size_type {
+				return _header->submesh_count;
+			}
+
+			/* meshlet table */
+			inline auto meshlets(void) const noexcept -> const engine::meshlet* {
+				return reinterpret_cast<const engine::meshlet*>(self::base() + _header->meshlet_offset);
+			}
+
+			/* meshlet count */
+			inline auto meshlet_count(void) const noexcept -> size_type {
+				return _header->meshlet_count;
+			}
+
+			/* lod table */
+			inline auto lods(void) const noexcept -> const engine::lod* {
+				return reinterpret_cast<const engine::lod*>(self::base() + _header->lod_offset);
+			}
+
+			/* lod count */
+			inline auto lod_count(void) const noexcept -> size_type {
+				return _header->lod_count;
+			}
+
+			/* lod submesh tables (submesh count entries per level) */
+			inline auto lod_submeshes(void) const noexcept -> const engine::submesh* {
+				return reinterpret_cast<const engine::submesh*>(self::base() + _header->lod_submesh_offset);
+			}
+
+			/* lod submesh entries */
+			inline auto lod_submesh_count(void) const noexcept -> size_type {
+				return static_cast<size_type>(_header->lod_count) * _header->submesh_count;
+			}
+
+			/* material name */
+			inline auto material(const size_type i) const noexcept -> std::string_view {
+				return self::names()[i].value;
+			}
+
+			/* material count */
+			inline auto material_count(void) const noexcept -> size_type {
+				return _header->material_count;
+			}
+
+			/* library path */
+			inline auto library(const size_type i) const noexcept -> std::string_view {
+				return self::names()[_header->material_count + i].value;
+			}
+
+			/* library count */
+			inline auto library_count(void) const noexcept -> size_type {
+				return _header->library_count;
+			}
+
+
+			// -- public boolean operators ------------------------------------
+
+			/* boolean operator */
+			explicit inline operator bool(void) const noexcept {
+				return _header != nullptr;
+			}
+
+			/* not operator */
+			inline auto operator!(void) const noexcept -> bool {
+				return _header == nullptr;
+			}
+
+
+			// -- public static methods ---------------------------------------
+
+			/* cooked path for a source path */
+			static inline auto path(const char* source) -> std::string {
+				return std::string{source} + ".cooked";
+			}
+
+			/* header of the cooked file at path has this version and source stamp (reads the header only) */
+			static auto stamped(const char* path, const struct stamp& source) noexcept -> bool {
+
+				const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+
+				if (fd == -1)
+					return false;
+
+				struct header h{};
+				const bool read = ::pread(fd, &h, sizeof(h), 0) == static_cast<::ssize_t>(sizeof(h));
+
+				::close(fd);
+
+				return read && std::memcmp(h.magic, MAGIC, sizeof(h.magic)) == 0
+					&& h.version == VERSION && h.source == source;
+			}
+
+			/* rewrite the source stamp of the cooked file at path in place (content unchanged) */
+			static auto restamp(const char* path, const struct stamp& source) noexcept -> bool {
+
+				const int fd = ::open(path, O_WRONLY | O_CLOEXEC);
+
+				if (fd == -1)
+					return false;
+
+				const bool ok = self::put(fd, &source, sizeof(source), offsetof(struct header, source));
+
+				return (::close(fd) == 0) && ok;
+			}
+
+			/* write model, through a temporary file renamed in place
+			   (false when a name does not fit a record) */
+			static auto write(const char* path, const engine::model& model, const std::uint64_t source_hash,
+							  const struct stamp& source = stamp{}) -> bool {
+
+				const auto& vertices  = model.package.first;
+				const auto& indexes   = model.package.second;
+				const auto& submeshes = model.submeshes;
+				const auto  meshlets  = engine::meshlet_builder::build(model);
+
+				const auto& lods          = model.lods;
+				const auto& lod_indexes   = model.lod_indexes;
+				const auto& lod_submeshes = model.lod_submeshes;
+				const auto& tangents      = model.tangents;
+
+				if (vertices.size() > 0xffffffffU || indexes.size() + lod_indexes.size() > 0xffffffffU
+				 || lod_submeshes.size() != lods.size() * submeshes.size()
+				 || (not tangents.empty() && tangents.size() != vertices.size()))
+					return false;
+
+				// names, materials first
+				std::vector<name> names(model.materials.size() + model.libraries.size(), name{});
+
+				for (size_type i = 0U; i < names.size(); ++i) {
+					const std::string& value = i < model.materials.size()
+						? model.materials[i] : model.libraries[i - model.materials.size()];
+					if (value.size() >= NAME_SIZE)
+						return false;
+					std::memcpy(names[i].value, value.data(), value.size());
+				}
+
+				struct header h{};
+
+				std::memcpy(h.magic, MAGIC, sizeof(h.magic));
+				h.version         = VERSION;
+				h.source_hash     = source_hash;
+				h.source          = source;
+				h.vertex_size     = static_cast<std::uint32_t>(sizeof(engine::vertex));
+				h.vertex_count    = static_cast<std::uint32_t>(vertices.size());
+				h.index_size      = vertices.size() <= 0xffffU ? 2U : 4U;
+				h.index_count     = static_cast<std::uint32_t>(indexes.size());
+				h.submesh_count   = static_cast<std::uint32_t>(submeshes.size());
+				h.material_count  = static_cast<std::uint32_t>(model.materials.size());
+				h.library_count   = static_cast<std::uint32_t>(model.libraries.size());
+				h.meshlet_count   = static_cast<std::uint32_t>(meshlets.size());
+				h.lod_count       = static_cast<std::uint32_t>(lods.size());
+				h.lod_index_count = static_cast<std::uint32_t>(lod_indexes.size());
+				h.tangent_count   = static_cast<std::uint32_t>(tangents.size());
+				h.bounds          = self::compute_bounds(vertices);
+
+				h.submesh_offset     = self::align(sizeof(struct header));
+				h.meshlet_offset     = self::align(h.submesh_offset     + (submeshes.size()     * sizeof(engine::submesh)));
+				h.lod_offset         = self::align(h.meshlet_offset     + (meshlets.size()      * sizeof(engine::meshlet)));
+				h.lod_submesh_offset = self::align(h.lod_offset         + (lods.size()          * sizeof(engine::lod)));
+				h.name_offset        = self::align(h.lod_submesh_offset + (lod_submeshes.size() * sizeof(engine::submesh)));
+				h.vertex_offset      = self::align(h.name_offset        + (names.size()         * sizeof(name)));
+				h.tangent_offset     = self::align(h.vertex_offset      + (vertices.size()      * sizeof(engine::vertex)));
+				h.index_offset       = self::align(h.tangent_offset     + (tangents.size()      * sizeof(simd::float4)));
+				h.file_size          = h.index_offset + ((indexes.size() + lod_indexes.size()) * h.index_size);
+
+				const std::string tmp = std::string{path} + ".tmp";
+
+				const int fd = ::open(tmp.data(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+				if (fd == -1)
+					return false;
+
+				bool ok = self::put(fd, &h, sizeof(h), 0U)
+					   && self::put(fd, submeshes.data(), submeshes.size() * sizeof(engine::submesh), h.submesh_offset)
+					   && self::put(fd, meshlets.data(), meshlets.size() * sizeof(engine::meshlet), h.meshlet_offset)
+					   && self::put(fd, lods.data(), lods.size() * sizeof(engine::lod), h.lod_offset)
+					   && self::put(fd, lod_submeshes.data(), lod_submeshes.size() * sizeof(engine::submesh), h.lod_submesh_offset)
+					   && self::put(fd, names.data(), names.size() * sizeof(name), h.name_offset)
+					   && self::put(fd, self::cleared(vertices).data(), vertices.size() * sizeof(engine::vertex), h.vertex_offset)
+					   && self::put(fd, tangents.data(), tangents.size() * sizeof(simd::float4), h.tangent_offset);
+
+				const size_type lod_index_offset = h.index_offset + (indexes.size() * h.index_size);
+
+				if (ok && h.index_size == 2U) {
+					const auto narrowed     = engine::welder::narrow(indexes);
+					const auto narrowed_lod = engine::welder::narrow(lod_indexes);
+					ok = self::put(fd, narrowed.data(), narrowed.size() * sizeof(std::uint16_t), h.index_offset)
+					  && self::put(fd, narrowed_lod.data(), narrowed_lod.size() * sizeof(std::uint16_t), lod_index_offset);
+				}
+				else if (ok)
+					ok = self::put(fd, indexes.data(), indexes.size() * sizeof(std::uint32_t), h.index_offset)
+					  && self::put(fd, lod_indexes.data(), lod_indexes.size() * sizeof(std::uint32_t), lod_index_offset);
+
+				// empty trailing stream still sizes the file
+				ok = ok && ::ftruncate(fd, static_cast<off_t>(h.file_size)) == 0;
+
+				ok = (::close(fd) == 0) && ok;
+
+				if (not ok || ::rename(tmp.data(), path) != 0) {
+					::unlink(tmp.data());
+					return false;
+				}
+				return true;
+			}
+
+
+		private:
+
+			// -- private constants -------------------------------------------
+
+			/* magic */
+			static constexpr char MAGIC[4] { 'E', 'M', 'S', 'H' };
+
+
+			// -- private methods ---------------------------------------------
+
+			/* first byte of the file */
+			inline auto base(void) const noexcept -> const char* {
+				return reinterpret_cast<const char*>(_header);
+			}
+
+			/* name records */
+			inline auto names(void) const noexcept -> const name* {
+				return reinterpret_cast<const name*>(self::base() + _header->name_offset);
+			}
+
+
+			// -- private static methods --------------------------------------
+
+			/* align offset on stream boundary */
+			static inline auto align(const size_type offset) noexcept -> size_type {
+				return (offset + (STREAM_ALIGN - 1U)) & ~static_cast<size_type>(STREAM_ALIGN - 1U);
+			}
+
+			/* positional write of the whole buffer */
+			static auto put(const int fd, const void* data, size_type size, size_type offset) noexcept -> bool {
+				const auto* p = static_cast<const char*>(data);
+				while (size != 0U) {
+					const auto n = ::pwrite(fd, p, size, static_cast<off_t>(offset));
+					if (n <= 0)
+						return false;
+					p      += n;
+					size   -= static_cast<size_type>(n);
+					offset += static_cast<size_type>(n);
+				}
+				return true;
+			}
+
+			/* vertex stream with the vector padding zeroed, equal models write equal files */
+			static auto cleared(const engine::vertices& vertices) -> std::vector<char> {
+
+				std::vector<char> bytes(vertices.size() * sizeof(engine::vertex), 0);
+
+				for (size_type i = 0U; i < vertices.size(); ++i) {
+
+					const auto& v = vertices[i];
+					const auto* base = reinterpret_cast<const char*>(&v);
+					char* out = bytes.data() + (i * sizeof(engine::vertex));
+
+					std::memcpy(out + (reinterpret_cast<const char*>(&v.position()) - base), &v.position(), sizeof(float) * 3U);
+					std::memcpy(out + (reinterpret_cast<const char*>(&v.normal())   - base), &v.normal(),   sizeof(float) * 3U);
+					std::memcpy(out + (reinterpret_cast<const char*>(&v.texture())  - base), &v.texture(),  sizeof(float) * 2U);
+				}
+				return bytes;
+			}
+
+			/* vertex bounds */
+			static auto compute_bounds(const engine::vertices& vertices) noexcept -> engine::bounds {
+
+				if (vertices.empty())
+					return engine::bounds{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+
+				auto b = engine::bounds::at(vertices[0]);
+
+				for (const auto& v : vertices)
+					b.expand(v);
+
+				return b;
+			}
+
+			/* every index below count (max reduction, vectorized) */
+			template <typename T>
+			static auto bounded(const T* indexes, const size_type size, const std::uint32_t count) noexcept -> bool {
+
+				T max = 0U;
+
+				for (size_type i = 0U; i < size; ++i)
+					max = indexes[i] > max ? indexes[i] : max;
+
+				return size == 0U || max < count;
+			}
+
+			/* header and stream checks */
+			static auto valid(const char* data, const size_type size) noexcept -> bool {
+
+				if (size < sizeof(struct header))
+					return false;
+
+				const auto& h = *reinterpret_cast<const struct header*>(data);
+
+				if (std::memcmp(h.magic, MAGIC, sizeof(h.magic)) != 0
+				 || h.version     != VERSION
+				 || h.vertex_size != sizeof(engine::vertex)
+				 || (h.index_size != 2U && h.index_size != 4U)
+				 || h.file_size   != size
+				 || (h.tangent_count != 0U && h.tangent_count != h.vertex_count))
+					return false;
+
+				const auto fits = [size](const std::uint64_t offset, const std::uint64_t bytes) noexcept -> bool {
+					return offset <= size && bytes <= size - offset && (offset % STREAM_ALIGN) == 0U;
+				};
+
+				if (not fits(h.submesh_offset, static_cast<std::uint64_t>(h.submesh_count) * sizeof(engine::submesh))
+				 || not fits(h.meshlet_offset, static_cast<std::uint64_t>(h.meshlet_count) * sizeof(engine::meshlet))
+				 || not fits(h.lod_offset,     static_cast<std::uint64_t>(h.lod_count)     * sizeof(engine::lod))
+				 || not fits(h.lod_submesh_offset, static_cast<std::uint64_t>(h.lod_count) * h.submesh_count * sizeof(engine::submesh))
+				 || not fits(h.name_offset,    (static_cast<std::uint64_t>(h.material_count) + h.library_count) * sizeof(name))
+				 || not fits(h.vertex_offset,  static_cast<std::uint64_t>(h.vertex_count)  * h.vertex_size)
+				 || not fits(h.tangent_offset, static_cast<std::uint64_t>(h.tangent_count) * sizeof(simd::float4))
+				 || not fits(h.index_offset,   (static_cast<std::uint64_t>(h.index_count) + h.lod_index_count) * h.index_size))
+					return false;
+
+				// submesh ranges inside the index stream, known materials
+				const auto* subs = reinterpret_cast<const engine::submesh*>(data + h.submesh_offset);
+
+				for (size_type i = 0U; i < h.submesh_count; ++i)
+					if (static_cast<std::uint64_t>(subs[i].index_offset) + subs[i].index_count > h.index_count
+					 || (subs[i].material != engine::model::NO_MATERIAL && subs[i].material >= h.material_count))
+						return false;
+
+				// meshlet ranges inside the index stream, known submeshes
+				const auto* meshlets = reinterpret_cast<const engine::meshlet*>(data + h.meshlet_offset);
+
+				for (size_type i = 0U; i < h.meshlet_count; ++i)
+					if (static_cast<std::uint64_t>(meshlets[i].index_offset) + meshlets[i].index_count > h.index_count
+					 || (meshlets[i].submesh != 0U && meshlets[i].submesh >= h.submesh_count))
+						return false;
+
+				// lod ranges inside the lod indexes, level submeshes inside their level
+				const auto* lods     = reinterpret_cast<const engine::lod*>(data + h.lod_offset);
+				const auto* lod_subs = reinterpret_cast<const engine::submesh*>(data + h.lod_submesh_offset);
+
+				for (size_type i = 0U; i < h.lod_count; ++i) {
+
+					if (static_cast<std::uint64_t>(lods[i].index_offset) + lods[i].index_count > h.lod_index_count)
+						return false;
+
+					for (size_type s = 0U; s < h.submesh_count; ++s) {
+						const auto& sub = lod_subs[(i * h.submesh_count) + s];
+						if (sub.index_offset < lods[i].index_offset
+						 || static_cast<std::uint64_t>(sub.index_offset) + sub.index_count
+							> static_cast<std::uint64_t>(lods[i].index_offset) + lods[i].index_count
+						 || sub.material != subs[s].material)
+							return false;
+					}
+				}
+
+				// base and lod indexes inside the vertex stream, the gpu reads them unchecked
+				const size_type indexes = static_cast<size_type>(h.index_count) + h.lod_index_count;
+
+				if (h.index_size == 2U
+					? not self::bounded(reinterpret_cast<const std::uint16_t*>(data + h.index_offset), indexes, h.vertex_count)
+					: not self::bounded(reinterpret_cast<const std::uint32_t*>(data + h.index_offset), indexes, h.vertex_count))
+					return false;
+
+				// nul terminated names
+				const auto* names = reinterpret_cast<const name*>(data + h.name_offset);
+
+				for (size_type i = 0U; i < static_cast<size_type>(h.material_count) + h.library_count; ++i)
+					if (names[i].value[NAME_SIZE - 1U] != '\0')
+						return false;
+
+				return true;
+			}
+
+
+			// -- private members ---------------------------------------------
+
+			/* mapped file (empty for a view) */
+			engine::mapped_file _file;
+
+			/* header view */
+			const struct header* _header;
+
+	};
+
+}
+
+#endif // ENGINE_COOKED_MESH_HPP
@@ -0,0 +1,334 @@
+#ifndef ENGINE_FILE_WATCHER_HPP
+#define ENGINE_FILE_WATCHER_HPP
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <xns>
+
+#if defined(__linux__)
+#	include <sys/inotify.h>
+#elif defined(__APPLE__)
+#	include <sys/event.h>
+#endif
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- F I L E  W A T C H E R ----------------------------------------------
+
+	/* reports watched files that were rewritten or replaced (exporters often
+	   write a temporary and rename it, so the parent directory is watched),
+	   inotify on linux, kqueue on darwin, never reports anything elsewhere,
+	   changes() never blocks */
+
+	class file_watcher final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::file_watcher;
+
+			/* size type */
+			using size_type = std::size_t;
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* default constructor */
+			inline file_watcher(void) noexcept
+			: _files{}, _dirs{},
+#if defined(__linux__)
+			  _fd{::inotify_init1(IN_NONBLOCK | IN_CLOEXEC)}
+#elif defined(__APPLE__)
+			  _fd{::kqueue()}
+#else
+			  _fd{-1}
+#endif
+			{}
+
+			/* non-assignable class */
+			non_assignable(file_watcher);
+
+			/* destructor */
+			inline ~file_watcher(void) noexcept {
+#if defined(__APPLE__)
+				for (const auto& d : _dirs)
+					::close(d.id);
+				for (const auto& f : _files)
+					if (f.fd != -1)
+						::close(f.fd);
+#endif
+				if (_fd != -1)
+					::close(_fd);
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* events available on this platform */
+			explicit inline operator bool(void) const noexcept {
+				return _fd != -1;
+			}
+
+
+			// -- public modifiers --------------------------------------------
+
+			/* watch path (false when unsupported or the directory can't be watched) */
+			auto watch(const std::string& path) -> bool {
+
+				if (_fd == -1)
+					return false;
+
+				for (const auto& f : _files)
+					if (f.path == path)
+						return true;
+
+				const auto slash = path.find_last_of('/');
+				const std::string dir  = (slash == std::string::npos) ? std::string{"."} : path.substr(0U, slash);
+				const std::string name = (slash == std::string::npos) ? path : path.substr(slash + 1U);
+
+				auto it = std::find_if(_dirs.begin(), _dirs.end(), [&dir](const directory& d) noexcept {
+					return d.path == dir;
+				});
+
+				if (it == _dirs.end()) {
+					const int id = self::add_directory(dir);
+					if (id == -1)
+						return false;
+					_dirs.push_back(directory{dir, id});
+					it = _dirs.end() - 1;
+				}
+
+				file f{path, name, it->id, -1, {}};
+				self::stamp(f);
+#if defined(__APPLE__)
+				self::add_file(f);
+#endif
+				_files.push_back(std::move(f));
+				return true;
+			}
+
+			/* stop watching path (its directory too once no watched file is left in it) */
+			auto unwatch(const std::string& path) -> void {
+
+				const auto it = std::find_if(_files.begin(), _files.end(), [&path](const file& f) noexcept {
+					return f.path == path;
+				});
+
+				if (it == _files.end())
+					return;
+
+				const int dir = it->dir;
+#if defined(__APPLE__)
+				if (it->fd != -1)
+					::close(it->fd);
+#endif
+				_files.erase(it);
+
+				for (const auto& f : _files)
+					if (f.dir == dir)
+						return;
+
+#if defined(__linux__)
+				::inotify_rm_watch(_fd, dir);
+#elif defined(__APPLE__)
+				::close(dir);
+#endif
+				std::erase_if(_dirs, [dir](const directory& d) noexcept { return d.id == dir; });
+			}
+
+			/* append paths changed since the last call (each once) */
+			auto changes(std::vector<std::string>& out) -> void {
+
+				if (_fd == -1)
+					return;
+
+				const size_type first = out.size();
+
+				auto report = [&out, first](const std::string& path) -> void {
+					if (std::find(out.begin() + static_cast<std::ptrdiff_t>(first), out.end(), path) == out.end())
+						out.push_back(path);
+				};
+
+#if defined(__linux__)
+
+				alignas(struct inotify_event) char buffer[4096];
+
+				while (true) {
+
+					const ::ssize_t bytes = ::read(_fd, buffer, sizeof(buffer));
+
+					if (bytes <= 0)
+						break;
+
+					for (::ssize_t i = 0; i < bytes;) {
+
+						const auto* event = reinterpret_cast<const struct inotify_event*>(buffer + i);
+						i += static_cast<::ssize_t>(sizeof(struct inotify_event) + event->len);
+
+						if (event->len == 0U)
+							continue;
+
+						for (auto& f : _files)
+							if (f.dir == event->wd && f.name == event->name && self::stamp(f))
+								report(f.path);
+					}
+				}
+
+#elif defined(__APPLE__)
+
+				struct kevent events[32];
+				const struct timespec zero{0, 0};
+
+				while (true) {
+
+					const int count = ::kevent(_fd, nullptr, 0, events, 32, &zero);
+
+					if (count <= 0)
+						break;
+
+					for (int e = 0; e < count; ++e) {
+
+						const int id = static_cast<int>(events[e].ident);
+
+						// directory entry or file changed, compare stamps of the affected files
+						for (auto& f : _files) {
+							if (f.dir != id && f.fd != id)
+								continue;
+							const auto inode = f.st.st_ino;
+							if (not self::stamp(f))
+								continue;
+							// replaced file, follow the new inode
+							if (f.st.st_ino != inode)
+								self::add_file(f);
+							report(f.path);
+						}
+					}
+				}
+
+#endif
+			}
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* watched file */
+			struct file final {
+
+				/* full path */
+				std::string path;
+
+				/* name in directory */
+				std::string name;
+
+				/* directory watch id */
+				int dir;
+
+				/* file descriptor (kqueue only) */
+				int fd;
+
+				/* last seen modification */
+				struct ::stat st;
+			};
+
+			/* watched directory */
+			struct directory final {
+
+				/* path */
+				std::string path;
+
+				/* watch id (inotify watch or kqueue descriptor) */
+				int id;
+			};
+
+
+			// -- private methods ---------------------------------------------
+
+			/* refresh stat, true when size, time or inode changed */
+			static auto stamp(file& f) noexcept -> bool {
+
+				struct ::stat st{};
+
+				if (::stat(f.path.data(), &st) == -1)
+					return false;
+
+#if defined(__APPLE__)
+				const auto& now  = st.st_mtimespec;
+				const auto& then = f.st.st_mtimespec;
+#else
+				const auto& now  = st.st_mtim;
+				const auto& then = f.st.st_mtim;
+#endif
+				const bool changed = st.st_size != f.st.st_size || st.st_ino != f.st.st_ino
+								  || now.tv_sec != then.tv_sec || now.tv_nsec != then.tv_nsec;
+				f.st = st;
+				return changed;
+			}
+
+			/* watch directory, return watch id or -1 */
+			auto add_directory(const std::string& dir) noexcept -> int {
+#if defined(__linux__)
+				return ::inotify_add_watch(_fd, dir.data(), IN_CLOSE_WRITE | IN_MOVED_TO);
+#elif defined(__APPLE__)
+				const int fd = ::open(dir.data(), O_EVTONLY);
+				if (fd == -1)
+					return -1;
+				struct kevent change;
+				EV_SET(&change, static_cast<uintptr_t>(fd), EVFILT_VNODE, EV_ADD | EV_CLEAR, NOTE_WRITE, 0, nullptr);
+				if (::kevent(_fd, &change, 1, nullptr, 0, nullptr) == -1) {
+					::close(fd);
+					return -1;
+				}
+				return fd;
+#else
+				static_cast<void>(dir);
+				return -1;
+#endif
+			}
+
+#if defined(__APPLE__)
+			/* (re)watch file writes on its current inode (directory events catch renames) */
+			auto add_file(file& f) noexcept -> void {
+				if (f.fd != -1)
+					::close(f.fd);
+				f.fd = ::open(f.path.data(), O_EVTONLY);
+				if (f.fd == -1)
+					return;
+				struct kevent change;
+				EV_SET(&change, static_cast<uintptr_t>(f.fd), EVFILT_VNODE, EV_ADD | EV_CLEAR,
+					   NOTE_WRITE | NOTE_EXTEND | NOTE_DELETE | NOTE_RENAME, 0, nullptr);
+				::kevent(_fd, &change, 1, nullptr, 0, nullptr);
+			}
+#endif
+
+
+			// -- private members ---------------------------------------------
+
+			/* watched files */
+			std::vector<file> _files;
+
+			/* watched directories */
+			std::vector<directory> _dirs;
+
+			/* inotify or kqueue descriptor */
+			int _fd;
+
+	};
+
+}
+
+#endif // ENGINE_FILE_WATCHER_HPP
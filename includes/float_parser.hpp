@@ -0,0 +1,483 @@
+#ifndef ENGINE_FLOAT_PARSER_HPP
+#define ENGINE_FLOAT_PARSER_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- F L O A T  P A R S E R ----------------------------------------------
+
+	/* exactly rounded decimal to binary32 conversion
+
+	   up to 19 significant digits are packed in a 64-bit integer w, the value
+	   being w * 10^q, small cases go through an exact float product (clinger),
+	   the others through a 128-bit product with a truncated power of five
+	   (eisel-lemire), longer inputs that land between two floats are handed
+	   to strtof with at most 120 significant digits and a sticky digit */
+
+	class float_parser final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::float_parser;
+
+			/* size type */
+			using size_type = std::size_t;
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* non-instanciable class */
+			float_parser(void) = delete;
+
+
+			// -- public static methods ---------------------------------------
+
+			/* parse [sign] digits [. digits] [e [sign] digits] | inf | infinity | nan,
+			   advances it past the number on success, leaves it untouched otherwise */
+			static auto parse(const char*& it, const char* const end, float& value) noexcept -> bool {
+
+				const char* p = it;
+				bool negative = false;
+
+				if (p != end && (*p == '-' || *p == '+')) {
+					negative = (*p == '-');
+					++p;
+				}
+
+				if (p == end)
+					return false;
+
+				if (not self::is_digit(*p) && *p != '.')
+					return self::special(it, p, end, negative, value);
+
+				const char* const digits = p;
+
+				std::uint64_t w       = 0U;
+				std::int64_t exponent = 0;
+				size_type significant = 0U;
+				bool truncated        = false;
+				bool any              = false;
+
+				// integral part
+				for (; p != end && self::is_digit(*p); ++p, any = true) {
+					const auto d = static_cast<std::uint64_t>(*p ^ '0');
+					if (significant < MAX_DIGITS) {
+						w = (w * 10U) + d;
+						significant += (w != 0U);
+					}
+					else {
+						++exponent;
+						truncated |= (d != 0U);
+					}
+				}
+
+				// fractional part
+				if (p != end && *p == '.') {
+					for (++p; p != end && self::is_digit(*p); ++p, any = true) {
+						const auto d = static_cast<std::uint64_t>(*p ^ '0');
+						if (significant < MAX_DIGITS) {
+							w = (w * 10U) + d;
+							significant += (w != 0U);
+							--exponent;
+						}
+						else
+							truncated |= (d != 0U);
+					}
+				}
+
+				if (not any)
+					return false;
+
+				const char* const mantissa_end = p;
+				std::int64_t explicit_exponent = 0;
+
+				// exponent part (only consumed when well formed)
+				if (p != end && (*p == 'e' || *p == 'E')) {
+
+					const char* e = p + 1;
+					bool eneg = false;
+
+					if (e != end && (*e == '-' || *e == '+')) {
+						eneg = (*e == '-');
+						++e;
+					}
+
+					if (e != end && self::is_digit(*e)) {
+						for (; e != end && self::is_digit(*e); ++e) {
+							if (explicit_exponent < EXPONENT_LIMIT)
+								explicit_exponent = (explicit_exponent * 10) + (*e ^ '0');
+						}
+						explicit_exponent = eneg ? -explicit_exponent : explicit_exponent;
+						p = e;
+					}
+				}
+
+				exponent += explicit_exponent;
+				it = p;
+
+				// clinger: both operands exact, one rounding
+				if (not truncated && w <= (std::uint64_t{1U} << 24U) && exponent >= -10 && exponent <= 10) {
+					float result = static_cast<float>(w);
+					result = exponent < 0 ? result / self::exact_pow10(-exponent)
+										  : result * self::exact_pow10(+exponent);
+					value = negative ? -result : result;
+					return true;
+				}
+
+				std::uint32_t bits = self::compute(exponent, w);
+
+				// w and w + 1 bracket the truncated input
+				if (truncated && bits != self::compute(exponent, w + 1U)) {
+					value = self::fallback(digits, mantissa_end, explicit_exponent, negative);
+					return true;
+				}
+
+				bits |= static_cast<std::uint32_t>(negative) << 31U;
+				std::memcpy(&value, &bits, sizeof(float));
+				return true;
+			}
+
+			/* exactly rounded w * 10^q (w holding at most 19 digits) */
+			static auto compose(const std::uint64_t w, const std::int64_t q, const bool negative) noexcept -> float {
+				std::uint32_t bits = self::compute(q, w) | (static_cast<std::uint32_t>(negative) << 31U);
+				float value;
+				std::memcpy(&value, &bits, sizeof(float));
+				return value;
+			}
+
+
+		private:
+
+			// -- private constants -------------------------------------------
+
+			/* significant digits held in w */
+			enum : size_type { MAX_DIGITS = 19U };
+
+			/* significant digits kept for the slow path (binary32 needs 112) */
+			enum : size_type { SLOW_DIGITS = 120U };
+
+			/* explicit exponent clamp */
+			static constexpr std::int64_t EXPONENT_LIMIT = 0x10000;
+
+			/* binary32 layout */
+			static constexpr int MANTISSA_BITS = 23;
+			static constexpr int MIN_EXPONENT  = -127;
+			static constexpr int INF_EXPONENT  = 0xff;
+
+			/* decimal exponent range of the power table */
+			static constexpr std::int64_t SMALLEST_POWER = -65;
+			static constexpr std::int64_t LARGEST_POWER  = +38;
+
+			/* exponent range where a product can be exactly halfway */
+			static constexpr std::int64_t MIN_ROUND_TO_EVEN = -17;
+			static constexpr std::int64_t MAX_ROUND_TO_EVEN = +10;
+
+
+			// -- private static methods --------------------------------------
+
+			/* is digit */
+			static inline auto is_digit(const char c) noexcept -> bool {
+				return static_cast<unsigned char>(c ^ '0') < 10U;
+			}
+
+			/* ascii lower case */
+			static inline auto lower(const char c) noexcept -> char {
+				return static_cast<char>(c | 0x20);
+			}
+
+			/* case insensitive prefix match, advances p on success */
+			static inline auto match(const char*& p, const char* const end, const char* word) noexcept -> bool {
+				const char* q = p;
+				for (; *word != '\0'; ++word, ++q)
+					if (q == end || self::lower(*q) != *word)
+						return false;
+				p = q;
+				return true;
+			}
+
+			/* inf, infinity, nan, nan(chars) */
+			static auto special(const char*& it, const char* p, const char* const end,
+								const bool negative, float& value) noexcept -> bool {
+
+				if (self::match(p, end, "inf")) {
+					self::match(p, end, "inity");
+					value = negative ? -std::numeric_limits<float>::infinity()
+									 : +std::numeric_limits<float>::infinity();
+					it = p;
+					return true;
+				}
+
+				if (self::match(p, end, "nan")) {
+					// optional payload, ignored
+					if (p != end && *p == '(') {
+						const char* q = p + 1;
+						while (q != end && (self::is_digit(*q) || *q == '_'
+							|| static_cast<unsigned char>(self::lower(*q) - 'a') < 26U))
+							++q;
+						if (q != end && *q == ')')
+							p = q + 1;
+					}
+					value = negative ? -std::numeric_limits<float>::quiet_NaN()
+									 : +std::numeric_limits<float>::quiet_NaN();
+					it = p;
+					return true;
+				}
+
+				return false;
+			}
+
+			/* exact powers of ten in binary32 */
+			static inline auto exact_pow10(const std::int64_t exponent) noexcept -> float {
+				constexpr float table[] {
+					1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+				};
+				return table[exponent];
+			}
+
+			/* floor(log2(10^q)) + 63 */
+			static inline auto power(const std::int64_t q) noexcept -> std::int64_t {
+				return (((152170 + 65536) * q) >> 16) + 63;
+			}
+
+			/* binary32 bits of w * 10^q without sign */
+			static auto compute(const std::int64_t q, std::uint64_t w) noexcept -> std::uint32_t {
+
+				if (w == 0U || q < SMALLEST_POWER)
+					return 0U;
+
+				if (q > LARGEST_POWER)
+					return static_cast<std::uint32_t>(INF_EXPONENT) << MANTISSA_BITS;
+
+				const int lz = __builtin_clzll(w);
+				w <<= lz;
+
+				// 128-bit product, second word only when the first leaves doubt
+				const size_type index = static_cast<size_type>(q - SMALLEST_POWER) * 2U;
+				constexpr std::uint64_t precision = 0xffffffffffffffffULL >> (MANTISSA_BITS + 3);
+
+				unsigned __int128 product = static_cast<unsigned __int128>(w) * _powers[index];
+				std::uint64_t high = static_cast<std::uint64_t>(product >> 64U);
+				std::uint64_t low  = static_cast<std::uint64_t>(product);
+
+				if ((high & precision) == precision) {
+					const unsigned __int128 second = static_cast<unsigned __int128>(w) * _powers[index + 1U];
+					const auto carry = static_cast<std::uint64_t>(second >> 64U);
+					low += carry;
+					high += (carry > low);
+				}
+
+				const int upper = static_cast<int>(high >> 63U);
+				const int shift = upper + 64 - MANTISSA_BITS - 3;
+
+				std::uint64_t mantissa = high >> shift;
+				std::int64_t power2    = self::power(q) + upper - lz - MIN_EXPONENT;
+
+				// subnormal
+				if (power2 <= 0) {
+					if (-power2 + 1 >= 64)
+						return 0U;
+					mantissa >>= -power2 + 1;
+					mantissa += (mantissa & 1U);
+					mantissa >>= 1U;
+					power2 = (mantissa < (std::uint64_t{1U} << MANTISSA_BITS)) ? 0 : 1;
+					return static_cast<std::uint32_t>(mantissa & ((std::uint64_t{1U} << MANTISSA_BITS) - 1U))
+						 | static_cast<std::uint32_t>(power2 << MANTISSA_BITS);
+				}
+
+				// exactly halfway, round to even
+				if (low <= 1U && q >= MIN_ROUND_TO_EVEN && q <= MAX_ROUND_TO_EVEN
+					&& (mantissa & 3U) == 1U && (mantissa << shift) == high)
+					mantissa &= ~std::uint64_t{1U};
+
+				mantissa += (mantissa & 1U);
+				mantissa >>= 1U;
+
+				if (mantissa >= (std::uint64_t{2U} << MANTISSA_BITS)) {
+					mantissa = std::uint64_t{1U} << MANTISSA_BITS;
+					++power2;
+				}
+
+				mantissa &= ~(std::uint64_t{1U} << MANTISSA_BITS);
+
+				if (power2 >= INF_EXPONENT)
+					return static_cast<std::uint32_t>(INF_EXPONENT) << MANTISSA_BITS;
+
+				return static_cast<std::uint32_t>(mantissa)
+					 | static_cast<std::uint32_t>(power2 << MANTISSA_BITS);
+			}
+
+			/* strtof on a bounded copy: digits as an integer, sticky digit, exponent */
+			static auto fallback(const char* p, const char* const end,
+								 std::int64_t exponent, const bool negative) noexcept -> float {
+
+				char buffer[SLOW_DIGITS + 32U];
+				size_type n      = 0U;
+				size_type digits = 0U;
+				bool point       = false;
+				bool sticky      = false;
+
+				if (negative)
+					buffer[n++] = '-';
+
+				for (; p != end; ++p) {
+					if (*p == '.') {
+						point = true;
+						continue;
+					}
+					if (digits == 0U && *p == '0') {
+						exponent -= point;
+						continue;
+					}
+					if (digits < SLOW_DIGITS) {
+						buffer[n++] = *p;
+						++digits;
+						exponent -= point;
+					}
+					else {
+						exponent += not point;
+						sticky   |= (*p != '0');
+					}
+				}
+
+				if (digits == 0U)
+					return negative ? -0.0f : 0.0f;
+
+				if (sticky) {
+					buffer[n++] = '1';
+					--exponent;
+				}
+
+				std::snprintf(buffer + n, sizeof(buffer) - n, "e%lld", static_cast<long long>(exponent));
+				return std::strtof(buffer, nullptr);
+			}
+
+
+			// -- private static members --------------------------------------
+
+			/* 128-bit truncated powers of five, normalized, 1e-65 to 1e38 */
+			static constexpr std::uint64_t _powers[] {
+				0x86ccbb52ea94baeaULL, 0x98e947129fc2b4e9ULL, // 1e-65
+				0xa87fea27a539e9a5ULL, 0x3f2398d747b36224ULL, // 1e-64
+				0xd29fe4b18e88640eULL, 0x8eec7f0d19a03aadULL, // 1e-63
+				0x83a3eeeef9153e89ULL, 0x1953cf68300424acULL, // 1e-62
+				0xa48ceaaab75a8e2bULL, 0x5fa8c3423c052dd7ULL, // 1e-61
+				0xcdb02555653131b6ULL, 0x3792f412cb06794dULL, // 1e-60
+				0x808e17555f3ebf11ULL, 0xe2bbd88bbee40bd0ULL, // 1e-59
+				0xa0b19d2ab70e6ed6ULL, 0x5b6aceaeae9d0ec4ULL, // 1e-58
+				0xc8de047564d20a8bULL, 0xf245825a5a445275ULL, // 1e-57
+				0xfb158592be068d2eULL, 0xeed6e2f0f0d56712ULL, // 1e-56
+				0x9ced737bb6c4183dULL, 0x55464dd69685606bULL, // 1e-55
+				0xc428d05aa4751e4cULL, 0xaa97e14c3c26b886ULL, // 1e-54
+				0xf53304714d9265dfULL, 0xd53dd99f4b3066a8ULL, // 1e-53
+				0x993fe2c6d07b7fabULL, 0xe546a8038efe4029ULL, // 1e-52
+				0xbf8fdb78849a5f96ULL, 0xde98520472bdd033ULL, // 1e-51
+				0xef73d256a5c0f77cULL, 0x963e66858f6d4440ULL, // 1e-50
+				0x95a8637627989aadULL, 0xdde7001379a44aa8ULL, // 1e-49
+				0xbb127c53b17ec159ULL, 0x5560c018580d5d52ULL, // 1e-48
+				0xe9d71b689dde71afULL, 0xaab8f01e6e10b4a6ULL, // 1e-47
+				0x9226712162ab070dULL, 0xcab3961304ca70e8ULL, // 1e-46
+				0xb6b00d69bb55c8d1ULL, 0x3d607b97c5fd0d22ULL, // 1e-45
+				0xe45c10c42a2b3b05ULL, 0x8cb89a7db77c506aULL, // 1e-44
+				0x8eb98a7a9a5b04e3ULL, 0x77f3608e92adb242ULL, // 1e-43
+				0xb267ed1940f1c61cULL, 0x55f038b237591ed3ULL, // 1e-42
+				0xdf01e85f912e37a3ULL, 0x6b6c46dec52f6688ULL, // 1e-41
+				0x8b61313bbabce2c6ULL, 0x2323ac4b3b3da015ULL, // 1e-40
+				0xae397d8aa96c1b77ULL, 0xabec975e0a0d081aULL, // 1e-39
+				0xd9c7dced53c72255ULL, 0x96e7bd358c904a21ULL, // 1e-38
+				0x881cea14545c7575ULL, 0x7e50d64177da2e54ULL, // 1e-37
+				0xaa242499697392d2ULL, 0xdde50bd1d5d0b9e9ULL, // 1e-36
+				0xd4ad2dbfc3d07787ULL, 0x955e4ec64b44e864ULL, // 1e-35
+				0x84ec3c97da624ab4ULL, 0xbd5af13bef0b113eULL, // 1e-34
+				0xa6274bbdd0fadd61ULL, 0xecb1ad8aeacdd58eULL, // 1e-33
+				0xcfb11ead453994baULL, 0x67de18eda5814af2ULL, // 1e-32
+				0x81ceb32c4b43fcf4ULL, 0x80eacf948770ced7ULL, // 1e-31
+				0xa2425ff75e14fc31ULL, 0xa1258379a94d028dULL, // 1e-30
+				0xcad2f7f5359a3b3eULL, 0x096ee45813a04330ULL, // 1e-29
+				0xfd87b5f28300ca0dULL, 0x8bca9d6e188853fcULL, // 1e-28
+				0x9e74d1b791e07e48ULL, 0x775ea264cf55347eULL, // 1e-27
+				0xc612062576589ddaULL, 0x95364afe032a819eULL, // 1e-26
+				0xf79687aed3eec551ULL, 0x3a83ddbd83f52205ULL, // 1e-25
+				0x9abe14cd44753b52ULL, 0xc4926a9672793543ULL, // 1e-24
+				0xc16d9a0095928a27ULL, 0x75b7053c0f178294ULL, // 1e-23
+				0xf1c90080baf72cb1ULL, 0x5324c68b12dd6339ULL, // 1e-22
+				0x971da05074da7beeULL, 0xd3f6fc16ebca5e04ULL, // 1e-21
+				0xbce5086492111aeaULL, 0x88f4bb1ca6bcf585ULL, // 1e-20
+				0xec1e4a7db69561a5ULL, 0x2b31e9e3d06c32e6ULL, // 1e-19
+				0x9392ee8e921d5d07ULL, 0x3aff322e62439fd0ULL, // 1e-18
+				0xb877aa3236a4b449ULL, 0x09befeb9fad487c3ULL, // 1e-17
+				0xe69594bec44de15bULL, 0x4c2ebe687989a9b4ULL, // 1e-16
+				0x901d7cf73ab0acd9ULL, 0x0f9d37014bf60a11ULL, // 1e-15
+				0xb424dc35095cd80fULL, 0x538484c19ef38c95ULL, // 1e-14
+				0xe12e13424bb40e13ULL, 0x2865a5f206b06fbaULL, // 1e-13
+				0x8cbccc096f5088cbULL, 0xf93f87b7442e45d4ULL, // 1e-12
+				0xafebff0bcb24aafeULL, 0xf78f69a51539d749ULL, // 1e-11
+				0xdbe6fecebdedd5beULL, 0xb573440e5a884d1cULL, // 1e-10
+				0x89705f4136b4a597ULL, 0x31680a88f8953031ULL, // 1e-9
+				0xabcc77118461cefcULL, 0xfdc20d2b36ba7c3eULL, // 1e-8
+				0xd6bf94d5e57a42bcULL, 0x3d32907604691b4dULL, // 1e-7
+				0x8637bd05af6c69b5ULL, 0xa63f9a49c2c1b110ULL, // 1e-6
+				0xa7c5ac471b478423ULL, 0x0fcf80dc33721d54ULL, // 1e-5
+				0xd1b71758e219652bULL, 0xd3c36113404ea4a9ULL, // 1e-4
+				0x83126e978d4fdf3bULL, 0x645a1cac083126eaULL, // 1e-3
+				0xa3d70a3d70a3d70aULL, 0x3d70a3d70a3d70a4ULL, // 1e-2
+				0xccccccccccccccccULL, 0xcccccccccccccccdULL, // 1e-1
+				0x8000000000000000ULL, 0x0000000000000000ULL, // 1e0
+				0xa000000000000000ULL, 0x0000000000000000ULL, // 1e1
+				0xc800000000000000ULL, 0x0000000000000000ULL, // 1e2
+				0xfa00000000000000ULL, 0x0000000000000000ULL, // 1e3
+				0x9c40000000000000ULL, 0x0000000000000000ULL, // 1e4
+				0xc350000000000000ULL, 0x0000000000000000ULL, // 1e5
+				0xf424000000000000ULL, 0x0000000000000000ULL, // 1e6
+				0x9896800000000000ULL, 0x0000000000000000ULL, // 1e7
+				0xbebc200000000000ULL, 0x0000000000000000ULL, // 1e8
+				0xee6b280000000000ULL, 0x0000000000000000ULL, // 1e9
+				0x9502f90000000000ULL, 0x0000000000000000ULL, // 1e10
+				0xba43b74000000000ULL, 0x0000000000000000ULL, // 1e11
+				0xe8d4a51000000000ULL, 0x0000000000000000ULL, // 1e12
+				0x9184e72a00000000ULL, 0x0000000000000000ULL, // 1e13
+				0xb5e620f480000000ULL, 0x0000000000000000ULL, // 1e14
+				0xe35fa931a0000000ULL, 0x0000000000000000ULL, // 1e15
+				0x8e1bc9bf04000000ULL, 0x0000000000000000ULL, // 1e16
+				0xb1a2bc2ec5000000ULL, 0x0000000000000000ULL, // 1e17
+				0xde0b6b3a76400000ULL, 0x0000000000000000ULL, // 1e18
+				0x8ac7230489e80000ULL, 0x0000000000000000ULL, // 1e19
+				0xad78ebc5ac620000ULL, 0x0000000000000000ULL, // 1e20
+				0xd8d726b7177a8000ULL, 0x0000000000000000ULL, // 1e21
+				0x878678326eac9000ULL, 0x0000000000000000ULL, // 1e22
+				0xa968163f0a57b400ULL, 0x0000000000000000ULL, // 1e23
+				0xd3c21bcecceda100ULL, 0x0000000000000000ULL, // 1e24
+				0x84595161401484a0ULL, 0x0000000000000000ULL, // 1e25
+				0xa56fa5b99019a5c8ULL, 0x0000000000000000ULL, // 1e26
+				0xcecb8f27f4200f3aULL, 0x0000000000000000ULL, // 1e27
+				0x813f3978f8940984ULL, 0x4000000000000000ULL, // 1e28
+				0xa18f07d736b90be5ULL, 0x5000000000000000ULL, // 1e29
+				0xc9f2c9cd04674edeULL, 0xa400000000000000ULL, // 1e30
+				0xfc6f7c4045812296ULL, 0x4d00000000000000ULL, // 1e31
+				0x9dc5ada82b70b59dULL, 0xf020000000000000ULL, // 1e32
+				0xc5371912364ce305ULL, 0x6c28000000000000ULL, // 1e33
+				0xf684df56c3e01bc6ULL, 0xc732000000000000ULL, // 1e34
+				0x9a130b963a6c115cULL, 0x3c7f400000000000ULL, // 1e35
+				0xc097ce7bc90715b3ULL, 0x4b9f100000000000ULL, // 1e36
+				0xf0bdc21abb48db20ULL, 0x1e86d40000000000ULL, // 1e37
+				0x96769950b50d88f4ULL, 0x1314448000000000ULL, // 1e38
+			};
+
+	};
+
+}
+
+#endif // ENGINE_FLOAT_PARSER_HPP
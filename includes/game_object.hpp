@@ -3,8 +3,10 @@
 
 
 #include "mesh.hpp"
+#include "cluster_culling.hpp"
+#include "material.hpp"
 #include "options.hpp"
-#include "matrix.hpp"
+#include "transform.hpp"
 #include "mtl_render_command_encoder.hpp"
 
 
@@ -14,144 +16,6 @@ namespace engine {
 
 
 
-	// -- T R A N S F O R M  C O M P O N E N T --------------------------------
-
-	class transform final {
-
-		public:
-
-			// -- public type -------------------------------------------------
-
-			/* self type */
-			using self = engine::transform;
-
-
-			// -- public lifecycle --------------------------------------------
-
-			/* default constructor */
-			inline transform(void) noexcept
-			: _position{0.0f, 0.0f, 0.0f},
-			  _rotation{0.0f, 0.0f, 0.0f},
-				 _scale{1.0f, 1.0f, 1.0f} {}
-
-			/* copy constructor */
-			inline transform(const self& other) noexcept
-			: _position{other._position}, _rotation{other._rotation}, _scale{other._scale} {}
-
-			/* move constructor */
-			inline transform(transform&& other) noexcept
-			: transform{other} {}
-
-			/* destructor */
-			inline ~transform(void) noexcept = default;
-
-
-			// -- public assignment operators ---------------------------------
-
-			/* copy assignment operator */
-			inline auto operator=(const self& other) noexcept -> self& {
-				_position = other._position;
-				_rotation = other._rotation;
-				   _scale = other._scale;
-				return *this;
-			}
-
-			/* move assignment operator */
-			inline auto operator=(self&& other) noexcept -> self& {
-				return self::operator=(other);
-			}
-
-
-			// -- public accessors --------------------------------------------
-
-			/* position */
-			inline auto position(void) noexcept -> simd::float3& {
-				return _position;
-			}
-
-			/* const position */
-			inline auto position(void) const noexcept -> const simd::float3& {
-				return _position;
-			}
-
-			/* rotation */
-			inline auto rotation(void) noexcept -> simd::float3& {
-				return _rotation;
-			}
-
-			/* const rotation */
-			inline auto rotation(void) const noexcept -> const simd::float3& {
-				return _rotation;
-			}
-
-			/* scale */
-			inline auto scale(void) noexcept -> simd::float3& {
-				return _scale;
-			}
-
-			/* const scale */
-			inline auto scale(void) const noexcept -> const simd::float3& {
-				return _scale;
-			}
-
-
-			// -- public modifiers --------------------------------------------
-
-			/* scale */
-			inline auto scale(const float x, const float y, const float z) noexcept -> void {
-				_scale = simd::float3{x, y, z};
-			}
-
-			/* scale */
-			inline auto scale(const float factor) noexcept -> void {
-				_scale = simd::float3{factor, factor, factor};
-			}
-
-
-			// -- public methods ----------------------------------------------
-
-			/* update */
-			inline auto update(void) noexcept -> void {
-				    _matrix.reset();
-				_matrix.translate(_position);
-				   _matrix.rotate(_rotation);
-				    _matrix.scale(_scale);
-			}
-
-			/* update from parent */
-			inline auto update(const self& parent) noexcept -> void {
-				    _matrix.reset();
-					_matrix = parent._matrix;
-				_matrix.translate(_position);
-				   _matrix.rotate(_rotation);
-				    _matrix.scale(_scale);
-			}
-
-			/* render */
-			inline auto render(mtl::render_command_encoder& encoder) const noexcept -> void {
-				encoder.set_vertex_bytes(&(_matrix.get()), sizeof(_matrix), 3);
-			}
-
-
-		private:
-
-			// -- private members ---------------------------------------------
-
-			/* position */
-			simd::float3 _position;
-
-			/* rotation */
-			simd::float3 _rotation;
-
-			/* scale */
-			simd::float3 _scale;
-
-			/* matrix */
-			engine::matrix _matrix;
-
-	};
-
-
 	// -- P H Y S I C S  C O M P O N E N T ------------------------------------
 
 	class physics final {
@@ -163,90 +27,6 @@ namespace engine {
 	};
 
 
-	// -- M A T E R I A L  C O M P O N E N T ----------------------------------
-
-	class material final {
-
-		public:
-
-			// -- public type -------------------------------------------------
-
-			/* self type */
-			using self = engine::material;
-
-
-			// -- public lifecycle --------------------------------------------
-
-			/* default constructor */
-			inline material(void) noexcept
-			: _color{1.0f, 1.0f, 1.0f, 1.0f} {}
-
-			/* copy constructor */
-			inline material(const self& other) noexcept
-			: _color{other._color} {}
-
-			/* move constructor */
-			inline material(self&& other) noexcept
-			: material{other} {}
-
-			/* destructor */
-			inline ~material(void) noexcept = default;
-
-
-			// -- public assignment operators ---------------------------------
-
-			/* copy assignment operator */
-			inline auto operator=(const self& other) noexcept -> self& {
-				_color = other._color;
-				return *this;
-			}
-
-			/* move assignment operator */
-			inline auto operator=(self&& other) noexcept -> self& {
-				return self::operator=(other);
-			}
-
-
-			// -- public accessors --------------------------------------------
-
-			/* color */
-			inline auto color(void) noexcept -> simd::float4& {
-				return _color;
-			}
-
-
-			// -- public modifiers --------------------------------------------
-
-			/* color */
-			inline auto color(const float r, const float g, const float b, const float a) noexcept -> void {
-				_color = simd::float4{r, g, b, a};
-			}
-
-			/* color */
-			inline auto color(const float r, const float g, const float b) noexcept -> void {
-				_color = simd::float4{r, g, b, 1.0f};
-			}
-
-
-			// -- public methods ----------------------------------------------
-
-			/* render */
-			inline auto render(mtl::render_command_encoder& encoder) const noexcept -> void {
-				encoder.set_fragment_bytes(&_color, sizeof(_color), 1);
-			}
-
-
-		private:
-
-			// -- private members ---------------------------------------------
-
-			/* color */
-			simd::float4 _color;
-
-	};
-
-
-
 	// -- G A M E  O B J E C T ------------------------------------------------
 
 	class game_object final {
@@ -280,15 +60,25 @@ namespace engine {
 
 			/* render */
 			inline auto render(mtl::render_command_encoder& encoder) const noexcept -> void {
-				_material.render(encoder);
 				_transform.render(encoder);
-					 _mesh->render(encoder, _opts);
+				// own material for submeshes without one
+					 _mesh->render(encoder, _opts, _material);
 
 				for (auto& child : _children) {
 					child->render(encoder);
 				}
 			}
 
+			/* render, meshlets culled against the frame camera */
+			inline auto render(mtl::render_command_encoder& encoder, engine::cluster_culling& culling) const noexcept -> void {
+				_transform.render(encoder);
+				_mesh->render(encoder, _opts, _material, culling, _transform.matrix());
+
+				for (auto& child : _children) {
+					child->render(encoder, culling);
+				}
+			}
+
 			/* set mesh */
 			inline auto set_mesh(engine::mesh& mesh) noexcept -> void {
 				_mesh = &mesh;
@@ -0,0 +1,151 @@
+#ifndef ENGINE_HASH_HPP
+#define ENGINE_HASH_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- H A S H -------------------------------------------------------------
+
+	/* 64-bit content hash (xxh64 rounds, four independent lanes),
+	   used to tie cooked assets to the bytes they were built from */
+
+	class hash final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::hash;
+
+			/* size type */
+			using size_type = std::size_t;
+
+			/* value type */
+			using value_type = std::uint64_t;
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* non-instanciable class */
+			hash(void) = delete;
+
+
+			// -- public static methods ---------------------------------------
+
+			/* hash bytes */
+			static auto compute(const void* data, const size_type size, const value_type seed = 0U) noexcept -> value_type {
+
+				const auto* p   = static_cast<const unsigned char*>(data);
+				const auto* end = p + size;
+
+				value_type h;
+
+				if (size >= 32U) {
+
+					value_type v1 = seed + P1 + P2;
+					value_type v2 = seed + P2;
+					value_type v3 = seed;
+					value_type v4 = seed - P1;
+
+					for (; (end - p) >= 32; p += 32) {
+						v1 = self::round(v1, self::read64(p));
+						v2 = self::round(v2, self::read64(p + 8));
+						v3 = self::round(v3, self::read64(p + 16));
+						v4 = self::round(v4, self::read64(p + 24));
+					}
+
+					h = self::rotl(v1, 1) + self::rotl(v2, 7) + self::rotl(v3, 12) + self::rotl(v4, 18);
+					h = self::merge(h, v1);
+					h = self::merge(h, v2);
+					h = self::merge(h, v3);
+					h = self::merge(h, v4);
+				}
+				else
+					h = seed + P5;
+
+				h += static_cast<value_type>(size);
+
+				for (; (end - p) >= 8; p += 8) {
+					h ^= self::round(0U, self::read64(p));
+					h  = (self::rotl(h, 27) * P1) + P4;
+				}
+
+				if ((end - p) >= 4) {
+					h ^= static_cast<value_type>(self::read32(p)) * P1;
+					h  = (self::rotl(h, 23) * P2) + P3;
+					p += 4;
+				}
+
+				for (; p != end; ++p) {
+					h ^= static_cast<value_type>(*p) * P5;
+					h  = self::rotl(h, 11) * P1;
+				}
+
+				// avalanche
+				h ^= h >> 33;
+				h *= P2;
+				h ^= h >> 29;
+				h *= P3;
+				h ^= h >> 32;
+				return h;
+			}
+
+
+		private:
+
+			// -- private constants -------------------------------------------
+
+			static constexpr value_type P1 = 0x9e3779b185ebca87ULL;
+			static constexpr value_type P2 = 0xc2b2ae3d27d4eb4fULL;
+			static constexpr value_type P3 = 0x165667b19e3779f9ULL;
+			static constexpr value_type P4 = 0x85ebca77c2b2ae63ULL;
+			static constexpr value_type P5 = 0x27d4eb2f165667c5ULL;
+
+
+			// -- private static methods --------------------------------------
+
+			/* rotate left */
+			static inline auto rotl(const value_type x, const int r) noexcept -> value_type {
+				return (x << r) | (x >> (64 - r));
+			}
+
+			/* lane round */
+			static inline auto round(value_type acc, const value_type lane) noexcept -> value_type {
+				acc += lane * P2;
+				acc  = self::rotl(acc, 31);
+				return acc * P1;
+			}
+
+			/* merge lane */
+			static inline auto merge(value_type h, const value_type v) noexcept -> value_type {
+				h ^= self::round(0U, v);
+				return (h * P1) + P4;
+			}
+
+			/* unaligned loads */
+			static inline auto read64(const unsigned char* p) noexcept -> value_type {
+				value_type v;
+				std::memcpy(&v, p, sizeof(v));
+				return v;
+			}
+
+			static inline auto read32(const unsigned char* p) noexcept -> std::uint32_t {
+				std::uint32_t v;
+				std::memcpy(&v, p, sizeof(v));
+				return v;
+			}
+
+	};
+
+}
+
+#endif // ENGINE_HASH_HPP
@@ -0,0 +1,313 @@
+#ifndef ENGINE_IO_RING_HPP
+#define ENGINE_IO_RING_HPP
+
+#include <unistd.h>
+#include <cerrno>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <xns>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#	include <linux/io_uring.h>
+#	include <sys/mman.h>
+#	include <sys/syscall.h>
+	// linux/fs.h leaks these into every includer
+#	undef BLOCK_SIZE
+#	undef BLOCK_SIZE_BITS
+#	if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#		define ENGINE_IO_URING 1
+#	endif
+#endif
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- I O  R I N G --------------------------------------------------------
+
+	/* batched file reads, submitted through io_uring on linux (raw syscalls,
+	   no liburing), read synchronously with pread elsewhere or when the
+	   kernel refuses the ring */
+
+	class io_ring final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::io_ring;
+
+			/* size type */
+			using size_type = std::size_t;
+
+
+			// -- C O M P L E T I O N -----------------------------------------
+
+			struct completion final {
+
+				/* user tag */
+				void* tag;
+
+				/* bytes read, or -errno */
+				std::int64_t result;
+			};
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* entries constructor (power of two, falls back to pread on failure) */
+			explicit inline io_ring(const unsigned entries = 64U) noexcept
+			: _capacity{entries}, _pending{0U}, _ready{}
+#if defined(ENGINE_IO_URING)
+			, _fd{-1}, _sq{nullptr}, _sq_size{0U}, _cq{nullptr}, _cq_size{0U}, _sqes{nullptr}, _sqes_size{0U},
+			  _sq_head{nullptr}, _sq_tail{nullptr}, _sq_mask{nullptr}, _sq_array{nullptr},
+			  _cq_head{nullptr}, _cq_tail{nullptr}, _cq_mask{nullptr}, _cqes{nullptr}, _unsubmitted{0U}
+#endif
+			{
+#if defined(ENGINE_IO_URING)
+				self::setup(entries);
+#endif
+			}
+
+			/* non-assignable class */
+			non_assignable(io_ring);
+
+			/* destructor */
+			inline ~io_ring(void) noexcept {
+#if defined(ENGINE_IO_URING)
+				self::teardown();
+#endif
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* kernel ring in use */
+			inline auto uring(void) const noexcept -> bool {
+#if defined(ENGINE_IO_URING)
+				return _fd != -1;
+#else
+				return false;
+#endif
+			}
+
+			/* reads in flight or completed but not yet reaped */
+			inline auto pending(void) const noexcept -> size_type {
+				return _pending;
+			}
+
+			/* room for another read */
+			inline auto full(void) const noexcept -> bool {
+				return _pending >= _capacity;
+			}
+
+
+			// -- public modifiers --------------------------------------------
+
+			/* queue read of size bytes at offset (false when full) */
+			auto read(const int fd, void* buffer, const size_type size,
+					  const std::uint64_t offset, void* tag) noexcept -> bool {
+
+				if (self::full())
+					return false;
+
+				++_pending;
+
+#if defined(ENGINE_IO_URING)
+				if (_fd != -1) {
+
+					const unsigned tail = std::atomic_ref<unsigned>{*_sq_tail}.load(std::memory_order_relaxed);
+					const unsigned index = tail & *_sq_mask;
+
+					struct io_uring_sqe& sqe = _sqes[index];
+					sqe = io_uring_sqe{};
+					sqe.opcode    = IORING_OP_READ;
+					sqe.fd        = fd;
+					sqe.addr      = reinterpret_cast<std::uint64_t>(buffer);
+					sqe.len       = static_cast<std::uint32_t>(size < MAX_READ ? size : MAX_READ);
+					sqe.off       = offset;
+					sqe.user_data = reinterpret_cast<std::uint64_t>(tag);
+
+					_sq_array[index] = index;
+					std::atomic_ref<unsigned>{*_sq_tail}.store(tail + 1U, std::memory_order_release);
+					++_unsubmitted;
+					return true;
+				}
+#endif
+				const ::ssize_t bytes = ::pread(fd, buffer, size < MAX_READ ? size : MAX_READ,
+												static_cast<::off_t>(offset));
+				_ready.push_back(completion{tag, bytes < 0 ? -static_cast<std::int64_t>(errno) : bytes});
+				return true;
+			}
+
+			/* submit queued reads, wait for at least one completion, append them to out */
+			auto wait(std::vector<completion>& out) noexcept -> void {
+
+				if (_pending == 0U)
+					return;
+
+#if defined(ENGINE_IO_URING)
+				if (_fd != -1) {
+
+					while (true) {
+
+						const long r = ::syscall(__NR_io_uring_enter, _fd, _unsubmitted, 1U,
+												 IORING_ENTER_GETEVENTS, nullptr, 0U);
+						if (r >= 0) {
+							_unsubmitted -= static_cast<unsigned>(r);
+							break;
+						}
+						if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+							break;
+					}
+
+					unsigned head = std::atomic_ref<unsigned>{*_cq_head}.load(std::memory_order_relaxed);
+					const unsigned tail = std::atomic_ref<unsigned>{*_cq_tail}.load(std::memory_order_acquire);
+
+					for (; head != tail; ++head) {
+						const struct io_uring_cqe& cqe = _cqes[head & *_cq_mask];
+						out.push_back(completion{reinterpret_cast<void*>(cqe.user_data), cqe.res});
+						--_pending;
+					}
+
+					std::atomic_ref<unsigned>{*_cq_head}.store(head, std::memory_order_release);
+					return;
+				}
+#endif
+				_pending -= _ready.size();
+				out.insert(out.end(), _ready.begin(), _ready.end());
+				_ready.clear();
+			}
+
+
+		private:
+
+			// -- private constants -------------------------------------------
+
+			/* largest single read (the kernel caps a read at 2 GiB) */
+			static constexpr size_type MAX_READ = 1U << 30U;
+
+
+#if defined(ENGINE_IO_URING)
+
+			// -- private methods ---------------------------------------------
+
+			/* create and map the rings, leaves _fd at -1 on failure */
+			auto setup(const unsigned entries) noexcept -> void {
+
+				struct io_uring_params params{};
+
+				const long fd = ::syscall(__NR_io_uring_setup, entries, &params);
+
+				if (fd < 0)
+					return;
+
+				_fd = static_cast<int>(fd);
+
+				_sq_size   = params.sq_off.array + (params.sq_entries * sizeof(unsigned));
+				_cq_size   = params.cq_off.cqes  + (params.cq_entries * sizeof(struct io_uring_cqe));
+				_sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+
+				_sq   = ::mmap(nullptr, _sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, IORING_OFF_SQ_RING);
+				_cq   = ::mmap(nullptr, _cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, IORING_OFF_CQ_RING);
+				void* sqes = ::mmap(nullptr, _sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, IORING_OFF_SQES);
+
+				if (_sq == MAP_FAILED || _cq == MAP_FAILED || sqes == MAP_FAILED) {
+					_sqes = (sqes == MAP_FAILED) ? nullptr : static_cast<struct io_uring_sqe*>(sqes);
+					self::teardown();
+					return;
+				}
+
+				auto* sq = static_cast<char*>(_sq);
+				auto* cq = static_cast<char*>(_cq);
+
+				_sq_head  = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+				_sq_tail  = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+				_sq_mask  = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+				_sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+				_cq_head  = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+				_cq_tail  = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+				_cq_mask  = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+				_cqes     = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+				_sqes     = static_cast<struct io_uring_sqe*>(sqes);
+
+				// the completion ring holds at least as many entries as the submission ring
+				_capacity = params.sq_entries;
+			}
+
+			/* unmap the rings and close */
+			auto teardown(void) noexcept -> void {
+				if (_sq != nullptr && _sq != MAP_FAILED)
+					::munmap(_sq, _sq_size);
+				if (_cq != nullptr && _cq != MAP_FAILED)
+					::munmap(_cq, _cq_size);
+				if (_sqes != nullptr)
+					::munmap(_sqes, _sqes_size);
+				if (_fd != -1)
+					::close(_fd);
+				_sq = _cq = nullptr;
+				_sqes = nullptr;
+				_fd = -1;
+			}
+
+#endif
+
+
+			// -- private members ---------------------------------------------
+
+			/* maximum reads in flight */
+			size_type _capacity;
+
+			/* reads in flight */
+			size_type _pending;
+
+			/* pread completions */
+			std::vector<completion> _ready;
+
+#if defined(ENGINE_IO_URING)
+
+			/* ring descriptor */
+			int _fd;
+
+			/* submission ring mapping */
+			void* _sq;
+			size_type _sq_size;
+
+			/* completion ring mapping */
+			void* _cq;
+			size_type _cq_size;
+
+			/* submission entries */
+			struct io_uring_sqe* _sqes;
+			size_type _sqes_size;
+
+			/* submission ring fields */
+			unsigned* _sq_head;
+			unsigned* _sq_tail;
+			unsigned* _sq_mask;
+			unsigned* _sq_array;
+
+			/* completion ring fields */
+			unsigned* _cq_head;
+			unsigned* _cq_tail;
+			unsigned* _cq_mask;
+			struct io_uring_cqe* _cqes;
+
+			/* entries queued since the last enter */
+			unsigned _unsubmitted;
+
+#endif
+
+	};
+
+}
+
+#endif // ENGINE_IO_RING_HPP
@@ -0,0 +1,186 @@
+#ifndef ENGINE_MAPPED_FILE_HPP
+#define ENGINE_MAPPED_FILE_HPP
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include <cstddef>
+
+#include <xns>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- M A P P E D  F I L E ------------------------------------------------
+
+	/* read-only memory mapping of a whole file,
+	   the descriptor is closed right after mapping */
+
+	class mapped_file final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self       = engine::mapped_file;
+
+			/* size type */
+			using size_type  = std::size_t;
+
+			/* value type */
+			using value_type = char;
+
+			/* const pointer type */
+			using const_pointer = const value_type*;
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* default constructor */
+			inline mapped_file(void) noexcept
+			: _data{nullptr}, _size{0U} {}
+
+			/* path constructor */
+			inline mapped_file(const char* path) noexcept
+			: _data{nullptr}, _size{0U} {
+
+				const int fd = ::open(path, O_RDONLY);
+
+				if (fd == -1)
+					return;
+
+				struct ::stat st;
+
+				if (::fstat(fd, &st) == -1) {
+					::close(fd);
+					return;
+				}
+
+				_size = static_cast<size_type>(st.st_size);
+
+				// empty file, nothing to map
+				if (_size == 0U) {
+					_data = _empty;
+					::close(fd);
+					return;
+				}
+
+				void* addr = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+				// mapping keeps its own reference
+				::close(fd);
+
+				if (addr == MAP_FAILED) {
+					_size = 0U;
+					return;
+				}
+
+				// hint kernel for read-ahead
+				::madvise(addr, _size, MADV_SEQUENTIAL);
+
+				_data = static_cast<const_pointer>(addr);
+			}
+
+			/* non-copyable class */
+			non_copyable(mapped_file);
+
+			/* move constructor */
+			inline mapped_file(self&& other) noexcept
+			: _data{other._data}, _size{other._size} {
+				other._data = nullptr;
+				other._size = 0U;
+			}
+
+			/* destructor */
+			inline ~mapped_file(void) noexcept {
+				self::unmap();
+			}
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* move assignment operator */
+			inline auto operator=(self&& other) noexcept -> self& {
+				if (this == &other) return *this;
+				self::unmap();
+				_data = other._data;
+				_size = other._size;
+				other._data = nullptr;
+				other._size = 0U;
+				return *this;
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* data */
+			inline auto data(void) const noexcept -> const_pointer {
+				return _data;
+			}
+
+			/* size */
+			inline auto size(void) const noexcept -> size_type {
+				return _size;
+			}
+
+			/* begin */
+			inline auto begin(void) const noexcept -> const_pointer {
+				return _data;
+			}
+
+			/* end */
+			inline auto end(void) const noexcept -> const_pointer {
+				return _data + _size;
+			}
+
+
+			// -- public boolean operators ------------------------------------
+
+			/* boolean operator */
+			explicit inline operator bool(void) const noexcept {
+				return _data != nullptr;
+			}
+
+			/* not operator */
+			inline auto operator!(void) const noexcept -> bool {
+				return _data == nullptr;
+			}
+
+
+		private:
+
+			// -- private methods ---------------------------------------------
+
+			/* unmap */
+			inline auto unmap(void) noexcept -> void {
+				if (_data == nullptr || _size == 0U) return;
+				::munmap(const_cast<value_type*>(_data), _size);
+			}
+
+
+			// -- private static members --------------------------------------
+
+			/* empty file sentinel */
+			static constexpr const value_type _empty[1] { '\0' };
+
+
+			// -- private members ---------------------------------------------
+
+			/* data */
+			const_pointer _data;
+
+			/* size */
+			size_type _size;
+
+	};
+
+}
+
+#endif // ENGINE_MAPPED_FILE_HPP
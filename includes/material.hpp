@@ -0,0 +1,99 @@
+#ifndef ENGINE_MATERIAL_HEADER
+#define ENGINE_MATERIAL_HEADER
+
+
+#include "simd.hpp"
+
+#include "mtl_render_command_encoder.hpp"
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- M A T E R I A L  C O M P O N E N T ----------------------------------
+
+	class material final {
+
+		public:
+
+			// -- public type -------------------------------------------------
+
+			/* self type */
+			using self = engine::material;
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* default constructor */
+			inline material(void) noexcept
+			: _color{1.0f, 1.0f, 1.0f, 1.0f} {}
+
+			/* copy constructor */
+			inline material(const self& other) noexcept
+			: _color{other._color} {}
+
+			/* move constructor */
+			inline material(self&& other) noexcept
+			: material{other} {}
+
+			/* destructor */
+			inline ~material(void) noexcept = default;
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* copy assignment operator */
+			inline auto operator=(const self& other) noexcept -> self& {
+				_color = other._color;
+				return *this;
+			}
+
+			/* move assignment operator */
+			inline auto operator=(self&& other) noexcept -> self& {
+				return self::operator=(other);
+			}
+
+
+			// -- public accessors --------------------------------------------
+
+			/* color */
+			inline auto color(void) noexcept -> simd::float4& {
+				return _color;
+			}
+
+
+			// -- public modifiers --------------------------------------------
+
+			/* color */
+			inline auto color(const float r, const float g, const float b, const float a) noexcept -> void {
+				_color = simd::float4{r, g, b, a};
+			}
+
+			/* color */
+			inline auto color(const float r, const float g, const float b) noexcept -> void {
+				_color = simd::float4{r, g, b, 1.0f};
+			}
+
+
+			// -- public methods ----------------------------------------------
+
+			/* render */
+			inline auto render(mtl::render_command_encoder& encoder) const noexcept -> void {
+				encoder.set_fragment_bytes(&_color, sizeof(_color), 1);
+			}
+
+
+		private:
+
+			// -- private members ---------------------------------------------
+
+			/* color */
+			simd::float4 _color;
+
+	};
+
+}
+
+#endif // ENGINE_MATERIAL_HEADER
@@ -0,0 +1,263 @@
+#ifndef ENGINE_MATERIAL_LIBRARY_HPP
+#define ENGINE_MATERIAL_LIBRARY_HPP
+
+#include "mapped_file.hpp"
+#include "scanner.hpp"
+#include "float_parser.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- M A T E R I A L  L I B R A R Y --------------------------------------
+
+	/* wavefront .mtl reader (newmtl, Ka, Kd, Ks, Ns, d, Tr, illum, map_Kd),
+	   other statements are skipped */
+
+	class material_library final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::material_library;
+
+			/* size type */
+			using size_type = std::size_t;
+
+
+			// -- E N T R Y ---------------------------------------------------
+
+			struct entry final {
+
+				/* material name */
+				std::string name;
+
+				/* ambient color */
+				float ambient[3];
+
+				/* diffuse color */
+				float diffuse[3];
+
+				/* specular color */
+				float specular[3];
+
+				/* specular exponent */
+				float shininess;
+
+				/* opacity (d, or 1 - Tr) */
+				float opacity;
+
+				/* illumination model */
+				std::uint32_t illum;
+
+				/* diffuse texture path */
+				std::string diffuse_map;
+			};
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* default constructor */
+			inline material_library(void)
+			: _entries{} {}
+
+			/* non-copyable class */
+			non_copyable(material_library);
+
+			/* move constructor */
+			inline material_library(self&&) noexcept = default;
+
+			/* destructor */
+			inline ~material_library(void) noexcept = default;
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* move assignment operator */
+			inline auto operator=(self&&) noexcept -> self& = default;
+
+
+			// -- public accessors --------------------------------------------
+
+			/* find material by name */
+			inline auto find(const std::string_view name) const noexcept -> const entry* {
+				for (const auto& e : _entries)
+					if (e.name == name)
+						return &e;
+				return nullptr;
+			}
+
+			/* entries */
+			inline auto entries(void) const noexcept -> const std::vector<entry>& {
+				return _entries;
+			}
+
+
+			// -- public modifiers --------------------------------------------
+
+			/* load library, entries are appended */
+			auto load(const char* path) -> bool {
+
+				const engine::mapped_file file{path};
+
+				if (not file) {
+					std::cout << "material library: error, can't map " << path << std::endl;
+					return false;
+				}
+
+				const char* it  = file.begin();
+				const char* end = file.end();
+
+				size_type line = 1U;
+
+				for (; it != end; ++line) {
+
+					const char* eol = engine::scanner::find_newline(it, end);
+
+					if (not self::statement(it, eol)) {
+						std::cout << "material library: error, " << path << " (line " << line << ")" << std::endl;
+						return false;
+					}
+
+					it = (eol != end) ? eol + 1 : end;
+				}
+				return true;
+			}
+
+
+		private:
+
+			// -- private methods ---------------------------------------------
+
+			/* one statement */
+			auto statement(const char* it, const char* end) -> bool {
+
+				const std::string_view key = self::token(it, end);
+
+				if (key.empty() || key[0] == '#')
+					return true;
+
+				if (key == "newmtl") {
+					const std::string_view name = self::rest(it, end);
+					if (name.empty())
+						return false;
+					_entries.push_back(entry{std::string{name},
+											 {0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 0.0f},
+											 0.0f, 1.0f, 0U, std::string{}});
+					return true;
+				}
+
+				// statements before the first newmtl are ignored
+				if (_entries.empty())
+					return true;
+
+				auto& e = _entries.back();
+
+				if (key == "Ka") return self::color(it, end, e.ambient);
+				if (key == "Kd") return self::color(it, end, e.diffuse);
+				if (key == "Ks") return self::color(it, end, e.specular);
+				if (key == "Ns") return self::number(it, end, e.shininess);
+				if (key == "d")  return self::number(it, end, e.opacity);
+
+				if (key == "Tr") {
+					float transparency = 0.0f;
+					if (not self::number(it, end, transparency))
+						return false;
+					e.opacity = 1.0f - transparency;
+					return true;
+				}
+
+				if (key == "illum") {
+					float illum = 0.0f;
+					if (not self::number(it, end, illum) || illum < 0.0f)
+						return false;
+					e.illum = static_cast<std::uint32_t>(illum);
+					return true;
+				}
+
+				if (key == "map_Kd") {
+					// options (-o, -s, ...) are not supported, last token is the path
+					const std::string_view map = self::rest(it, end);
+					const auto space = map.find_last_of(" \t");
+					e.diffuse_map = std::string{space == std::string_view::npos ? map : map.substr(space + 1U)};
+					return true;
+				}
+
+				return true;
+			}
+
+
+			// -- private static methods --------------------------------------
+
+			/* is blank */
+			static inline auto is_blank(const char c) noexcept -> bool {
+				return c == ' ' || c == '\t' || c == '\r';
+			}
+
+			/* next token */
+			static inline auto token(const char*& it, const char* end) noexcept -> std::string_view {
+				while (it != end && self::is_blank(*it))
+					++it;
+				const char* begin = it;
+				while (it != end && not self::is_blank(*it))
+					++it;
+				return std::string_view{begin, static_cast<size_type>(it - begin)};
+			}
+
+			/* rest of line, trimmed, comment excluded */
+			static inline auto rest(const char*& it, const char* end) noexcept -> std::string_view {
+				while (it != end && self::is_blank(*it))
+					++it;
+				const char* begin = it;
+				while (it != end && *it != '#')
+					++it;
+				const char* last = it;
+				while (last != begin && self::is_blank(*(last - 1)))
+					--last;
+				return std::string_view{begin, static_cast<size_type>(last - begin)};
+			}
+
+			/* number */
+			static inline auto number(const char*& it, const char* end, float& value) noexcept -> bool {
+				while (it != end && self::is_blank(*it))
+					++it;
+				return engine::float_parser::parse(it, end, value)
+					&& (it == end || self::is_blank(*it) || *it == '#');
+			}
+
+			/* r [g b] (one value is grey) */
+			static inline auto color(const char*& it, const char* end, float (&rgb)[3]) noexcept -> bool {
+				if (not self::number(it, end, rgb[0]))
+					return false;
+				while (it != end && self::is_blank(*it))
+					++it;
+				if (it == end || *it == '#') {
+					rgb[1] = rgb[2] = rgb[0];
+					return true;
+				}
+				return self::number(it, end, rgb[1])
+					&& self::number(it, end, rgb[2]);
+			}
+
+
+			// -- private members ---------------------------------------------
+
+			/* materials */
+			std::vector<entry> _entries;
+
+	};
+
+}
+
+#endif // ENGINE_MATERIAL_LIBRARY_HPP
@@ -1,7 +1,8 @@
 #ifndef ENGINE_MATRIX_HEADER
 #define ENGINE_MATRIX_HEADER
 
-#include <simd/simd.h>
+#include "simd.hpp"
+#include "transcendental.hpp"
 
 
 // -- E N G I N E  N A M E S P A C E ------------------------------------------
@@ -26,7 +27,7 @@ namespace engine {
 
 			/* default constructor */
 			inline matrix(void) noexcept
-			: _matrix{matrix_identity_float4x4} {}
+			: _matrix{simd::float4x4{1.0f}} {}
 
 			/* copy constructor */
 			inline matrix(const self& other) noexcept
@@ -61,21 +62,21 @@ namespace engine {
 			/* translate */
 			inline auto translate(const simd::float3& direction) noexcept -> void {
 
-				simd::float4x4 matrix = matrix_identity_float4x4;
+				simd::float4x4 matrix = simd::float4x4{1.0f};
 				matrix.columns[3].x = direction.x;
 				matrix.columns[3].y = direction.y;
 				matrix.columns[3].z = direction.z;
-				_matrix = matrix_multiply(_matrix, matrix);
+				_matrix = _matrix * matrix;
 			}
 
 			/* scale */
 			inline auto scale(const simd::float3& scale) noexcept -> void {
 
-				simd::float4x4 matrix = matrix_identity_float4x4;
+				simd::float4x4 matrix = simd::float4x4{1.0f};
 				matrix.columns[0].x = scale.x;
 				matrix.columns[1].y = scale.y;
 				matrix.columns[2].z = scale.z;
-				_matrix = matrix_multiply(_matrix, matrix);
+				_matrix = _matrix * matrix;
 			}
 
 			/* xrotate */
@@ -88,14 +89,14 @@ namespace engine {
 				   0  0  0  1
 				*/
 
-				simd::float4x4 matrix = matrix_identity_float4x4;
-				const float c = std::cos(angle);
-				const float s = std::sin(angle);
+				simd::float4x4 matrix = simd::float4x4{1.0f};
+				float s, c;
+				math::sincos(angle, s, c);
 				matrix.columns[1].y = +c;
 				matrix.columns[2].z = +c;
 				matrix.columns[2].y = -s;
 				matrix.columns[1].z = +s;
-				_matrix = matrix_multiply(_matrix, matrix);
+				_matrix = _matrix * matrix;
 			}
 
 			/* yrotate */
@@ -108,14 +109,14 @@ namespace engine {
 				   0  0  0  1
 				*/
 
-				simd::float4x4 matrix = matrix_identity_float4x4;
-				const float c = std::cos(angle);
-				const float s = std::sin(angle);
+				simd::float4x4 matrix = simd::float4x4{1.0f};
+				float s, c;
+				math::sincos(angle, s, c);
 				matrix.columns[0].x = +c;
 				matrix.columns[2].z = +c;
 				matrix.columns[0].z = -s;
 				matrix.columns[2].x = +s;
-				_matrix = matrix_multiply(_matrix, matrix);
+				_matrix = _matrix * matrix;
 			}
 
 			/* zrotate */
@@ -128,14 +129,14 @@ namespace engine {
 				   0  0  0  1
 				*/
 
-				simd::float4x4 matrix = matrix_identity_float4x4;
-				const float c = std::cos(angle);
-				const float s = std::sin(angle);
+				simd::float4x4 matrix = simd::float4x4{1.0f};
+				float s, c;
+				math::sincos(angle, s, c);
 				matrix.columns[0].x = +c;
 				matrix.columns[1].y = +c;
 				matrix.columns[0].y = -s;
 				matrix.columns[1].x = +s;
-				_matrix = matrix_multiply(_matrix, matrix);
+				_matrix = _matrix * matrix;
 			}
 
 			/* rotate */
@@ -145,18 +146,80 @@ namespace engine {
 				zrotate(rotation.z);
 			}
 
+			/* translate, rotate and scale at once (same result as reset, translate,
+			   rotate, scale without the four products and the identities) */
+			inline auto compose(const simd::float3& position,
+								const simd::float3& rotation,
+								const simd::float3& scale) noexcept -> void {
+				_matrix = self::trs(position, rotation, scale);
+			}
+
+			/* translate, rotate and scale at once, rotation as a unit quaternion */
+			inline auto compose(const simd::float3& position,
+								const simd::quatf& rotation,
+								const simd::float3& scale) noexcept -> void {
+				_matrix = self::trs(position, rotation, scale);
+			}
+
 			/* multiply */
 			inline auto multiply(const self& other) noexcept -> void {
-				_matrix = matrix_multiply(_matrix, other._matrix);
+				_matrix = _matrix * other._matrix;
 			}
 
 			/* reset */
 			inline auto reset(void) noexcept -> void {
-				_matrix = matrix_identity_float4x4;
+				_matrix = simd::float4x4{1.0f};
 			}
 
 
 
+			// -- public static methods ---------------------------------------
+
+			/* closed form of translate * xrotate * yrotate * zrotate * scale */
+			static inline auto trs(const simd::float3& position,
+								   const simd::float3& rotation,
+								   const simd::float3& scale) noexcept -> simd::float4x4 {
+
+				float sx, cx, sy, cy, sz, cz;
+				math::sincos(rotation.x, sx, cx);
+				math::sincos(rotation.y, sy, cy);
+				math::sincos(rotation.z, sz, cz);
+
+				// rotation columns, zrotate turns by -z like the product above
+				const float sxsy = sx * sy;
+				const float cxsy = cx * sy;
+
+				return simd::float4x4{
+					simd::float4{cy * cz * scale.x, (sxsy * cz - cx * sz) * scale.x, (-cxsy * cz - sx * sz) * scale.x, 0.0f},
+					simd::float4{cy * sz * scale.y, (sxsy * sz + cx * cz) * scale.y, (-cxsy * sz + sx * cz) * scale.y, 0.0f},
+					simd::float4{sy * scale.z, -sx * cy * scale.z, cx * cy * scale.z, 0.0f},
+					simd::float4{position.x, position.y, position.z, 1.0f}
+				};
+			}
+
+			/* translate * rotation matrix of the unit quaternion * scale (no trig) */
+			static inline auto trs(const simd::float3& position,
+								   const simd::quatf& rotation,
+								   const simd::float3& scale) noexcept -> simd::float4x4 {
+
+				const simd::float3x3 r = simd::matrix3x3(rotation);
+
+				return simd::float4x4{
+					simd::float4{r.columns[0] * scale.x, 0.0f},
+					simd::float4{r.columns[1] * scale.y, 0.0f},
+					simd::float4{r.columns[2] * scale.z, 0.0f},
+					simd::float4{position.x, position.y, position.z, 1.0f}
+				};
+			}
+
+			/* unit quaternion of the same turn as rotate(euler) */
+			static inline auto rotation(const simd::float3& euler) noexcept -> simd::quatf {
+				return simd::quatf{euler.x, simd::float3{1.0f, 0.0f, 0.0f}}
+					 * simd::quatf{euler.y, simd::float3{0.0f, 1.0f, 0.0f}}
+					 * simd::quatf{-euler.z, simd::float3{0.0f, 0.0f, 1.0f}};
+			}
+
+
 			// -- public accessors --------------------------------------------
 
 			/* underlying */
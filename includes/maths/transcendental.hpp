@@ -0,0 +1,108 @@
+#ifndef ENGINE_TRANSCENDENTAL_HEADER
+#define ENGINE_TRANSCENDENTAL_HEADER
+
+#include "simd_wide.hpp"
+
+#include <cstddef>
+#include <limits>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- M A T H  N A M E S P A C E ------------------------------------------
+
+	namespace math {
+
+
+		// -- T I E R S -------------------------------------------------------
+
+		/* accuracy tier of a kernel: fast trades ulp for fewer operations,
+		   accurate stays within a few ulp of the correctly rounded result */
+		enum tier : unsigned int {
+			FAST,
+			ACCURATE
+		};
+
+	} // namespace math
+
+
+	// -- K E R N E L S -------------------------------------------------------
+
+	#include "transcendental_kernel.hpp"
+
+
+	namespace math {
+
+
+		// -- scalar functions ------------------------------------------------
+
+		/* lanes of the scalar functions: a float splatted over four lanes
+		   where the target has them, cheaper than the branches the scalar
+		   selects turn into, with the same bits */
+		#if defined(ENGINE_SIMD_SSE)
+		using single = simd::wide_sse;
+		#elif defined(ENGINE_SIMD_NEON)
+		using single = simd::wide_neon;
+		#else
+		using single = simd::wide_scalar;
+		#endif
+
+		/* sine and cosine of one float */
+		template <math::tier T = math::ACCURATE>
+		inline auto sincos(const float x, float& s, float& c) noexcept -> void {
+			typename math::single::reg vs, vc;
+			math::kernel<math::single, T>::sincos(math::single::splat(x), vs, vc);
+			s = math::single::first(vs);
+			c = math::single::first(vc);
+		}
+
+		/* sine of one float */
+		template <math::tier T = math::ACCURATE>
+		inline auto sin(const float x) noexcept -> float {
+			return math::single::first(math::kernel<math::single, T>::sin(math::single::splat(x)));
+		}
+
+		/* cosine of one float */
+		template <math::tier T = math::ACCURATE>
+		inline auto cos(const float x) noexcept -> float {
+			return math::single::first(math::kernel<math::single, T>::cos(math::single::splat(x)));
+		}
+
+		/* reciprocal square root of one float */
+		template <math::tier T = math::ACCURATE>
+		inline auto rsqrt(const float x) noexcept -> float {
+			return math::single::first(math::kernel<math::single, T>::rsqrt(math::single::splat(x)));
+		}
+
+		/* exponential of one float */
+		template <math::tier T = math::ACCURATE>
+		inline auto exp(const float x) noexcept -> float {
+			return math::single::first(math::kernel<math::single, T>::exp(math::single::splat(x)));
+		}
+
+		/* natural logarithm of one float */
+		template <math::tier T = math::ACCURATE>
+		inline auto log(const float x) noexcept -> float {
+			return math::single::first(math::kernel<math::single, T>::log(math::single::splat(x)));
+		}
+
+		/* arc tangent of y / x of one float */
+		template <math::tier T = math::ACCURATE>
+		inline auto atan2(const float y, const float x) noexcept -> float {
+			return math::single::first(math::kernel<math::single, T>::atan2(math::single::splat(y), math::single::splat(x)));
+		}
+
+		/* arc cosine of one float */
+		template <math::tier T = math::ACCURATE>
+		inline auto acos(const float x) noexcept -> float {
+			return math::single::first(math::kernel<math::single, T>::acos(math::single::splat(x)));
+		}
+
+	} // namespace math
+
+}
+
+#endif // ENGINE_TRANSCENDENTAL_HEADER
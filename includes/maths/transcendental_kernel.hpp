@@ -0,0 +1,290 @@
+// -- T R A N S C E N D E N T A L  K E R N E L S ------------------------------
+
+/* no include guard: transcendental.hpp includes this in namespace engine,
+   simd_pack.hpp once per instruction set in namespace engine::simd::<set>
+   inside the target region of the set, where math::kernel names the copy
+   compiled for that set; engine::math::tier comes first */
+
+
+// -- M A T H  N A M E S P A C E ----------------------------------------------
+
+namespace math {
+
+
+	// -- K E R N E L -------------------------------------------------------
+
+	/* sine, cosine, reciprocal square root, exponential, logarithm, arc
+	   tangent and arc cosine of a register of floats, written once
+	   against the simd wide lanes: wide_scalar for one float,
+	   wide_sse or wide_neon for four, wide_avx for eight, wide_avx512
+	   for sixteen; every width runs the same operations, so a value
+	   gets the same bits at every width (without fp contraction)
+
+	   error bounds are the largest errors against the double precision
+	   libm, in units in the last place of the float result, over every
+	   float of the range (50M random pairs for atan2), with
+	   sse, avx-512 and without fp contraction; benchmarks/transcendental
+	   checks them on random inputs; no kernel handles nan, and
+	   subnormal results flush to zero */
+
+	template <typename L, engine::math::tier T = engine::math::ACCURATE>
+	class kernel final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = kernel<L, T>;
+
+			/* register type */
+			using reg = typename L::reg;
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* non-instanciable class */
+			kernel(void) = delete;
+
+
+			// -- public static methods ---------------------------------------
+
+			/* sine and cosine: quadrant reduction by parts of pi / 2, then
+			   minimax polynomials on [-pi / 4, pi / 4]
+			   fast: three part reduction, degree 5 and 6,
+			         26 ulp for |x| <= 100 (980 ulp near the zeros by 1e4)
+			   accurate: four part reduction, degree 7 and 8,
+			         1.6 ulp for |x| <= 100, 2.5 ulp for |x| <= 1e4 */
+			static inline auto sincos(const reg x, reg& s, reg& c) noexcept -> void {
+
+				const auto q = L::round(L::mul(x, L::splat(0.63661977236758134f)));
+				const auto k = L::convert(q);
+
+				// the leading parts are short enough for exact products with k
+				auto r = L::sub(x, L::mul(k, L::splat(1.5703125f)));
+				r = L::sub(r, L::mul(k, L::splat(4.837512969970703125e-4f)));
+
+				if constexpr (T == engine::math::ACCURATE) {
+					r = L::sub(r, L::mul(k, L::splat(7.549533620476723e-8f)));
+					r = L::sub(r, L::mul(k, L::splat(2.5633440682570896e-12f)));
+				}
+				else
+					r = L::sub(r, L::mul(k, L::splat(7.54978995489188216e-8f)));
+
+				const auto z = L::mul(r, r);
+
+				reg ps, pc;
+
+				if constexpr (T == engine::math::ACCURATE) {
+					ps = self::polynomial(z, {-1.9515295891e-4f, 8.3321608736e-3f, -1.6666654611e-1f});
+					pc = self::polynomial(z, {2.443315711809948e-5f, -1.388731625493765e-3f, 4.166664568298827e-2f});
+				}
+				else {
+					ps = self::polynomial(z, {8.1632819236e-3f, -1.6663390377e-1f});
+					pc = self::polynomial(z, {-1.3648714356e-3f, 4.1661071306e-2f});
+				}
+
+				ps = L::add(L::mul(L::mul(ps, z), r), r);
+				pc = L::add(L::sub(L::mul(L::mul(pc, z), z), L::mul(L::splat(0.5f), z)), L::splat(1.0f));
+
+				// odd quadrants swap, bit 1 of q flips the sine, bit 1 of q + 1 the cosine
+				const auto swap = L::bit(q, 1);
+				const auto sine = L::select(swap, pc, ps);
+				const auto cosine = L::select(swap, ps, pc);
+
+				s = L::select(L::bit(q, 2), L::neg(sine), sine);
+				c = L::select(L::bit(L::next(q), 2), L::neg(cosine), cosine);
+			}
+
+			/* sine, as sincos */
+			static inline auto sin(const reg x) noexcept -> reg {
+				reg s, c;
+				self::sincos(x, s, c);
+				return s;
+			}
+
+			/* cosine, as sincos */
+			static inline auto cos(const reg x) noexcept -> reg {
+				reg s, c;
+				self::sincos(x, s, c);
+				return c;
+			}
+
+			/* reciprocal square root of a positive normal float
+			   fast: hardware estimate and newton steps up to about 22
+			         bits, 5 ulp (the 12-bit estimate of every x86 width)
+			   accurate: 1 / sqrt(x), 1.5 ulp */
+			static inline auto rsqrt(const reg x) noexcept -> reg {
+
+				if constexpr (T == engine::math::ACCURATE)
+					return L::div(L::splat(1.0f), L::sqrt(x));
+				else {
+					auto y = L::rsqrt(x);
+					// each step doubles the correct bits of the estimate
+					constexpr unsigned int steps = L::estimate >= 23U ? 0U : L::estimate >= 12U ? 1U : 2U;
+					const auto half = L::mul(L::splat(0.5f), x);
+					for (unsigned int i = 0U; i < steps; ++i)
+						y = L::mul(y, L::sub(L::splat(1.5f), L::mul(L::mul(half, y), y)));
+					return y;
+				}
+			}
+
+			/* exponential: x = n ln 2 + r with |r| <= ln 2 / 2, 2^n added
+			   to the exponent of the polynomial of r; zero under -87,
+			   infinity over ln(FLT_MAX)
+			   fast: degree 4, 70 ulp
+			   accurate: degree 7, 1 ulp */
+			static inline auto exp(const reg x) noexcept -> reg {
+
+				const auto low = L::splat(-87.0f), high = L::splat(88.72283935546875f);
+				const auto a = L::min(L::max(x, low), high);
+
+				const auto n = L::round(L::mul(a, L::splat(1.44269504088896341f)));
+				const auto k = L::convert(n);
+
+				auto r = L::sub(a, L::mul(k, L::splat(0.693359375f)));
+				r = L::sub(r, L::mul(k, L::splat(-2.12194440e-4f)));
+
+				reg p;
+				if constexpr (T == engine::math::ACCURATE)
+					p = self::polynomial(r, {1.9875691500e-4f, 1.3981999507e-3f, 8.3334519073e-3f,
+											 4.1665795894e-2f, 1.6666665459e-1f, 5.0000001201e-1f});
+				else
+					p = self::polynomial(r, {4.1277747308e-2f, 1.6753513923e-1f, 5.0005116024e-1f});
+
+				p = L::add(L::add(L::mul(p, L::mul(r, r)), r), L::splat(1.0f));
+
+				const auto y = L::scale(p, n);
+				return L::select(L::less(x, low), L::splat(0.0f),
+								 L::select(L::less(high, x), L::splat(std::numeric_limits<float>::infinity()), y));
+			}
+
+			/* natural logarithm: x = m 2^e with m in [sqrt(2) / 2, sqrt(2)],
+			   e ln 2 + log(1 + f) with f = m - 1; -infinity under
+			   FLT_MIN (subnormals included), nan under zero
+			   fast: degree 6, 208 ulp
+			   accurate: degree 11, 0.9 ulp */
+			static inline auto log(const reg x) noexcept -> reg {
+
+				auto m = L::mantissa(x);
+				auto e = L::convert(L::exponent(x));
+
+				const auto big = L::less(L::splat(1.41421356237309505f), m);
+				m = L::select(big, L::mul(m, L::splat(0.5f)), m);
+				e = L::select(big, L::add(e, L::splat(1.0f)), e);
+
+				const auto f = L::sub(m, L::splat(1.0f));
+				const auto z = L::mul(f, f);
+
+				reg p;
+				if constexpr (T == engine::math::ACCURATE)
+					p = self::polynomial(f, {7.0376836292e-2f, -1.1514610310e-1f, 1.1676998740e-1f,
+											 -1.2420140846e-1f, 1.4249322787e-1f, -1.6668057665e-1f,
+											 2.0000714765e-1f, -2.4999993993e-1f, 3.3333331174e-1f});
+				else
+					p = self::polynomial(f, {-1.4592516771e-1f, 2.1776510287e-1f, -2.5244997329e-1f, 3.3285471016e-1f});
+
+				auto y = L::mul(L::mul(p, f), z);
+				y = L::add(y, L::mul(e, L::splat(-2.12194440e-4f)));
+				y = L::sub(y, L::mul(L::splat(0.5f), z));
+				y = L::add(L::add(f, y), L::mul(e, L::splat(0.693359375f)));
+
+				const auto tiny = L::less(x, L::splat(std::numeric_limits<float>::min()));
+				const auto edge = L::select(L::less(x, L::splat(0.0f)), L::splat(std::numeric_limits<float>::quiet_NaN()),
+											L::splat(-std::numeric_limits<float>::infinity()));
+				return L::select(tiny, edge, y);
+			}
+
+			/* arc tangent of y / x in [-pi, pi], quadrant from the signs
+			   (a zero x counts as positive), zero for two zeros
+			   fast: degree 9 on [0, 1], 600 ulp
+			   accurate: reduced to [0, tan(pi / 8)], degree 9, 3 ulp */
+			static inline auto atan2(const reg y, const reg x) noexcept -> reg {
+
+				const auto ax = L::abs(x), ay = L::abs(y);
+				const auto zero = L::splat(0.0f);
+
+				// the ratio in [0, 1], folded to the first octant
+				auto num = L::min(ax, ay);
+				auto den = L::max(ax, ay);
+
+				reg base = zero;
+				if constexpr (T == engine::math::ACCURATE) {
+					// atan(t) = pi / 4 + atan((t - 1) / (t + 1)) past tan(pi / 8)
+					const auto big = L::less(L::mul(den, L::splat(0.41421356237309505f)), num);
+					const auto d = L::select(big, L::sub(num, den), num);
+					den = L::select(big, L::add(num, den), den);
+					num = d;
+					base = L::select(big, L::splat(0.78539816339744831f), zero);
+				}
+
+				const auto t = L::select(L::less(zero, den), L::div(num, den), zero);
+				const auto z = L::mul(t, t);
+
+				reg p;
+				if constexpr (T == engine::math::ACCURATE)
+					p = self::polynomial(z, {8.05374449538e-2f, -1.38776856032e-1f, 1.99777106478e-1f, -3.33329491539e-1f});
+				else
+					p = self::polynomial(z, {2.4840281779e-2f, -9.4097941212e-2f, 1.8681417711e-1f, -3.3213071994e-1f});
+
+				auto a = L::add(base, L::add(L::mul(L::mul(p, z), t), t));
+
+				a = L::select(L::less(ax, ay), L::sub(L::splat(1.57079632679489662f), a), a);
+				a = L::select(L::less(x, zero), L::sub(L::splat(3.14159265358979324f), a), a);
+				return L::copysign(a, y);
+			}
+
+			/* arc cosine on [-1, 1]
+			   fast: sqrt(1 - |x|) times a cubic, 760 ulp
+			   accurate: arc sine polynomial on [0, 0.5], past that through
+			         acos(a) = 2 asin(sqrt((1 - a) / 2)), 1.3 ulp */
+			static inline auto acos(const reg x) noexcept -> reg {
+
+				const auto a = L::abs(x);
+				const auto one = L::splat(1.0f);
+				const auto negative = L::less(x, L::splat(0.0f));
+
+				if constexpr (T == engine::math::ACCURATE) {
+					const auto half = L::splat(0.5f);
+					const auto big = L::less(half, a);
+
+					const auto z = L::select(big, L::mul(half, L::sub(one, a)), L::mul(a, a));
+					const auto s = L::select(big, L::sqrt(z), a);
+
+					auto p = self::polynomial(z, {4.2163199048e-2f, 2.4181311049e-2f, 4.5470025998e-2f,
+												  7.4953002686e-2f, 1.6666752422e-1f});
+					p = L::add(L::mul(L::mul(p, z), s), s);
+
+					const auto twice = L::add(p, p);
+					const auto far   = L::select(negative, L::sub(L::splat(3.14159265358979f), twice), twice);
+					const auto near  = L::sub(L::splat(1.57079632679490f), L::select(negative, L::neg(p), p));
+
+					return L::select(big, far, near);
+				}
+				else {
+					const auto p = L::mul(L::sqrt(L::sub(one, a)),
+										  self::polynomial(a, {-1.8616494300e-2f, 7.4093352339e-2f,
+															   -2.1205255411e-1f, 1.5707254192e+0f}));
+					return L::select(negative, L::sub(L::splat(3.14159265358979f), p), p);
+				}
+			}
+
+
+		private:
+
+			// -- private static methods --------------------------------------
+
+			/* horner evaluation, coefficients from the highest degree */
+			template <std::size_t N>
+			static inline auto polynomial(const reg x, const float (&c)[N]) noexcept -> reg {
+				static_assert(N > 1U, "polynomial needs two coefficients");
+				auto p = L::add(L::mul(L::splat(c[0]), x), L::splat(c[1]));
+				for (std::size_t i = 2U; i < N; ++i)
+					p = L::add(L::mul(p, x), L::splat(c[i]));
+				return p;
+			}
+
+	};
+
+} // namespace math
@@ -5,7 +5,17 @@
 #include <Metal/Metal.hpp>
 
 #include "mtl_render_command_encoder.hpp"
+#include "mtl_render_pipeline_state.hpp"
 #include "vertex.hpp"
+#include "primitives.hpp"
+#include "compact_vertex.hpp"
+#include "vertex_streams.hpp"
+#include "meshlet.hpp"
+#include "cluster_culling.hpp"
+#include "welder.hpp"
+#include "cooked_mesh.hpp"
+#include "model.hpp"
+#include "material.hpp"
 
 #include "options.hpp"
 #include "mtl_buffer.hpp"
@@ -33,14 +43,26 @@ namespace engine {
 
 			/* default constructor */
 			inline mesh(void) noexcept
-			: _vertices{}, _indexes{} {}
+			: _vertices{}, _indexes{}, _vcount{0}, _icount{0}, _itype{MTL::IndexTypeUInt32}, _submeshes{}, _materials{},
+			  _format{engine::vertex_format::FULL}, _dequantize{}, _attributes{}, _meshlets{},
+			  _lods{}, _lod_submeshes{}, _sphere{} {}
 
 			/* vertex constructor */
 			inline mesh(const std::vector<engine::vertex>& vertex) noexcept
 			:	_vertices{vertex.size() * sizeof(engine::vertex)},
 				_indexes{},
 				_vcount{vertex.size()},
-				_icount{0} {
+				_icount{0},
+				_itype{MTL::IndexTypeUInt32},
+				_submeshes{},
+				_materials{},
+				_format{engine::vertex_format::FULL},
+				_dequantize{},
+				_attributes{},
+				_meshlets{},
+				_lods{},
+				_lod_submeshes{},
+				_sphere{} {
 				// size already set (overloaded method)
 				_vertices.set_contents(vertex.data());
 			}
@@ -50,7 +72,17 @@ namespace engine {
 			:	_vertices{vertex.size() * sizeof(engine::vertex_2D)},
 				_indexes{},
 				_vcount{vertex.size()},
-				_icount{0} {
+				_icount{0},
+				_itype{MTL::IndexTypeUInt32},
+				_submeshes{},
+				_materials{},
+				_format{engine::vertex_format::FULL},
+				_dequantize{},
+				_attributes{},
+				_meshlets{},
+				_lods{},
+				_lod_submeshes{},
+				_sphere{} {
 				// size already set (overloaded method)
 				_vertices.set_contents(vertex.data());
 			}
@@ -60,7 +92,17 @@ namespace engine {
 			:	_vertices{vertex.size() * sizeof(engine::vertex_2D)},
 				_indexes{index.size() * sizeof(unsigned int)},
 				_vcount{vertex.size()},
-				_icount{index.size()} {
+				_icount{index.size()},
+				_itype{MTL::IndexTypeUInt32},
+				_submeshes{},
+				_materials{},
+				_format{engine::vertex_format::FULL},
+				_dequantize{},
+				_attributes{},
+				_meshlets{},
+				_lods{},
+				_lod_submeshes{},
+				_sphere{} {
 				// size already set (overloaded method)
 				_vertices.set_contents(vertex.data());
 				_indexes.set_contents(index.data());
@@ -72,7 +114,17 @@ namespace engine {
 			:   _vertices{vertices.size() * sizeof(engine::vertex_2D)},
 				 _indexes{indexes.size()  * sizeof(unsigned int)},
 				_vcount{vertices.size()},
-				_icount{indexes.size()} {
+				_icount{indexes.size()},
+				_itype{MTL::IndexTypeUInt32},
+				_submeshes{},
+				_materials{},
+				_format{engine::vertex_format::FULL},
+				_dequantize{},
+				_attributes{},
+				_meshlets{},
+				_lods{},
+				_lod_submeshes{},
+				_sphere{} {
 				// size already set (overloaded method)
 				_vertices.set_contents(vertices.data());
 				_indexes.set_contents(indexes.data());
@@ -83,54 +135,503 @@ namespace engine {
 			:   _vertices{vertices.size() * sizeof(engine::vertex_2D)},
 				 _indexes{},
 				_vcount{vertices.size()},
-				_icount{0} {
+				_icount{0},
+				_itype{MTL::IndexTypeUInt32},
+				_submeshes{},
+				_materials{},
+				_format{engine::vertex_format::FULL},
+				_dequantize{},
+				_attributes{},
+				_meshlets{},
+				_lods{},
+				_lod_submeshes{},
+				_sphere{} {
 				// size already set (overloaded method)
 				_vertices.set_contents(vertices.data());
 			}
 
 
-			/* vertex + index constructor */
-			inline mesh(const engine::vpackage& vpackage) noexcept
-			:	_vertices{vpackage.first.size() * sizeof(engine::vertex)},
-				_indexes{vpackage.second.size() * sizeof(unsigned int)},
+			/* vertex + index constructor (16-bit indexes when vertices fit) */
+			inline mesh(const engine::vpackage& vpackage,
+						const engine::vertex_format format = engine::vertex_format::FULL)
+			:	_vertices{vpackage.first.size() * self::vertex_size(format)},
+				_indexes{vpackage.second.size() * self::index_size(vpackage.first.size())},
 				_vcount{vpackage.first.size()},
-				_icount{vpackage.second.size()} {
+				_icount{vpackage.second.size()},
+				_itype{self::index_type(vpackage.first.size())},
+				_submeshes{},
+				_materials{},
+				_format{format},
+				_dequantize{},
+				_attributes{},
+				_meshlets{},
+				_lods{},
+				_lod_submeshes{},
+				_sphere{} {
+
+				self::fill(vpackage.first.data(), vpackage.first.size());
+
+				if (_itype == MTL::IndexTypeUInt16)
+					_indexes.set_contents(engine::welder::narrow(vpackage.second).data());
+				else
+					_indexes.set_contents(vpackage.second.data());
+			}
+
+			/* primitive constructor (baked geometry uploaded as is, 3D vertices in the mesh format) */
+			template <decltype(sizeof(0)) NV, decltype(NV) NI, typename T>
+			inline mesh(const engine::primitive<NV, NI, T>& primitive,
+						const engine::vertex_format format = engine::vertex_format::FULL)
+			:	_vertices{NV * (std::is_same_v<T, engine::vertex> ? self::vertex_size(format) : sizeof(T))},
+				_indexes{NI * sizeof(typename engine::primitive<NV, NI, T>::index_type)},
+				_vcount{NV},
+				_icount{NI},
+				_itype{sizeof(typename engine::primitive<NV, NI, T>::index_type) == 2U
+					 ? MTL::IndexTypeUInt16 : MTL::IndexTypeUInt32},
+				_submeshes{},
+				_materials{},
+				_format{std::is_same_v<T, engine::vertex> ? format : engine::vertex_format::FULL},
+				_dequantize{},
+				_attributes{},
+				_meshlets{},
+				_lods{},
+				_lod_submeshes{},
+				_sphere{} {
+
+				if constexpr (std::is_same_v<T, engine::vertex>)
+					self::fill(primitive.vertices.data(), NV);
+				else
+					_vertices.set_contents(primitive.vertices.data());
+
+				_indexes.set_contents(primitive.indexes.data());
+			}
+
+			/* model constructor (one draw per submesh, materials indexed by submesh material id) */
+			inline mesh(const engine::model& model, std::vector<engine::material>&& materials,
+						const engine::vertex_format format = engine::vertex_format::FULL)
+			:	mesh{model.package, format} {
+				_submeshes = model.submeshes;
+				_materials = std::move(materials);
+				_meshlets  = engine::meshlet_builder::build(model);
+
+				// lod indexes follow the base ones
+				if (not model.lods.empty())
+					static_cast<void>(self::upload(model));
+
+				self::levels(model.lods, model.lod_submeshes);
+			}
 
-				_vertices.set_contents(vpackage.first.data());
-				_indexes.set_contents(vpackage.second.data());
+			/* cooked constructor (mapped streams copied as is, vertices converted unless full) */
+			inline mesh(const engine::cooked_mesh& cooked, std::vector<engine::material>&& materials = {},
+						const engine::vertex_format format = engine::vertex_format::FULL)
+			:	_vertices{cooked.vertex_count() * self::vertex_size(format)},
+				_indexes{cooked.index_bytes()},
+				_vcount{cooked.vertex_count()},
+				_icount{cooked.index_count()},
+				_itype{cooked.index_size() == 2U ? MTL::IndexTypeUInt16 : MTL::IndexTypeUInt32},
+				_submeshes{cooked.submeshes(), cooked.submeshes() + cooked.submesh_count()},
+				_materials{std::move(materials)},
+				_format{format},
+				_dequantize{},
+				_attributes{},
+				_meshlets{cooked.meshlets(), cooked.meshlets() + cooked.meshlet_count()},
+				_lods{},
+				_lod_submeshes{},
+				_sphere{} {
+
+				self::fill(static_cast<const engine::vertex*>(cooked.vertices()), _vcount);
+				_indexes.set_contents(cooked.indexes());
+
+				self::levels({cooked.lods(), cooked.lods() + cooked.lod_count()},
+							 {cooked.lod_submeshes(), cooked.lod_submeshes() + cooked.lod_submesh_count()});
 			}
 
 			/* move constructor */
 			inline mesh(mesh&& mesh) noexcept
-			: _vertices{std::move(mesh._vertices)}, _indexes{std::move(mesh._indexes)}, _vcount{mesh._vcount}, _icount{mesh._icount} {
+			: _vertices{std::move(mesh._vertices)}, _indexes{std::move(mesh._indexes)},
+			  _vcount{mesh._vcount}, _icount{mesh._icount}, _itype{mesh._itype},
+			  _submeshes{std::move(mesh._submeshes)}, _materials{std::move(mesh._materials)},
+			  _format{mesh._format}, _dequantize{mesh._dequantize}, _attributes{std::move(mesh._attributes)},
+			  _meshlets{std::move(mesh._meshlets)}, _lods{std::move(mesh._lods)},
+			  _lod_submeshes{std::move(mesh._lod_submeshes)}, _sphere{mesh._sphere} {
 			}
 
 			/* destructor */
 			inline ~mesh(void) noexcept = default;
 
 
+			/* move assignment operator (swaps a resident mesh over a placeholder) */
+			inline auto operator=(mesh&& mesh) noexcept -> self& {
+				if (this == &mesh) return *this;
+				_vertices  = std::move(mesh._vertices);
+				_indexes   = std::move(mesh._indexes);
+				_vcount    = mesh._vcount;
+				_icount    = mesh._icount;
+				_itype     = mesh._itype;
+				_submeshes = std::move(mesh._submeshes);
+				_materials = std::move(mesh._materials);
+				_format    = mesh._format;
+				_dequantize = mesh._dequantize;
+				_attributes = std::move(mesh._attributes);
+				_meshlets   = std::move(mesh._meshlets);
+				_lods       = std::move(mesh._lods);
+				_lod_submeshes = std::move(mesh._lod_submeshes);
+				_sphere     = mesh._sphere;
+				return *this;
+			}
+
+
 
 			/* render */
 			inline auto render(mtl::render_command_encoder& encoder, const engine::options& opts) const noexcept -> void {
 
+				// placeholder, nothing resident yet
+				if (_vcount == 0U)
+					return;
+
 				opts.render(encoder);
 				// set index buffer
-				encoder.set_vertex_buffer(_vertices, 0, 0);
+				self::bind(encoder);
 
 				if (not _indexes) {
 					encoder.draw_primitives(opts.primitive(), _vcount);
 				}
 				else
-					encoder.draw_indexed_primitives(opts.primitive(), _icount, _indexes);
+					encoder.draw_indexed_primitives(opts.primitive(), _icount, _indexes, _itype);
+
+				self::unbind(encoder);
+			}
+
+			/* render submeshes, each material bound once (fallback for submeshes without one) */
+			inline auto render(mtl::render_command_encoder& encoder, const engine::options& opts,
+							   const engine::material& fallback) const noexcept -> void {
+
+				if (_submeshes.empty() || _vcount == 0U) {
+					fallback.render(encoder);
+					self::render(encoder, opts);
+					return;
+				}
+
+				opts.render(encoder);
+				self::bind(encoder);
+				self::draw(encoder, opts, fallback, _submeshes.data(), _submeshes.size());
+				self::unbind(encoder);
+			}
+
+			/* render the meshlets that survive culling, or the lod picked for the
+			   distance, materials as above (whole submeshes without meshlets) */
+			inline auto render(mtl::render_command_encoder& encoder, const engine::options& opts,
+							   const engine::material& fallback, engine::cluster_culling& culling,
+							   const simd::float4x4& world) const noexcept -> void {
+
+				if (_meshlets.empty() || _vcount == 0U || not _indexes) {
+					self::render(encoder, opts, fallback);
+					return;
+				}
+
+				const auto level = culling.level(_lods.data(), _lods.size(), _sphere, world);
+
+				if (level != 0U) {
+
+					if (culling.outside(_sphere, world))
+						return;
+
+					opts.render(encoder);
+					self::bind(encoder);
+
+					if (_submeshes.empty()) {
+						const auto& lod = _lods[level - 1U];
+						const engine::submesh whole{lod.index_offset, lod.index_count, engine::model::NO_MATERIAL, 0U, {}};
+						self::draw(encoder, opts, fallback, &whole, 1U);
+					}
+					else
+						self::draw(encoder, opts, fallback, _lod_submeshes.data() + ((level - 1U) * _submeshes.size()),
+								   _submeshes.size());
+
+					self::unbind(encoder);
+					return;
+				}
+
+				// reused across frames and meshes
+				static thread_local std::vector<engine::cluster_culling::range> visible;
+				visible.clear();
+
+				culling.cull(_meshlets, world, visible);
+
+				if (visible.empty())
+					return;
+
+				opts.render(encoder);
+				self::bind(encoder);
+
+				const std::size_t isize = (_itype == MTL::IndexTypeUInt16) ? sizeof(std::uint16_t) : sizeof(std::uint32_t);
+				const engine::material* bound = nullptr;
+
+				for (const auto& r : visible) {
+
+					const std::uint32_t id = r.submesh < _submeshes.size()
+										   ? _submeshes[r.submesh].material : engine::model::NO_MATERIAL;
+					const engine::material* material = (id < _materials.size()) ? &_materials[id] : &fallback;
+
+					if (material != bound) {
+						material->render(encoder);
+						bound = material;
+					}
+
+					encoder.draw_indexed_primitives(opts.primitive(), r.index_count, _indexes, _itype,
+													r.index_offset * isize);
+				}
+
+				self::unbind(encoder);
+			}
+
+			/* submesh table */
+			inline auto submeshes(void) const noexcept -> const engine::submeshes& {
+				return _submeshes;
+			}
+
+			/* lod table (offsets into the index buffer) */
+			inline auto lods(void) const noexcept -> const engine::lods& {
+				return _lods;
+			}
+
+			/* vertex layout */
+			inline auto format(void) const noexcept -> engine::vertex_format {
+				return _format;
+			}
+
+			/* packed positions (xyz per vertex) for cpu passes, null unless split */
+			inline auto positions(void) const noexcept -> const float* {
+				return _format == engine::vertex_format::SPLIT
+					 ? static_cast<const float*>(_vertices.contents()) : nullptr;
+			}
+
+
+			// -- public modifiers --------------------------------------------
+
+			/* replace contents in place (references stay valid, format kept), buffers of
+			   unchanged size are patched where bytes differ, return bytes uploaded */
+			inline auto update(const engine::model& model, std::vector<engine::material>&& materials) -> std::size_t {
+
+				const auto& package = model.package;
+				const MTL::IndexType itype = self::index_type(package.first.size());
+
+				std::size_t uploaded = 0U;
+
+				if (_format == engine::vertex_format::COMPACT) {
+					const auto packed = engine::vertex_codec::encode(package.first, _dequantize);
+					uploaded = self::upload(_vertices, packed.data(), packed.size() * sizeof(engine::compact_vertex));
+				}
+				else if (_format == engine::vertex_format::SPLIT) {
+					const std::size_t count = package.first.size();
+					std::vector<float> positions(count * 3U);
+					engine::attribute_stream attributes(count);
+					engine::vertex_streams::split(package.first.data(), count, positions.data(), attributes.data());
+					uploaded  = self::upload(_vertices, positions.data(), positions.size() * sizeof(float));
+					uploaded += self::upload(_attributes, attributes.data(), count * sizeof(engine::vertex_attributes));
+				}
+				else
+					uploaded = self::upload(_vertices, package.first.data(),
+											package.first.size() * sizeof(engine::vertex));
+
+				_itype    = itype;
+				uploaded += self::upload(model);
+
+				_vcount    = package.first.size();
+				_icount    = package.second.size();
+				_submeshes = model.submeshes;
+				_materials = std::move(materials);
+				_meshlets  = engine::meshlet_builder::build(model);
+
+				self::levels(model.lods, model.lod_submeshes);
+
+				return uploaded;
 			}
 
 
 		private:
 
+			// -- private static methods --------------------------------------
+
+			/* index type for vertex count */
+			static inline auto index_type(const std::size_t vcount) noexcept -> MTL::IndexType {
+				return vcount <= 0xffffU ? MTL::IndexTypeUInt16 : MTL::IndexTypeUInt32;
+			}
+
+			/* index size for vertex count */
+			static inline auto index_size(const std::size_t vcount) noexcept -> std::size_t {
+				return vcount <= 0xffffU ? sizeof(std::uint16_t) : sizeof(std::uint32_t);
+			}
+
+			/* vertex size for format */
+			static inline auto vertex_size(const engine::vertex_format format) noexcept -> std::size_t {
+				switch (format) {
+					case engine::vertex_format::COMPACT: return sizeof(engine::compact_vertex);
+					case engine::vertex_format::SPLIT:   return sizeof(float) * 3U;
+					default:                             return sizeof(engine::vertex);
+				}
+			}
+
+			/* write bytes into buffer, reallocated on size change, patched otherwise */
+			static auto upload(mtl::buffer& buffer, const void* data, const std::size_t size) -> std::size_t {
+
+				if (size == 0U) {
+					buffer = mtl::buffer{};
+					return 0U;
+				}
+
+				if (buffer.size() != size) {
+					buffer = mtl::buffer{size};
+					buffer.set_contents(data);
+					return size;
+				}
+
+				// frames still in flight may see a partial patch for one frame
+				return buffer.patch(data);
+			}
+
+
+			// -- private methods ---------------------------------------------
+
+			/* base then lod indexes in the mesh index type, return bytes uploaded */
+			auto upload(const engine::model& model) -> std::size_t {
+
+				const auto& base = model.package.second;
+				const auto& lods = model.lod_indexes;
+
+				if (_itype == MTL::IndexTypeUInt16) {
+					auto narrowed = engine::welder::narrow(base);
+					const auto tail = engine::welder::narrow(lods);
+					narrowed.insert(narrowed.end(), tail.begin(), tail.end());
+					return self::upload(_indexes, narrowed.data(), narrowed.size() * sizeof(std::uint16_t));
+				}
+
+				if (lods.empty())
+					return self::upload(_indexes, base.data(), base.size() * sizeof(std::uint32_t));
+
+				engine::indexes all;
+				all.reserve(base.size() + lods.size());
+				all.insert(all.end(), base.begin(), base.end());
+				all.insert(all.end(), lods.begin(), lods.end());
+				return self::upload(_indexes, all.data(), all.size() * sizeof(std::uint32_t));
+			}
+
+			/* lod tables moved past the base indexes, bounding sphere from the meshlets */
+			auto levels(engine::lods lods, engine::submeshes submeshes) -> void {
+
+				for (auto& lod : lods)
+					lod.index_offset += static_cast<std::uint32_t>(_icount);
+				for (auto& sub : submeshes)
+					sub.index_offset += static_cast<std::uint32_t>(_icount);
+
+				_lods          = std::move(lods);
+				_lod_submeshes = std::move(submeshes);
+
+				if (_meshlets.empty()) {
+					_sphere = simd::float4{0.0f, 0.0f, 0.0f, 0.0f};
+					return;
+				}
+
+				// sphere around the box of the meshlet spheres
+				float lo[3], hi[3];
+				for (unsigned int k = 0U; k < 3U; ++k) {
+					lo[k] = _meshlets[0U].center[k] - _meshlets[0U].radius;
+					hi[k] = _meshlets[0U].center[k] + _meshlets[0U].radius;
+				}
+				for (const auto& m : _meshlets)
+					for (unsigned int k = 0U; k < 3U; ++k) {
+						lo[k] = std::min(lo[k], m.center[k] - m.radius);
+						hi[k] = std::max(hi[k], m.center[k] + m.radius);
+					}
+
+				const float c[3] { (lo[0] + hi[0]) * 0.5f, (lo[1] + hi[1]) * 0.5f, (lo[2] + hi[2]) * 0.5f };
+				float radius = 0.0f;
+
+				for (const auto& m : _meshlets) {
+					const float d[3] { m.center[0] - c[0], m.center[1] - c[1], m.center[2] - c[2] };
+					radius = std::max(radius, std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]) + m.radius);
+				}
+
+				_sphere = simd::float4{c[0], c[1], c[2], radius};
+			}
+
+			/* draw submesh ranges, each material bound once (fallback for ranges without one) */
+			auto draw(mtl::render_command_encoder& encoder, const engine::options& opts, const engine::material& fallback,
+					  const engine::submesh* subs, const std::size_t count) const noexcept -> void {
+
+				const std::size_t isize = (_itype == MTL::IndexTypeUInt16) ? sizeof(std::uint16_t) : sizeof(std::uint32_t);
+				const engine::material* bound = nullptr;
+
+				// submeshes are sorted by material
+				for (std::size_t i = 0U; i < count; ++i) {
+
+					const auto& sub = subs[i];
+
+					if (sub.index_count == 0U)
+						continue;
+
+					const engine::material* material = (sub.material < _materials.size())
+													 ? &_materials[sub.material] : &fallback;
+
+					if (material != bound) {
+						material->render(encoder);
+						bound = material;
+					}
+
+					encoder.draw_indexed_primitives(opts.primitive(), sub.index_count, _indexes, _itype,
+													sub.index_offset * isize);
+				}
+			}
+
+			/* fill vertex buffer (already sized) in the mesh format */
+			auto fill(const engine::vertex* vertices, const std::size_t count) -> void {
+
+				if (count == 0U)
+					return;
+
+				if (_format == engine::vertex_format::COMPACT) {
+					engine::compact_vertices packed(count);
+					_dequantize = engine::vertex_codec::quantization(vertices, count);
+					engine::vertex_codec::encode(vertices, count, _dequantize, packed.data());
+					_vertices.set_contents(packed.data());
+				}
+				else if (_format == engine::vertex_format::SPLIT) {
+					std::vector<float> positions(count * 3U);
+					engine::attribute_stream attributes(count);
+					engine::vertex_streams::split(vertices, count, positions.data(), attributes.data());
+					_vertices.set_contents(positions.data());
+					_attributes = mtl::buffer{count * sizeof(engine::vertex_attributes)};
+					_attributes.set_contents(attributes.data());
+				}
+				else
+					_vertices.set_contents(vertices);
+			}
+
+			/* bind vertex buffers (and the pipeline of a non default format) */
+			inline auto bind(mtl::render_command_encoder& encoder) const noexcept -> void {
+
+				encoder.set_vertex_buffer(_vertices, 0, 0);
+
+				if (_format == engine::vertex_format::COMPACT) {
+					encoder.set_render_pipeline_state(mtl::render_pipeline_state_library::state<"compact_3D">());
+					encoder.set_vertex_bytes(&_dequantize, sizeof(engine::dequantize), 5);
+				}
+				else if (_format == engine::vertex_format::SPLIT) {
+					encoder.set_render_pipeline_state(mtl::render_pipeline_state_library::state<"split_3D">());
+					encoder.set_vertex_buffer(_attributes, 0, mtl::vertex_descriptor::ATTRIBUTE_BUFFER);
+				}
+			}
+
+			/* restore the default pipeline after a non default draw */
+			inline auto unbind(mtl::render_command_encoder& encoder) const noexcept -> void {
+				if (_format != engine::vertex_format::FULL)
+					encoder.set_render_pipeline_state(mtl::render_pipeline_state_library::state<"default_3D">());
+			}
+
+
 			// -- private members ---------------------------------------------
 
 
-			/* vertex buffer */
+			/* vertex buffer (positions only when split) */
 			mtl::buffer _vertices;
 
 			/* index buffer */
@@ -143,6 +644,36 @@ namespace engine {
 			/* index count */
 			std::size_t _icount;
 
+			/* index type */
+			MTL::IndexType _itype;
+
+			/* submesh table (empty: one draw) */
+			engine::submeshes _submeshes;
+
+			/* materials by submesh material id */
+			std::vector<engine::material> _materials;
+
+			/* vertex layout */
+			engine::vertex_format _format;
+
+			/* compact position dequantization */
+			engine::dequantize _dequantize;
+
+			/* attribute stream (split format only) */
+			mtl::buffer _attributes;
+
+			/* culling clusters (empty: drawn whole) */
+			engine::meshlets _meshlets;
+
+			/* simplified levels (offsets past the base indexes) */
+			engine::lods _lods;
+
+			/* level submesh tables, submesh count entries per level */
+			engine::submeshes _lod_submeshes;
+
+			/* bounding sphere (xyz center, w radius) */
+			simd::float4 _sphere;
+
 	};
 
 
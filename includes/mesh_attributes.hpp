@@ -0,0 +1,528 @@
+#ifndef ENGINE_MESH_ATTRIBUTES_HPP
+#define ENGINE_MESH_ATTRIBUTES_HPP
+
+#include "vertex.hpp"
+#include "model.hpp"
+#include "parallel.hpp"
+
+#include "simd.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- M E S H  A T T R I B U T E S ----------------------------------------
+
+	/* fills the vertex attributes a source left out
+
+	   normals: face corners without one get the sum of the face normals
+	   around their position, weighted by face area and corner angle, shared
+	   only inside an obj smoothing group (group 0 is flat shading); runs on
+	   parsed faces so the welder splits vertices along group borders
+
+	   tangents: per welded vertex in the mikktspace convention, face uv
+	   derivatives projected on the vertex normal, angle weighted, then
+	   orthogonalized, bitangent sign in w (bitangent = w * cross(n, t));
+	   unlike mikktspace, corners welded together keep one tangent, so
+	   mirrored uv islands need their own vertices for a correct sign
+
+	   both build a key -> corner table with atomic counters, then gather
+	   every key on its own with its corners sorted, so the results do not
+	   depend on the thread count */
+
+	class mesh_attributes final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::mesh_attributes;
+
+			/* size type */
+			using size_type = std::size_t;
+
+			/* index type */
+			using index_type = std::uint32_t;
+
+
+			// -- public constants --------------------------------------------
+
+			/* corners per thread before going parallel */
+			enum : size_type { PARALLEL_THRESHOLD = 64U * 1024U };
+
+			/* smoothing group of the faces before any s statement */
+			enum : index_type { DEFAULT_GROUP = 1U };
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* non-instanciable class */
+			mesh_attributes(void) = delete;
+
+
+			// -- public static methods ---------------------------------------
+
+			/* normals for the corners without one, appended to the normal list
+			   (0 threads: automatic), false on a position index out of range,
+			   D exposes _positions, _normals, _faces and _smoothing */
+			template <typename D>
+			static auto normals(D& data, size_type threads = 0U) -> bool {
+
+				auto& faces = data._faces;
+				const size_type fcount    = faces.size();
+				const size_type positions = data._positions.size();
+
+				const bool missing = std::any_of(faces.begin(), faces.end(), [](const auto& f) noexcept {
+					return f.n1 == 0U || f.n2 == 0U || f.n3 == 0U;
+				});
+
+				if (not missing)
+					return true;
+
+				threads = self::workers(fcount * 3U, threads);
+
+				// -- corner weights and smoothing groups ---------------------
+
+				std::vector<weight> weights(fcount * 3U);
+				std::vector<index_type> groups(fcount, 0U);
+				std::atomic<bool> valid{true};
+
+				const auto& smoothing = data._smoothing;
+
+				engine::parallel::slices(fcount, threads, [&](const size_type, const size_type begin, const size_type end) {
+
+					for (size_type f = begin; f < end; ++f) {
+
+						const auto& face = faces[f];
+
+						if (face.n1 != 0U && face.n2 != 0U && face.n3 != 0U)
+							continue;
+
+						const index_type v[3] { face.v1, face.v2, face.v3 };
+						float p[3][3];
+
+						bool inside = true;
+						for (unsigned int k = 0U; k < 3U; ++k) {
+							if (v[k] == 0U || v[k] > positions) {
+								inside = false;
+								break;
+							}
+							const auto& position = data._positions[v[k] - 1U];
+							p[k][0] = position.x; p[k][1] = position.y; p[k][2] = position.z;
+						}
+
+						if (not inside) {
+							valid.store(false, std::memory_order_relaxed);
+							continue;
+						}
+
+						// last range starting at or before the face
+						const auto it = std::upper_bound(smoothing.begin(), smoothing.end(), f,
+							[](const size_type face, const auto& range) noexcept { return face < range.face; });
+						groups[f] = it == smoothing.begin() ? static_cast<index_type>(DEFAULT_GROUP) : (it - 1)->id;
+
+						self::corner_weights(p, groups[f] == 0U, weights.data() + (f * 3U));
+					}
+				});
+
+				if (not valid.load()) {
+					std::cout << "mesh attributes: error, face index out of range" << std::endl;
+					return false;
+				}
+
+				// -- corners without a normal, by position -------------------
+
+				std::vector<index_type> offsets, list;
+
+				self::table(positions, fcount * 3U, threads, [&faces](const size_type c) noexcept -> index_type {
+					const auto& face = faces[c / 3U];
+					return self::slot(face.n1, face.n2, face.n3, c) == 0U
+						 ? self::slot(face.v1, face.v2, face.v3, c) - 1U : NONE;
+				}, offsets, list);
+
+				// group then corner order, flat corners by normal first
+				auto sorted = [&](const size_type p) -> void {
+					std::sort(list.begin() + offsets[p], list.begin() + offsets[p + 1U],
+						[&groups, &weights](const index_type a, const index_type b) noexcept {
+							const index_type ga = groups[a / 3U], gb = groups[b / 3U];
+							if (ga != gb)
+								return ga < gb;
+							if (ga == 0U)
+								for (unsigned int i = 0U; i < 3U; ++i)
+									if (weights[a].value[i] != weights[b].value[i])
+										return weights[a].value[i] < weights[b].value[i];
+							return a < b;
+						});
+				};
+
+				// one normal per run: a smoothing group, or coplanar flat corners
+				auto joined = [&groups, &weights](const index_type a, const index_type b) noexcept -> bool {
+					const index_type ga = groups[a / 3U];
+					return ga == groups[b / 3U] && (ga != 0U || (weights[a].value[0] == weights[b].value[0]
+															  && weights[a].value[1] == weights[b].value[1]
+															  && weights[a].value[2] == weights[b].value[2]));
+				};
+
+				const size_type count = threads < positions ? threads : (positions != 0U ? positions : 1U);
+				std::vector<size_type> totals(count + 1U, 0U);
+
+				engine::parallel::slices(positions, count, [&](const size_type slice, const size_type begin, const size_type end) {
+
+					size_type total = 0U;
+
+					for (size_type p = begin; p < end; ++p) {
+						sorted(p);
+						for (index_type i = offsets[p]; i < offsets[p + 1U]; ++i)
+							total += (i == offsets[p] || not joined(list[i - 1U], list[i])) ? 1U : 0U;
+					}
+					totals[slice + 1U] = total;
+				});
+
+				for (size_type i = 0U; i < count; ++i)
+					totals[i + 1U] += totals[i];
+
+				const size_type base = data._normals.size();
+				data._normals.resize(base + totals[count]);
+
+				// -- sum each run, point its corners at the result -----------
+
+				engine::parallel::slices(positions, count, [&](const size_type slice, const size_type begin, const size_type end) {
+
+					size_type id = base + totals[slice];
+
+					for (size_type p = begin; p < end; ++p) {
+
+						index_type i = offsets[p];
+
+						while (i < offsets[p + 1U]) {
+
+							index_type j = i + 1U;
+
+							while (j < offsets[p + 1U] && joined(list[j - 1U], list[j]))
+								++j;
+
+							float n[3] { 0.0f, 0.0f, 0.0f };
+							for (index_type k = i; k < j; ++k)
+								for (unsigned int a = 0U; a < 3U; ++a)
+									n[a] += weights[list[k]].value[a];
+
+							self::normalize(n);
+							data._normals[id] = simd::float3{n[0], n[1], n[2]};
+
+							// distinct members of the face, one writer each
+							for (index_type k = i; k < j; ++k) {
+								auto& face = faces[list[k] / 3U];
+								auto& slot = list[k] % 3U == 0U ? face.n1 : list[k] % 3U == 1U ? face.n2 : face.n3;
+								slot = static_cast<index_type>(id + 1U);
+							}
+
+							++id;
+							i = j;
+						}
+					}
+				});
+
+				return true;
+			}
+
+			/* tangents of the welded vertices from their normals and texture
+			   coordinates (0 threads: automatic) */
+			static auto tangents(engine::model& model, size_type threads = 0U) -> void {
+
+				const auto& [vertices, indexes] = model.package;
+				const size_type icount = indexes.size() - (indexes.size() % 3U);
+
+				threads = self::workers(icount, threads);
+
+				// -- angle weighted face frames, per corner ------------------
+
+				std::vector<frame> frames(icount);
+
+				engine::parallel::slices(icount / 3U, threads, [&](const size_type, const size_type begin, const size_type end) {
+					for (size_type t = begin; t < end; ++t)
+						self::corner_frames(vertices[indexes[(t * 3U)]], vertices[indexes[(t * 3U) + 1U]],
+											vertices[indexes[(t * 3U) + 2U]], frames.data() + (t * 3U));
+				});
+
+				// -- corners by vertex ---------------------------------------
+
+				std::vector<index_type> offsets, list;
+
+				self::table(vertices.size(), icount, threads, [&indexes](const size_type c) noexcept -> index_type {
+					return indexes[c];
+				}, offsets, list);
+
+				model.tangents.resize(vertices.size());
+
+				engine::parallel::slices(vertices.size(), threads, [&](const size_type, const size_type begin, const size_type end) {
+
+					for (size_type v = begin; v < end; ++v) {
+
+						std::sort(list.begin() + offsets[v], list.begin() + offsets[v + 1U]);
+
+						float t[3] { 0.0f, 0.0f, 0.0f }, b[3] { 0.0f, 0.0f, 0.0f };
+
+						for (index_type i = offsets[v]; i < offsets[v + 1U]; ++i)
+							for (unsigned int a = 0U; a < 3U; ++a) {
+								t[a] += frames[list[i]].tangent[a];
+								b[a] += frames[list[i]].bitangent[a];
+							}
+
+						model.tangents[v] = self::orthogonalize(vertices[v], t, b);
+					}
+				});
+			}
+
+
+		private:
+
+			// -- private constants -------------------------------------------
+
+			/* corner left out of a table */
+			static constexpr index_type NONE = 0xffffffffU;
+
+			/* smallest length normalized */
+			static constexpr float EPSILON = 1e-20f;
+
+
+			// -- W E I G H T -------------------------------------------------
+
+			/* face normal scaled by twice the face area and the corner angle */
+			struct weight final {
+
+				/* value */
+				float value[3];
+			};
+
+
+			// -- F R A M E ---------------------------------------------------
+
+			/* unit face tangent and bitangent projected on the corner normal, scaled by the corner angle */
+			struct frame final {
+
+				/* tangent */
+				float tangent[3];
+
+				/* bitangent */
+				float bitangent[3];
+			};
+
+
+			// -- private static methods --------------------------------------
+
+			/* thread count for an amount of corners (0: automatic) */
+			static inline auto workers(const size_type corners, const size_type threads) noexcept -> size_type {
+				if (threads != 0U)
+					return threads;
+				const size_type wanted = (corners / PARALLEL_THRESHOLD) + 1U;
+				return wanted < engine::parallel::concurrency() ? wanted : engine::parallel::concurrency();
+			}
+
+			/* value of corner c among a face's three slots */
+			static inline auto slot(const index_type a, const index_type b, const index_type c,
+									const size_type corner) noexcept -> index_type {
+				return corner % 3U == 0U ? a : corner % 3U == 1U ? b : c;
+			}
+
+			/* corners grouped by key, key k owns list[offsets[k]] to list[offsets[k + 1]] (unordered),
+			   corners whose key is NONE are left out */
+			template <typename K>
+			static auto table(const size_type keys, const size_type corners, const size_type threads, K&& key,
+							  std::vector<index_type>& offsets, std::vector<index_type>& list) -> void {
+
+				std::vector<std::atomic<index_type>> cursors(keys);
+
+				for (auto& c : cursors)
+					c.store(0U, std::memory_order_relaxed);
+
+				// count
+				engine::parallel::slices(corners, threads, [&](const size_type, const size_type begin, const size_type end) {
+					for (size_type c = begin; c < end; ++c) {
+						const index_type k = key(c);
+						if (k != NONE)
+							cursors[k].fetch_add(1U, std::memory_order_relaxed);
+					}
+				});
+
+				// exclusive scan, cursors start at their key offset
+				offsets.assign(keys + 1U, 0U);
+
+				for (size_type k = 0U; k < keys; ++k) {
+					offsets[k + 1U] = offsets[k] + cursors[k].load(std::memory_order_relaxed);
+					cursors[k].store(offsets[k], std::memory_order_relaxed);
+				}
+
+				list.resize(offsets[keys]);
+
+				// scatter
+				engine::parallel::slices(corners, threads, [&](const size_type, const size_type begin, const size_type end) {
+					for (size_type c = begin; c < end; ++c) {
+						const index_type k = key(c);
+						if (k != NONE)
+							list[cursors[k].fetch_add(1U, std::memory_order_relaxed)] = static_cast<index_type>(c);
+					}
+				});
+			}
+
+			/* cross product */
+			static inline auto cross(const float (&a)[3], const float (&b)[3], float (&out)[3]) noexcept -> void {
+				out[0] = (a[1] * b[2]) - (a[2] * b[1]);
+				out[1] = (a[2] * b[0]) - (a[0] * b[2]);
+				out[2] = (a[0] * b[1]) - (a[1] * b[0]);
+			}
+
+			/* dot product */
+			static inline auto dot(const float (&a)[3], const float (&b)[3]) noexcept -> float {
+				return (a[0] * b[0]) + (a[1] * b[1]) + (a[2] * b[2]);
+			}
+
+			/* unit length in place, +y when too short */
+			static inline auto normalize(float (&v)[3]) noexcept -> void {
+				const float length = std::sqrt(self::dot(v, v));
+				if (length * length <= EPSILON) {
+					v[0] = 0.0f; v[1] = 1.0f; v[2] = 0.0f;
+					return;
+				}
+				for (auto& a : v)
+					a /= length;
+			}
+
+			/* angle between two edges from their cross length and dot */
+			static inline auto angle(const float (&a)[3], const float (&b)[3]) noexcept -> float {
+				float c[3];
+				self::cross(a, b, c);
+				return std::atan2(std::sqrt(self::dot(c, c)), self::dot(a, b));
+			}
+
+			/* area and angle weighted face normal at each corner, unit face normal when flat */
+			static auto corner_weights(const float (&p)[3][3], const bool flat, weight* out) noexcept -> void {
+
+				float e[3][3];
+				for (unsigned int k = 0U; k < 3U; ++k)
+					for (unsigned int a = 0U; a < 3U; ++a)
+						e[k][a] = p[(k + 1U) % 3U][a] - p[k][a];
+
+				// length is twice the area, zero on degenerate faces
+				float n[3];
+				self::cross(e[0], e[1], n);
+
+				if (flat) {
+					self::normalize(n);
+					for (unsigned int k = 0U; k < 3U; ++k)
+						out[k] = weight{{n[0], n[1], n[2]}};
+					return;
+				}
+
+				for (unsigned int k = 0U; k < 3U; ++k) {
+
+					// edges leaving corner k
+					const float (&next)[3] = e[k];
+					const float previous[3] { -e[(k + 2U) % 3U][0], -e[(k + 2U) % 3U][1], -e[(k + 2U) % 3U][2] };
+
+					const float a = self::angle(next, previous);
+
+					for (unsigned int i = 0U; i < 3U; ++i)
+						out[k].value[i] = n[i] * a;
+				}
+			}
+
+			/* tangent frame of a face at each corner */
+			static auto corner_frames(const engine::vertex& v0, const engine::vertex& v1,
+									  const engine::vertex& v2, frame* out) noexcept -> void {
+
+				const engine::vertex* v[3] { &v0, &v1, &v2 };
+
+				const float d1[3] { v1.px() - v0.px(), v1.py() - v0.py(), v1.pz() - v0.pz() };
+				const float d2[3] { v2.px() - v0.px(), v2.py() - v0.py(), v2.pz() - v0.pz() };
+
+				const float s1 = v1.tu() - v0.tu(), t1 = v1.tv() - v0.tv();
+				const float s2 = v2.tu() - v0.tu(), t2 = v2.tv() - v0.tv();
+
+				// uv area sign orients the frame, its size does not matter once normalized
+				const float area = (s1 * t2) - (s2 * t1);
+				const float sign = area < 0.0f ? -1.0f : 1.0f;
+
+				float tangent[3], bitangent[3];
+				for (unsigned int a = 0U; a < 3U; ++a) {
+					tangent[a]   = sign * ((t2 * d1[a]) - (t1 * d2[a]));
+					bitangent[a] = sign * ((s1 * d2[a]) - (s2 * d1[a]));
+				}
+
+				const bool degenerate = std::abs(area) <= EPSILON
+									 || self::dot(tangent, tangent) <= EPSILON
+									 || self::dot(bitangent, bitangent) <= EPSILON;
+
+				for (unsigned int k = 0U; k < 3U; ++k) {
+
+					out[k] = frame{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+
+					if (degenerate)
+						continue;
+
+					const float n[3] { v[k]->nx(), v[k]->ny(), v[k]->nz() };
+					const engine::vertex& a = *v[(k + 1U) % 3U];
+					const engine::vertex& b = *v[(k + 2U) % 3U];
+
+					const float next[3]     { a.px() - v[k]->px(), a.py() - v[k]->py(), a.pz() - v[k]->pz() };
+					const float previous[3] { b.px() - v[k]->px(), b.py() - v[k]->py(), b.pz() - v[k]->pz() };
+
+					const float weight = self::angle(next, previous);
+
+					// projected on the corner normal, then unit length
+					float t[3], s[3];
+					const float dt = self::dot(n, tangent), db = self::dot(n, bitangent);
+					for (unsigned int i = 0U; i < 3U; ++i) {
+						t[i] = tangent[i]   - (n[i] * dt);
+						s[i] = bitangent[i] - (n[i] * db);
+					}
+
+					const float lt = std::sqrt(self::dot(t, t)), lb = std::sqrt(self::dot(s, s));
+
+					for (unsigned int i = 0U; i < 3U; ++i) {
+						out[k].tangent[i]   = lt > 0.0f ? (t[i] / lt) * weight : 0.0f;
+						out[k].bitangent[i] = lb > 0.0f ? (s[i] / lb) * weight : 0.0f;
+					}
+				}
+			}
+
+			/* unit tangent orthogonal to the vertex normal, bitangent sign in w */
+			static auto orthogonalize(const engine::vertex& vertex, float (&t)[3], const float (&b)[3]) noexcept -> simd::float4 {
+
+				const float n[3] { vertex.nx(), vertex.ny(), vertex.nz() };
+				const float d = self::dot(n, t);
+
+				for (unsigned int i = 0U; i < 3U; ++i)
+					t[i] -= n[i] * d;
+
+				// no uv gradient: any direction in the tangent plane
+				if (self::dot(t, t) <= EPSILON) {
+					const float axis[3] { std::abs(n[0]) < 0.9f ? 1.0f : 0.0f, std::abs(n[0]) < 0.9f ? 0.0f : 1.0f, 0.0f };
+					const float e = self::dot(n, axis);
+					for (unsigned int i = 0U; i < 3U; ++i)
+						t[i] = axis[i] - (n[i] * e);
+				}
+
+				self::normalize(t);
+
+				float c[3];
+				self::cross(n, t, c);
+
+				return simd::float4{t[0], t[1], t[2], self::dot(c, b) < 0.0f ? -1.0f : 1.0f};
+			}
+
+	};
+
+}
+
+#endif // ENGINE_MESH_ATTRIBUTES_HPP
@@ -3,6 +3,18 @@
 
 #include "mesh.hpp"
 #include "wavefront.hpp"
+#include "cooked_mesh.hpp"
+#include "asset_cooker.hpp"
+#include "material_library.hpp"
+#include "asset_loader.hpp"
+#include "file_watcher.hpp"
+
+#include <unistd.h>
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
 
 
 // -- E N G I N E  N A M E S P A C E ------------------------------------------
@@ -54,7 +66,7 @@ namespace engine {
 
 			// -- public static accessors -------------------------------------
 
-			/* get mesh */
+			/* get mesh (built-in primitive until a requested file is resident) */
 			inline static auto get(const mesh_type index) noexcept -> engine::mesh& {
 				return self::shared()._meshes[index];
 			}
@@ -64,18 +76,314 @@ namespace engine {
 				return shared()._meshes[CUBE];
 			}
 
+			/* no load pending for the slot */
+			inline static auto resident(const mesh_type index) noexcept -> bool {
+				for (const auto& p : self::shared()._pending)
+					if (p.first == index)
+						return false;
+				return true;
+			}
+
+
+			// -- public static modifiers -------------------------------------
+
+			/* swap finished loads into their slots (main thread, once per frame) */
+			static auto poll(void) -> void {
+
+				auto& pending = self::shared()._pending;
+
+				for (auto it = pending.begin(); it != pending.end();) {
+
+					if (not it->second.done()) {
+						++it;
+						continue;
+					}
+
+					try {
+						self::shared()._meshes[it->first] = std::move(it->second.get());
+					} catch (const std::exception& except) {
+						// keep the placeholder
+						std::cout << "mesh library: " << except.what() << std::endl;
+					}
+					it = pending.erase(it);
+				}
+
+				self::shared().reload();
+			}
+
+			/* queue path for the slot, served before lower priorities
+			   (supersedes a load or reload still in flight for the slot) */
+			static auto request(const mesh_type index, const char* path,
+								const engine::asset_loader::priority_type priority = engine::asset_loader::NORMAL) -> void {
+				self::shared().enqueue(index, path, priority);
+			}
+
 
 
 		private:
 
+			// -- private types -----------------------------------------------
+
+			/* load in flight */
+			using pending = std::pair<mesh_type, engine::asset_loader::handle<engine::mesh>>;
+
+
+			// -- R E L O A D E D ---------------------------------------------
+
+			struct reloaded final {
+
+				/* source differs from the cooked file */
+				bool changed;
+
+				/* parsed source */
+				engine::model model;
+
+				/* resolved materials */
+				std::vector<engine::material> materials;
+			};
+
+			/* reload in flight */
+			using reload_type = std::pair<mesh_type, engine::asset_loader::handle<reloaded>>;
+
+
 			// -- private lifecycle -------------------------------------------
 
-			/* default constructor */
-			inline mesh_library(void) noexcept
-			: _meshes{
-				{},
-				engine::mesh{engine::wavefront::parse("assets/cube.obj").first},
-			} {}
+			/* default constructor (slots start with their baked primitive,
+			   the cube file replaces its primitive once resident, if present) */
+			inline mesh_library(void)
+			: _meshes{}, _pending{}, _sources{}, _watcher{}, _reloads{} {
+				for (unsigned int i = 0U; i < NUM_MESHES; ++i)
+					_meshes[i] = self::primitive(static_cast<mesh_type>(i));
+				self::enqueue(CUBE, "assets/cube.obj", engine::asset_loader::VISIBLE);
+			}
+
+
+			// -- private methods ---------------------------------------------
+
+			/* queue load for the slot */
+			auto enqueue(const mesh_type index, const char* path,
+						 const engine::asset_loader::priority_type priority) -> void {
+
+				const std::string source{path};
+				const std::string cooked = engine::cooked_mesh::path(path);
+
+				// no source shipped, trust the cooked file
+				const bool shipped = ::access(path, R_OK) == 0;
+
+				// cooked file stamped with the current source, the source is not read
+				const bool fresh = shipped && engine::asset_cooker::fresh(path);
+
+				// the latest request wins, earlier completions are never swapped in
+				self::retire(index);
+
+				_sources[index] = shipped ? source : std::string{};
+
+				if (shipped)
+					_watcher.watch(source);
+
+				_pending.emplace_back(index,
+					engine::asset_loader::shared().load((shipped && not fresh) ? source : cooked, priority,
+						[source, shipped, fresh](const char* begin, const char* end) -> engine::mesh {
+							if (shipped && not fresh)
+								return self::cook(source.data(), begin, end);
+							// cooked bytes already read, viewed in place
+							return self::load(source.data(), engine::cooked_mesh{begin, end}, shipped);
+						}));
+			}
+
+
+			/* drop the load and reloads in flight for the slot, stop watching
+			   its source unless another slot shares it (main thread) */
+			auto retire(const mesh_type index) -> void {
+
+				std::erase_if(_pending, [index](const pending& p) noexcept { return p.first == index; });
+				std::erase_if(_reloads, [index](const reload_type& r) noexcept { return r.first == index; });
+
+				const std::string source = std::move(_sources[index]);
+				_sources[index].clear();
+
+				if (source.empty())
+					return;
+
+				for (const auto& other : _sources)
+					if (other == source)
+						return;
+
+				_watcher.unwatch(source);
+			}
+
+			/* queue reloads of changed sources, patch finished ones in place (main thread) */
+			auto reload(void) -> void {
+
+				std::vector<std::string> changed;
+				_watcher.changes(changed);
+
+				for (const auto& path : changed)
+					for (unsigned int i = 0U; i < NUM_MESHES; ++i) {
+						if (_sources[i] != path)
+							continue;
+						_reloads.emplace_back(static_cast<mesh_type>(i),
+							engine::asset_loader::shared().load(path, engine::asset_loader::NORMAL,
+								[path](const char* begin, const char* end) -> reloaded {
+									return self::recook(path.data(), begin, end);
+								}));
+					}
+
+				for (auto it = _reloads.begin(); it != _reloads.end();) {
+
+					// first load still in flight, or reload not finished
+					if (not it->second.done() || not self::resident(it->first)) {
+						++it;
+						continue;
+					}
+
+					try {
+						auto& update = it->second.get();
+						if (update.changed) {
+							const auto bytes = _meshes[it->first].update(update.model, std::move(update.materials));
+							std::cout << "mesh library: reloaded " << _sources[it->first]
+									  << " (" << bytes << " bytes uploaded)" << std::endl;
+						}
+					} catch (const std::exception& except) {
+						// keep the current mesh
+						std::cout << "mesh library: " << except.what() << std::endl;
+					}
+					it = _reloads.erase(it);
+				}
+			}
+
+
+			// -- private static methods --------------------------------------
+
+			/* built-in geometry of the slot, generated at compile time */
+			static auto primitive(const mesh_type index) -> engine::mesh {
+
+				switch (index) {
+					case GRID: {
+						static constexpr auto p = engine::primitives::grid<32U>();
+						return engine::mesh{p}; }
+					case CUBE: {
+						static constexpr auto p = engine::primitives::cuboid<1U>();
+						return engine::mesh{p}; }
+					case PLANE: {
+						static constexpr auto p = engine::primitives::grid<1U>();
+						return engine::mesh{p}; }
+					case SPHERE: {
+						static constexpr auto p = engine::primitives::sphere<24U, 48U>();
+						return engine::mesh{p}; }
+					case CYLINDER: {
+						static constexpr auto p = engine::primitives::cylinder<48U>();
+						return engine::mesh{p}; }
+					case CONE: {
+						static constexpr auto p = engine::primitives::cone<48U>();
+						return engine::mesh{p}; }
+					case TORUS: {
+						static constexpr auto p = engine::primitives::torus<24U, 48U>();
+						return engine::mesh{p}; }
+					case CUBOID: {
+						static constexpr auto p = engine::primitives::cuboid<8U>();
+						return engine::mesh{p}; }
+					case ICOSAHEDRON: {
+						static constexpr auto p = engine::primitives::icosahedron();
+						return engine::mesh{p}; }
+					case OCTAHEDRON: {
+						static constexpr auto p = engine::primitives::octahedron();
+						return engine::mesh{p}; }
+					default:
+						return engine::mesh{};
+				}
+			}
+
+			/* parse changed source bytes, unchanged when the cooked file holds their key (worker thread) */
+			static auto recook(const char* path, const char* begin, const char* end) -> reloaded {
+
+				const auto key = engine::asset_cooker::key(begin, end);
+
+				// touched, not modified
+				if (engine::asset_cooker::current(path, key)) {
+					engine::asset_cooker::touch(path, begin, end);
+					return reloaded{false, {}, {}};
+				}
+
+				reloaded result{true, {}, {}};
+
+				// best effort, read-only asset directories still reload
+				engine::asset_cooker::cook(path, begin, end, key, result.model);
+
+				result.materials = self::materials(path, result.model.materials, result.model.libraries);
+				return result;
+			}
+
+			/* cooked mesh from source bytes, cooks them first when the cooked file is missing or stale (worker thread) */
+			static auto cook(const char* path, const char* begin, const char* end) -> engine::mesh {
+
+				const auto key = engine::asset_cooker::key(begin, end);
+
+				{
+					const engine::cooked_mesh cooked{engine::cooked_mesh::path(path).data()};
+
+					if (cooked && cooked.source_hash() == key) {
+						// same bytes under a new time, trusted unhashed next time
+						engine::asset_cooker::touch(path, begin, end);
+						return self::load(path, cooked);
+					}
+				}
+
+				engine::model model;
+
+				// best effort, read-only asset directories still load
+				engine::asset_cooker::cook(path, begin, end, key, model);
+
+				return engine::mesh{model, self::materials(path, model.materials, model.libraries)};
+			}
+
+			/* mesh from a cooked file, an invalid one is cooked again from the source when there is one */
+			static auto load(const char* path, const engine::cooked_mesh& cooked, const bool shipped = false) -> engine::mesh {
+
+				if (not cooked) {
+					if (shipped) {
+						const engine::mapped_file source{path};
+						if (source)
+							return self::cook(path, source.begin(), source.end());
+					}
+					throw std::runtime_error{std::string{"no valid cooked file for "} + path};
+				}
+
+				std::vector<std::string> materials, libraries;
+
+				for (std::size_t i = 0U; i < cooked.material_count(); ++i)
+					materials.emplace_back(cooked.material(i));
+				for (std::size_t i = 0U; i < cooked.library_count(); ++i)
+					libraries.emplace_back(cooked.library(i));
+
+				return engine::mesh{cooked, self::materials(path, materials, libraries)};
+			}
+
+			/* resolve material names against the libraries (paths relative to the source),
+			   unknown names keep the default material */
+			static auto materials(const char* path,
+								  const std::vector<std::string>& names,
+								  const std::vector<std::string>& libraries) -> std::vector<engine::material> {
+
+				const std::string source{path};
+				const auto slash = source.find_last_of('/');
+				const std::string directory = (slash == std::string::npos) ? std::string{} : source.substr(0U, slash + 1U);
+
+				engine::material_library library;
+
+				for (const auto& file : libraries)
+					library.load((file.starts_with('/') ? file : directory + file).data());
+
+				std::vector<engine::material> materials(names.size());
+
+				for (std::size_t i = 0U; i < names.size(); ++i) {
+					const auto* entry = library.find(names[i]);
+					if (entry == nullptr)
+						continue;
+					materials[i].color(entry->diffuse[0], entry->diffuse[1], entry->diffuse[2], entry->opacity);
+				}
+				return materials;
+			}
 
 
 			// -- private instance --------------------------------------------
@@ -92,6 +400,18 @@ namespace engine {
 			/* meshes */
 			engine::mesh _meshes[NUM_MESHES];
 
+			/* loads in flight (main thread only) */
+			std::vector<pending> _pending;
+
+			/* source path by slot (empty: cooked only, not watched) */
+			std::string _sources[NUM_MESHES];
+
+			/* source changes */
+			engine::file_watcher _watcher;
+
+			/* reloads in flight (main thread only) */
+			std::vector<reload_type> _reloads;
+
 	};
 
 }
@@ -0,0 +1,499 @@
+#ifndef ENGINE_MESH_OPTIMIZER_HPP
+#define ENGINE_MESH_OPTIMIZER_HPP
+
+#include "vertex.hpp"
+#include "model.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- M E S H  O P T I M I Z E R ------------------------------------------
+
+	/* reorders triangles for the post-transform vertex cache (tipsify),
+	   then clusters of them for overdraw (outward facing first), then
+	   vertices by first use for fetch locality, each submesh on its own
+	   range (tables and bounds stay valid), measured with a fifo cache
+	   and a direct mapped fetch cache simulation */
+
+	class mesh_optimizer final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::mesh_optimizer;
+
+			/* size type */
+			using size_type = std::size_t;
+
+
+			// -- S T A T I S T I C S -----------------------------------------
+
+			struct statistics final {
+
+				/* average cache miss ratio (transformed vertices per triangle, 0.5 to 3) */
+				double acmr;
+
+				/* average transformed to vertex ratio (1 is ideal) */
+				double atvr;
+
+				/* fetched bytes over referenced vertex bytes (1 is ideal) */
+				double overfetch;
+			};
+
+
+			// -- R E P O R T -------------------------------------------------
+
+			struct report final {
+
+				/* before optimization */
+				statistics before;
+
+				/* after optimization */
+				statistics after;
+			};
+
+
+			// -- public constants --------------------------------------------
+
+			/* simulated post-transform cache entries */
+			static constexpr size_type CACHE_SIZE = 16U;
+
+			/* acmr a cluster may lose to the overdraw order */
+			static constexpr double OVERDRAW_THRESHOLD = 1.05;
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* non-instanciable class */
+			mesh_optimizer(void) = delete;
+
+
+			// -- public static methods ---------------------------------------
+
+			/* fifo post-transform cache and fetch cache simulation */
+			static auto analyze(const unsigned int* indexes, const size_type icount,
+								const size_type vcount, const size_type vertex_size = sizeof(engine::vertex),
+								const size_type cache = CACHE_SIZE) -> statistics {
+
+				if (icount < 3U || vcount == 0U)
+					return statistics{0.0, 0.0, 0.0};
+
+				std::vector<size_type> stamps(vcount, 0U);
+				std::vector<std::uint8_t> seen(vcount, 0U);
+				std::vector<size_type> lines(FETCH_LINES, ~size_type{0U});
+
+				size_type time = cache + 1U;
+				size_type misses = 0U, unique = 0U, fetched = 0U;
+
+				for (size_type i = 0U; i < icount; ++i) {
+
+					const unsigned int v = indexes[i];
+
+					if (seen[v] == 0U) {
+						seen[v] = 1U;
+						++unique;
+					}
+
+					// hit, no shading, no fetch
+					if (time - stamps[v] <= cache)
+						continue;
+
+					stamps[v] = time++;
+					++misses;
+
+					// fetch the lines spanned by the vertex
+					const size_type first = (v * vertex_size) / FETCH_LINE;
+					const size_type last  = ((v * vertex_size) + vertex_size - 1U) / FETCH_LINE;
+
+					for (size_type line = first; line <= last; ++line) {
+						size_type& slot = lines[line % FETCH_LINES];
+						if (slot != line) {
+							slot = line;
+							fetched += FETCH_LINE;
+						}
+					}
+				}
+
+				return statistics{static_cast<double>(misses)  / static_cast<double>(icount / 3U),
+								  static_cast<double>(misses)  / static_cast<double>(unique),
+								  static_cast<double>(fetched) / static_cast<double>(unique * vertex_size)};
+			}
+
+			/* statistics of a model */
+			static auto analyze(const engine::model& model, const size_type cache = CACHE_SIZE) -> statistics {
+				return self::analyze(model.package.second.data(), model.package.second.size(),
+									 model.package.first.size(), sizeof(engine::vertex), cache);
+			}
+
+			/* reorder triangles of [indexes, indexes + icount) for the vertex cache,
+			   append the triangle offsets where the cache was flushed to boundaries */
+			static auto vertex_cache(unsigned int* indexes, const size_type icount, const size_type cache = CACHE_SIZE,
+									 std::vector<size_type>* boundaries = nullptr) -> void {
+
+				const size_type tcount = icount / 3U;
+
+				if (tcount < 2U)
+					return;
+
+				// local numbering, the range may touch few of the model vertices
+				std::vector<unsigned int> local(icount);
+				std::vector<unsigned int> global;
+				global.reserve(icount);
+
+				{
+					std::vector<unsigned int> sorted(indexes, indexes + (tcount * 3U));
+					std::sort(sorted.begin(), sorted.end());
+					sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+					global = std::move(sorted);
+				}
+
+				for (size_type i = 0U; i < tcount * 3U; ++i)
+					local[i] = static_cast<unsigned int>(std::lower_bound(global.begin(), global.end(), indexes[i])
+													   - global.begin());
+
+				const size_type vcount = global.size();
+
+				// vertex to triangle adjacency
+				std::vector<unsigned int> live(vcount, 0U);
+				std::vector<unsigned int> offsets(vcount + 1U, 0U);
+				std::vector<unsigned int> adjacency(tcount * 3U);
+
+				for (size_type i = 0U; i < tcount * 3U; ++i)
+					++live[local[i]];
+
+				for (size_type v = 0U; v < vcount; ++v)
+					offsets[v + 1U] = offsets[v] + live[v];
+
+				{
+					std::vector<unsigned int> fill(offsets.begin(), offsets.end() - 1);
+					for (size_type i = 0U; i < tcount * 3U; ++i)
+						adjacency[fill[local[i]]++] = static_cast<unsigned int>(i / 3U);
+				}
+
+				std::vector<size_type> stamps(vcount, 0U);
+				std::vector<std::uint8_t> emitted(tcount, 0U);
+				std::vector<unsigned int> dead;
+				std::vector<unsigned int> candidates;
+				std::vector<unsigned int> order;
+				order.reserve(tcount * 3U);
+
+				dead.reserve(tcount * 3U);
+
+				size_type time   = cache + 1U;
+				size_type cursor = 0U;
+				long fanning     = 0L;
+
+				while (fanning >= 0L) {
+
+					const auto f = static_cast<unsigned int>(fanning);
+					candidates.clear();
+
+					// emit every live triangle around f
+					for (unsigned int k = offsets[f]; k < offsets[f + 1U]; ++k) {
+
+						const unsigned int t = adjacency[k];
+
+						if (emitted[t] != 0U)
+							continue;
+
+						emitted[t] = 1U;
+
+						for (unsigned int c = 0U; c < 3U; ++c) {
+							const unsigned int v = local[(t * 3U) + c];
+							order.push_back(global[v]);
+							dead.push_back(v);
+							candidates.push_back(v);
+							--live[v];
+							if (time - stamps[v] > cache)
+								stamps[v] = time++;
+						}
+					}
+
+					// next fanning vertex: the oldest candidate still in cache after its fan
+					fanning = -1L;
+					long best = -1L;
+
+					for (const unsigned int n : candidates) {
+						if (live[n] == 0U)
+							continue;
+						long priority = 0L;
+						if (time - stamps[n] + (2U * live[n]) <= cache)
+							priority = static_cast<long>(time - stamps[n]);
+						if (priority > best) {
+							best    = priority;
+							fanning = static_cast<long>(n);
+						}
+					}
+
+					if (fanning != -1L)
+						continue;
+
+					// dead end, the cache is cold again
+					while (not dead.empty()) {
+						const unsigned int d = dead.back();
+						dead.pop_back();
+						if (live[d] != 0U) {
+							fanning = static_cast<long>(d);
+							break;
+						}
+					}
+
+					while (fanning == -1L && cursor < vcount) {
+						if (live[cursor] != 0U)
+							fanning = static_cast<long>(cursor);
+						else
+							++cursor;
+					}
+
+					if (fanning != -1L && boundaries != nullptr)
+						boundaries->push_back(order.size() / 3U);
+				}
+
+				std::copy(order.begin(), order.end(), indexes);
+			}
+
+			/* reorder clusters of a vertex cache ordered range, outward facing first
+			   (view independent), each cluster is split while its acmr stays within threshold */
+			static auto overdraw(unsigned int* indexes, const size_type icount, const engine::vertex* vertices,
+								 const std::vector<size_type>& boundaries, const size_type cache = CACHE_SIZE,
+								 const double threshold = OVERDRAW_THRESHOLD) -> void {
+
+				const size_type tcount = icount / 3U;
+
+				if (tcount < 2U)
+					return;
+
+				std::vector<size_type> stamps(*std::max_element(indexes, indexes + (tcount * 3U)) + 1U, 0U);
+				size_type time = cache + 1U;
+
+				// misses of triangle t, cold after restart (time moved past every stamp)
+				auto misses = [&](const size_type t) noexcept -> size_type {
+					size_type count = 0U;
+					for (size_type c = 0U; c < 3U; ++c) {
+						size_type& stamp = stamps[indexes[(t * 3U) + c]];
+						if (time - stamp > cache) {
+							stamp = time++;
+							++count;
+						}
+					}
+					return count;
+				};
+
+				auto restart = [&](void) noexcept -> void {
+					time += cache + 1U;
+				};
+
+				// hard boundaries (cache flushes), then soft ones inside
+				std::vector<size_type> hard{0U};
+				for (const size_type b : boundaries)
+					if (b > hard.back() && b < tcount)
+						hard.push_back(b);
+				hard.push_back(tcount);
+
+				std::vector<size_type> starts;
+
+				for (size_type h = 0U; h + 1U < hard.size(); ++h) {
+
+					const size_type begin = hard[h];
+					const size_type end   = hard[h + 1U];
+
+					restart();
+					size_type total = 0U;
+					for (size_type t = begin; t < end; ++t)
+						total += misses(t);
+
+					const double limit = threshold * static_cast<double>(total) / static_cast<double>(end - begin);
+
+					restart();
+					starts.push_back(begin);
+					size_type running = 0U;
+
+					for (size_type t = begin; t < end; ++t) {
+						running += misses(t);
+						const size_type span = t + 1U - starts.back();
+						// a cold start here costs no more than the whole cluster, cut
+						if (t + 1U < end && static_cast<double>(running) / static_cast<double>(span) <= limit) {
+							starts.push_back(t + 1U);
+							running = 0U;
+							restart();
+						}
+					}
+				}
+
+				starts.push_back(tcount);
+
+				// cluster centroids and normals, area weighted
+				const size_type ccount = starts.size() - 1U;
+
+				struct cluster final {
+					size_type begin;
+					size_type end;
+					double    sort;
+				};
+
+				std::vector<cluster> clusters(ccount, cluster{0U, 0U, 0.0});
+				std::vector<double> centroids(ccount * 3U, 0.0);
+				std::vector<double> normals(ccount * 3U, 0.0);
+				double mesh[3] { 0.0, 0.0, 0.0 };
+				double mesh_area = 0.0;
+
+				for (size_type c = 0U; c < ccount; ++c) {
+
+					double* centroid = &centroids[c * 3U];
+					double* normal   = &normals[c * 3U];
+					double area      = 0.0;
+
+					for (size_type t = starts[c]; t < starts[c + 1U]; ++t) {
+
+						const auto& a = vertices[indexes[(t * 3U) + 0U]];
+						const auto& b = vertices[indexes[(t * 3U) + 1U]];
+						const auto& d = vertices[indexes[(t * 3U) + 2U]];
+
+						const double e1[3] { b.px() - a.px(), b.py() - a.py(), b.pz() - a.pz() };
+						const double e2[3] { d.px() - a.px(), d.py() - a.py(), d.pz() - a.pz() };
+						const double n[3]  { e1[1] * e2[2] - e1[2] * e2[1],
+											 e1[2] * e2[0] - e1[0] * e2[2],
+											 e1[0] * e2[1] - e1[1] * e2[0] };
+
+						const double w = 0.5 * std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+						centroid[0] += w * (a.px() + b.px() + d.px()) / 3.0;
+						centroid[1] += w * (a.py() + b.py() + d.py()) / 3.0;
+						centroid[2] += w * (a.pz() + b.pz() + d.pz()) / 3.0;
+						normal[0] += n[0];
+						normal[1] += n[1];
+						normal[2] += n[2];
+						area += w;
+					}
+
+					for (unsigned int k = 0U; k < 3U; ++k)
+						mesh[k] += centroid[k];
+					mesh_area += area;
+
+					if (area > 0.0)
+						for (unsigned int k = 0U; k < 3U; ++k)
+							centroid[k] /= area;
+
+					clusters[c] = cluster{starts[c], starts[c + 1U], 0.0};
+				}
+
+				if (mesh_area > 0.0)
+					for (unsigned int k = 0U; k < 3U; ++k)
+						mesh[k] /= mesh_area;
+
+				// how far the cluster faces away from the mesh center
+				for (size_type c = 0U; c < ccount; ++c) {
+					const double* centroid = &centroids[c * 3U];
+					const double* normal   = &normals[c * 3U];
+					const double length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+					if (length > 0.0)
+						clusters[c].sort = ((centroid[0] - mesh[0]) * normal[0]
+										  + (centroid[1] - mesh[1]) * normal[1]
+										  + (centroid[2] - mesh[2]) * normal[2]) / length;
+				}
+
+				std::stable_sort(clusters.begin(), clusters.end(), [](const cluster& a, const cluster& b) noexcept {
+					return a.sort > b.sort;
+				});
+
+				std::vector<unsigned int> order;
+				order.reserve(tcount * 3U);
+
+				for (const auto& c : clusters)
+					order.insert(order.end(), indexes + (c.begin * 3U), indexes + (c.end * 3U));
+
+				std::copy(order.begin(), order.end(), indexes);
+			}
+
+			/* renumber vertices by first use (unreferenced ones last, in order),
+			   returns the new index of every old vertex */
+			static auto vertex_fetch(engine::vpackage& package) -> std::vector<unsigned int> {
+
+				auto& [vertices, indexes] = package;
+
+				constexpr unsigned int UNUSED = ~0U;
+
+				std::vector<unsigned int> remap(vertices.size(), UNUSED);
+				unsigned int next = 0U;
+
+				for (auto& i : indexes) {
+					if (remap[i] == UNUSED)
+						remap[i] = next++;
+					i = remap[i];
+				}
+
+				for (auto& r : remap)
+					if (r == UNUSED)
+						r = next++;
+
+				engine::vertices sorted(vertices.size());
+
+				for (size_type v = 0U; v < vertices.size(); ++v)
+					sorted[remap[v]] = vertices[v];
+
+				vertices = std::move(sorted);
+				return remap;
+			}
+
+			/* optimize a model in place, submesh by submesh */
+			static auto optimize(engine::model& model, const size_type cache = CACHE_SIZE,
+								 const double threshold = OVERDRAW_THRESHOLD) -> report {
+
+				report r{self::analyze(model, cache), {}};
+
+				auto& indexes = model.package.second;
+
+				auto range = [&](const size_type offset, const size_type count) -> void {
+					std::vector<size_type> boundaries;
+					self::vertex_cache(indexes.data() + offset, count, cache, &boundaries);
+					self::overdraw(indexes.data() + offset, count, model.package.first.data(),
+								   boundaries, cache, threshold);
+				};
+
+				if (model.submeshes.empty())
+					range(0U, indexes.size());
+				else
+					for (const auto& sub : model.submeshes)
+						range(sub.index_offset, sub.index_count);
+
+				const auto remap = self::vertex_fetch(model.package);
+
+				// per vertex streams follow
+				if (model.tangents.size() == remap.size()) {
+					engine::tangents sorted(remap.size());
+					for (size_type v = 0U; v < remap.size(); ++v)
+						sorted[remap[v]] = model.tangents[v];
+					model.tangents = std::move(sorted);
+				}
+
+				r.after = self::analyze(model, cache);
+				return r;
+			}
+
+
+		private:
+
+			// -- private constants -------------------------------------------
+
+			/* simulated fetch cache line */
+			static constexpr size_type FETCH_LINE = 64U;
+
+			/* simulated fetch cache lines (direct mapped, 8 KiB) */
+			static constexpr size_type FETCH_LINES = 128U;
+
+	};
+
+}
+
+#endif // ENGINE_MESH_OPTIMIZER_HPP
@@ -0,0 +1,909 @@
+#ifndef ENGINE_MESH_SIMPLIFIER_HPP
+#define ENGINE_MESH_SIMPLIFIER_HPP
+
+#include "vertex.hpp"
+#include "model.hpp"
+#include "mesh_optimizer.hpp"
+#include "parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- M E S H  S I M P L I F I E R ----------------------------------------
+
+	/* lod chain by quadric error edge collapse: a vertex collapses onto one
+	   of its neighbors (no new vertex, levels index the base vertex stream),
+	   quadrics span position, normal and texcoord, borders, uv seams and
+	   material boundaries only slide along themselves, collapses that flip
+	   a face or pinch the surface are refused; collapses run in passes of
+	   independent neighborhoods, cheapest first */
+
+	class mesh_simplifier final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::mesh_simplifier;
+
+			/* size type */
+			using size_type = std::size_t;
+
+
+			// -- public constants --------------------------------------------
+
+			/* levels, each with half the triangles of the previous one */
+			static constexpr size_type MAX_LEVELS = 4U;
+
+			/* smallest level */
+			static constexpr size_type MIN_TRIANGLES = 32U;
+
+			/* normal weight against positions scaled to the unit box */
+			static constexpr double NORMAL_WEIGHT = 0.25;
+
+			/* texcoord weight against positions scaled to the unit box */
+			static constexpr double TEXCOORD_WEIGHT = 0.5;
+
+			/* stiffness of borders, seams and material boundaries */
+			static constexpr double BORDER_WEIGHT = 10.0;
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* non-instanciable class */
+			mesh_simplifier(void) = delete;
+
+
+			// -- public static methods ---------------------------------------
+
+			/* replace the lod chain of a model (run after the mesh optimizer),
+			   the chain stops early on a level that can't be reached */
+			static auto build(engine::model& model, const size_type levels = MAX_LEVELS) -> void {
+
+				model.lods.clear();
+				model.lod_indexes.clear();
+				model.lod_submeshes.clear();
+
+				if (model.package.first.empty() || model.package.second.size() / 3U < MIN_TRIANGLES * 2U)
+					return;
+
+				collapser state{model};
+				size_type previous = state.triangles();
+
+				for (size_type level = 0U; level < levels; ++level) {
+
+					const size_type goal = previous / 2U;
+
+					if (goal < MIN_TRIANGLES)
+						break;
+
+					const bool reached = state.run(goal);
+
+					// stalled, keep the level only when it still saves a quarter
+					if (not reached && state.triangles() * 4U > previous * 3U)
+						break;
+
+					state.emit(model);
+					previous = state.triangles();
+
+					if (not reached)
+						break;
+				}
+			}
+
+			/* lod chains of several models, one model per task */
+			static auto build(engine::model* models, const size_type count,
+							  const size_type levels = MAX_LEVELS) -> void {
+
+				std::atomic<size_type> next{0U};
+
+				engine::parallel::run(std::min(count, engine::parallel::concurrency()), [&](const size_type) {
+					for (size_type i = next++; i < count; i = next++)
+						self::build(models[i], levels);
+				});
+			}
+
+
+		private:
+
+			// -- Q U A D R I C -----------------------------------------------
+
+			/* area weighted sum of squared distances to affine planes of
+			   dimension 2 in N dimensions, x'Ax + 2b'x + c, A symmetric */
+			template <unsigned N>
+			struct quadric final {
+
+				/* packed upper triangle */
+				double a[(N * (N + 1U)) / 2U];
+
+				/* linear term */
+				double b[N];
+
+				/* constant term */
+				double c;
+
+				/* accumulated weight */
+				double w;
+
+				/* plane through p spanned by orthonormal e1, e2 */
+				static auto plane(const double* p, const double* e1, const double* e2,
+								  const double weight) noexcept -> quadric {
+
+					quadric q{};
+
+					double pe1 = 0.0, pe2 = 0.0, pp = 0.0;
+					for (unsigned i = 0U; i < N; ++i) {
+						pe1 += p[i] * e1[i];
+						pe2 += p[i] * e2[i];
+						pp  += p[i] * p[i];
+					}
+
+					unsigned k = 0U;
+					for (unsigned i = 0U; i < N; ++i) {
+						for (unsigned j = i; j < N; ++j, ++k)
+							q.a[k] = weight * ((i == j ? 1.0 : 0.0) - e1[i] * e1[j] - e2[i] * e2[j]);
+						q.b[i] = weight * (pe1 * e1[i] + pe2 * e2[i] - p[i]);
+					}
+
+					q.c = weight * (pp - pe1 * pe1 - pe2 * pe2);
+					q.w = weight;
+					return q;
+				}
+
+				/* accumulate */
+				inline auto operator+=(const quadric& other) noexcept -> quadric& {
+					for (unsigned k = 0U; k < (N * (N + 1U)) / 2U; ++k)
+						a[k] += other.a[k];
+					for (unsigned i = 0U; i < N; ++i)
+						b[i] += other.b[i];
+					c += other.c;
+					w += other.w;
+					return *this;
+				}
+
+				/* error at x (never negative) */
+				inline auto evaluate(const double* x) const noexcept -> double {
+					double r = c;
+					unsigned k = 0U;
+					for (unsigned i = 0U; i < N; ++i) {
+						r += 2.0 * b[i] * x[i];
+						for (unsigned j = i; j < N; ++j, ++k)
+							r += (i == j ? 1.0 : 2.0) * a[k] * x[i] * x[j];
+					}
+					return r > 0.0 ? r : 0.0;
+				}
+			};
+
+			/* position, normal, texcoord */
+			static constexpr unsigned DIMENSIONS = 8U;
+
+			/* attribute quadric (per vertex) */
+			using attribute_quadric = quadric<DIMENSIONS>;
+
+			/* geometric quadric (per position) */
+			using position_quadric = quadric<3U>;
+
+
+			// -- E D G E -----------------------------------------------------
+
+			struct edge final {
+
+				/* neighbor position */
+				unsigned int to;
+
+				/* triangles on the edge */
+				unsigned int count;
+
+				/* border, seam, material boundary or non manifold */
+				bool hard;
+			};
+
+
+			// -- C A N D I D A T E -------------------------------------------
+
+			struct candidate final {
+
+				/* collapse cost */
+				double cost;
+
+				/* collapsed position */
+				unsigned int from;
+
+				/* kept position */
+				unsigned int to;
+			};
+
+
+			// -- C O L L A P S E R -------------------------------------------
+
+			/* working state of one model: positions are identified by their
+			   first vertex, the copies of a position (seams) collapse together */
+
+			class collapser final {
+
+
+				public:
+
+					// -- public types ----------------------------------------
+
+					/* self type */
+					using self = engine::mesh_simplifier::collapser;
+
+
+					// -- public lifecycle ------------------------------------
+
+					/* model constructor */
+					explicit collapser(const engine::model& model)
+					: _base{model}, _count{model.package.first.size()}, _points(_count * DIMENSIONS),
+					  _position(_count), _copy(_count), _target(_count), _alive(_count, 1U),
+					  _attributes(_count, attribute_quadric{}), _geometry(_count, position_quadric{}),
+					  _borders(_count, position_quadric{}), _corners{}, _subs{},
+					  _fan_offsets{}, _fan{}, _scale{1.0}, _error{0.0} {
+
+						self::points();
+						self::positions();
+						self::triangles(model);
+						self::quadrics();
+					}
+
+					/* non-assignable class */
+					non_assignable(collapser);
+
+
+					// -- public accessors ------------------------------------
+
+					/* live triangles */
+					inline auto triangles(void) const noexcept -> size_type {
+						return _subs.size();
+					}
+
+
+					// -- public methods --------------------------------------
+
+					/* collapse down to goal triangles, false when stalled above it */
+					auto run(const size_type goal) -> bool {
+
+						std::vector<candidate> candidates;
+						std::vector<edge> edges, others;
+						std::vector<std::uint8_t> locked;
+
+						while (self::triangles() > goal) {
+
+							self::fans();
+							candidates.clear();
+
+							for (unsigned int u = 0U; u < _count; ++u) {
+
+								if (_position[u] != u || not _alive[u] || _fan_offsets[u] == _fan_offsets[u + 1U])
+									continue;
+
+								self::edges(u, edges);
+
+								size_type hard = 0U;
+								for (const auto& e : edges)
+									hard += e.hard ? 1U : 0U;
+
+								// corners and lone seam copies stay
+								if ((hard != 0U && hard != 2U) || (hard == 0U && _copy[u] != u))
+									continue;
+
+								candidate best{0.0, u, u};
+
+								for (const auto& e : edges) {
+
+									// hard vertices slide along their hard edges
+									if (hard != 0U && not e.hard)
+										continue;
+
+									double cost = 0.0;
+									if (not self::cost(u, e.to, cost))
+										continue;
+
+									if (best.to == u || cost < best.cost)
+										best = candidate{cost, u, e.to};
+								}
+
+								if (best.to != u)
+									candidates.push_back(best);
+							}
+
+							std::sort(candidates.begin(), candidates.end(),
+									  [](const candidate& a, const candidate& b) noexcept -> bool {
+										  return a.cost < b.cost || (a.cost == b.cost && a.from < b.from);
+									  });
+
+							locked.assign(_count, 0U);
+
+							size_type current = self::triangles();
+							size_type applied = 0U;
+
+							for (const auto& c : candidates) {
+
+								if (current <= goal)
+									break;
+
+								if (locked[c.from] || locked[c.to])
+									continue;
+
+								self::edges(c.from, edges);
+								self::edges(c.to, others);
+
+								size_type shared = 0U;
+								for (const auto& e : edges)
+									if (e.to == c.to)
+										shared = e.count;
+
+								if (not self::manifold(edges, others, shared) || self::flips(c.from, c.to))
+									continue;
+
+								self::collapse(c.from, c.to);
+
+								locked[c.from] = locked[c.to] = 1U;
+								for (const auto& e : edges)
+									locked[e.to] = 1U;
+
+								current -= shared;
+								++applied;
+							}
+
+							self::compact();
+
+							if (applied == 0U)
+								return false;
+						}
+						return true;
+					}
+
+					/* append the current triangles to the model lod chain */
+					auto emit(engine::model& model) const -> void {
+
+						const size_type subs   = _base.submeshes.size();
+
+						engine::lod level{static_cast<std::uint32_t>(model.lod_indexes.size()), 0U,
+										  static_cast<float>(_error / _scale), 0U};
+
+						// triangles keep the base order, so stay grouped by submesh
+						size_type t = 0U;
+
+						for (size_type s = 0U; s < (subs == 0U ? 1U : subs); ++s) {
+
+							const size_type offset = model.lod_indexes.size();
+
+							for (; t < _subs.size() && _subs[t] == s; ++t)
+								model.lod_indexes.insert(model.lod_indexes.end(),
+														 _corners.begin() + static_cast<std::ptrdiff_t>(t * 3U),
+														 _corners.begin() + static_cast<std::ptrdiff_t>((t * 3U) + 3U));
+
+							const size_type count = model.lod_indexes.size() - offset;
+
+							engine::mesh_optimizer::vertex_cache(model.lod_indexes.data() + offset, count);
+
+							if (subs != 0U) {
+								engine::submesh sub = _base.submeshes[s];
+								sub.index_offset = static_cast<std::uint32_t>(offset);
+								sub.index_count  = static_cast<std::uint32_t>(count);
+								model.lod_submeshes.push_back(sub);
+							}
+						}
+
+						level.index_count = static_cast<std::uint32_t>(model.lod_indexes.size() - level.index_offset);
+						model.lods.push_back(level);
+					}
+
+
+				private:
+
+					// -- private methods -------------------------------------
+
+					/* vertices scaled to the unit box, attributes weighted */
+					auto points(void) -> void {
+
+						const auto& vertices = _base.package.first;
+						auto box = engine::bounds::at(vertices[0U]);
+						for (const auto& v : vertices)
+							box.expand(v);
+
+						double extent = 0.0;
+						for (unsigned int k = 0U; k < 3U; ++k)
+							extent = std::max(extent, static_cast<double>(box.max[k]) - box.min[k]);
+						_scale = extent > 0.0 ? 1.0 / extent : 1.0;
+
+						for (size_type v = 0U; v < _count; ++v) {
+							const auto& vx = vertices[v];
+							double* p = _points.data() + (v * DIMENSIONS);
+							p[0] = (static_cast<double>(vx.px()) - box.min[0]) * _scale;
+							p[1] = (static_cast<double>(vx.py()) - box.min[1]) * _scale;
+							p[2] = (static_cast<double>(vx.pz()) - box.min[2]) * _scale;
+							p[3] = vx.nx() * NORMAL_WEIGHT;
+							p[4] = vx.ny() * NORMAL_WEIGHT;
+							p[5] = vx.nz() * NORMAL_WEIGHT;
+							p[6] = vx.tu() * TEXCOORD_WEIGHT;
+							p[7] = vx.tv() * TEXCOORD_WEIGHT;
+						}
+					}
+
+					/* position ids (first vertex at the same position), copies linked in a ring */
+					auto positions(void) -> void {
+
+						const auto& vertices = _base.package.first;
+						std::vector<unsigned int> order(_count);
+						std::iota(order.begin(), order.end(), 0U);
+
+						auto less = [&vertices](const unsigned int a, const unsigned int b) noexcept -> bool {
+							const auto& va = vertices[a];
+							const auto& vb = vertices[b];
+							if (va.px() != vb.px()) return va.px() < vb.px();
+							if (va.py() != vb.py()) return va.py() < vb.py();
+							if (va.pz() != vb.pz()) return va.pz() < vb.pz();
+							return a < b;
+						};
+
+						std::sort(order.begin(), order.end(), less);
+
+						for (size_type i = 0U; i < _count;) {
+
+							size_type j = i + 1U;
+							while (j < _count && vertices[order[j]].px() == vertices[order[i]].px()
+											  && vertices[order[j]].py() == vertices[order[i]].py()
+											  && vertices[order[j]].pz() == vertices[order[i]].pz())
+								++j;
+
+							for (size_type k = i; k < j; ++k) {
+								_position[order[k]] = order[i];
+								_copy[order[k]]     = order[(k + 1U) < j ? k + 1U : i];
+							}
+							i = j;
+						}
+
+						std::iota(_target.begin(), _target.end(), 0U);
+					}
+
+					/* working triangles with their submesh, degenerate ones dropped */
+					auto triangles(const engine::model& model) -> void {
+
+						const auto& indexes = model.package.second;
+
+						_corners.reserve(indexes.size());
+						_subs.reserve(indexes.size() / 3U);
+
+						auto range = [&](const size_type offset, const size_type count, const std::uint32_t sub) -> void {
+							for (size_type i = offset; i + 3U <= offset + count; i += 3U) {
+								const unsigned int a = indexes[i], b = indexes[i + 1U], c = indexes[i + 2U];
+								if (_position[a] == _position[b] || _position[b] == _position[c] || _position[a] == _position[c])
+									continue;
+								_corners.insert(_corners.end(), {a, b, c});
+								_subs.push_back(sub);
+							}
+						};
+
+						if (model.submeshes.empty())
+							range(0U, indexes.size(), 0U);
+						else
+							for (size_type s = 0U; s < model.submeshes.size(); ++s)
+								range(model.submeshes[s].index_offset, model.submeshes[s].index_count,
+									  static_cast<std::uint32_t>(s));
+					}
+
+					/* face quadrics, then border planes on hard edges */
+					auto quadrics(void) -> void {
+
+						for (size_type t = 0U; t < _subs.size(); ++t) {
+
+							const unsigned int* c = _corners.data() + (t * 3U);
+							const double* p[3] { self::point(c[0]), self::point(c[1]), self::point(c[2]) };
+
+							double n[3];
+							const double area = self::normal(p[0], p[1], p[2], n) * 0.5;
+
+							if (area <= 0.0)
+								continue;
+
+							double e1[DIMENSIONS], e2[DIMENSIONS], g1[3], g2[3];
+							if (not self::basis<DIMENSIONS>(p[0], p[1], p[2], e1, e2)
+							 || not self::basis<3U>(p[0], p[1], p[2], g1, g2))
+								continue;
+
+							const auto face  = attribute_quadric::plane(p[0], e1, e2, area);
+							const auto plane = position_quadric::plane(p[0], g1, g2, area);
+
+							for (unsigned int k = 0U; k < 3U; ++k) {
+								_attributes[c[k]] += face;
+								_geometry[_position[c[k]]] += plane;
+							}
+						}
+
+						self::fans();
+
+						std::vector<edge> edges;
+
+						for (unsigned int u = 0U; u < _count; ++u) {
+
+							if (_position[u] != u)
+								continue;
+
+							self::edges(u, edges);
+
+							for (const auto& e : edges) {
+
+								if (not e.hard)
+									continue;
+
+								// plane through the edge, perpendicular to one of its faces
+								const double* a = self::point(u);
+								const double* b = self::point(e.to);
+								const double* f = nullptr;
+
+								for (size_type i = _fan_offsets[u]; i < _fan_offsets[u + 1U] && f == nullptr; ++i) {
+									const unsigned int* c = _corners.data() + (_fan[i] * 3U);
+									bool has = false;
+									for (unsigned int k = 0U; k < 3U; ++k)
+										has = has || _position[c[k]] == e.to;
+									if (has)
+										for (unsigned int k = 0U; k < 3U; ++k)
+											if (_position[c[k]] != u && _position[c[k]] != e.to)
+												f = self::point(c[k]);
+								}
+
+								double n[3], d[3];
+								if (f == nullptr || self::normal(a, b, f, n) <= 0.0)
+									continue;
+
+								double length = 0.0;
+								for (unsigned int k = 0U; k < 3U; ++k) {
+									d[k] = b[k] - a[k];
+									length += d[k] * d[k];
+								}
+								length = std::sqrt(length);
+
+								if (length <= 0.0)
+									continue;
+
+								const double norm = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+								for (unsigned int k = 0U; k < 3U; ++k) {
+									d[k] /= length;
+									n[k] /= norm;
+								}
+
+								// planes contain the edge and the face normal
+								_borders[u] += position_quadric::plane(a, d, n, BORDER_WEIGHT * length * length);
+							}
+						}
+					}
+
+					/* triangles around each position */
+					auto fans(void) -> void {
+
+						_fan_offsets.assign(_count + 1U, 0U);
+
+						for (const auto v : _corners)
+							++_fan_offsets[_position[v] + 1U];
+
+						for (size_type i = 0U; i < _count; ++i)
+							_fan_offsets[i + 1U] += _fan_offsets[i];
+
+						_fan.resize(_corners.size());
+						std::vector<size_type> cursor(_fan_offsets.begin(), _fan_offsets.end() - 1);
+
+						for (size_type i = 0U; i < _corners.size(); ++i)
+							_fan[cursor[_position[_corners[i]]]++] = static_cast<unsigned int>(i / 3U);
+					}
+
+					/* edges around a position, by neighbor */
+					auto edges(const unsigned int u, std::vector<edge>& out) const -> void {
+
+						struct side final {
+							unsigned int to, from_copy, to_copy;
+							std::uint32_t sub;
+						};
+
+						thread_local std::vector<side> sides;
+						sides.clear();
+
+						for (size_type i = _fan_offsets[u]; i < _fan_offsets[u + 1U]; ++i) {
+
+							const unsigned int t = _fan[i];
+							const unsigned int* c = _corners.data() + (t * 3U);
+
+							unsigned int own = c[0];
+							for (unsigned int k = 0U; k < 3U; ++k)
+								own = _position[c[k]] == u ? c[k] : own;
+
+							for (unsigned int k = 0U; k < 3U; ++k)
+								if (_position[c[k]] != u)
+									sides.push_back(side{_position[c[k]], own, c[k], _subs[t]});
+						}
+
+						std::sort(sides.begin(), sides.end(), [](const side& a, const side& b) noexcept -> bool {
+							return a.to < b.to;
+						});
+
+						out.clear();
+
+						for (size_type i = 0U; i < sides.size();) {
+
+							size_type j = i + 1U;
+							bool hard = false;
+
+							for (; j < sides.size() && sides[j].to == sides[i].to; ++j)
+								hard = hard || sides[j].from_copy != sides[i].from_copy
+											|| sides[j].to_copy   != sides[i].to_copy
+											|| sides[j].sub       != sides[i].sub;
+
+							const auto count = static_cast<unsigned int>(j - i);
+							out.push_back(edge{sides[i].to, count, hard || count != 2U});
+							i = j;
+						}
+					}
+
+					/* copy pairs of a collapse (every live copy of from needs a copy of to beside it) */
+					auto pairs(const unsigned int from, const unsigned int to,
+							   std::vector<std::pair<unsigned int, unsigned int>>& out) const -> bool {
+
+						out.clear();
+
+						for (size_type i = _fan_offsets[from]; i < _fan_offsets[from + 1U]; ++i) {
+
+							const unsigned int* c = _corners.data() + (_fan[i] * 3U);
+							unsigned int own = 0U, other = 0U;
+							bool found = false;
+
+							for (unsigned int k = 0U; k < 3U; ++k) {
+								own = _position[c[k]] == from ? c[k] : own;
+								if (_position[c[k]] == to) {
+									other = c[k];
+									found = true;
+								}
+							}
+
+							bool known = false;
+							for (auto& p : out)
+								if (p.first == own) {
+									known = true;
+									if (p.second == own && found)
+										p.second = other;
+								}
+
+							if (not known)
+								out.emplace_back(own, found ? other : own);
+						}
+
+						for (const auto& p : out)
+							if (p.second == p.first)
+								return false;
+						return not out.empty();
+					}
+
+					/* attribute error of the copies moved onto their pairs, plus border error */
+					auto cost(const unsigned int from, const unsigned int to, double& out) const -> bool {
+
+						thread_local std::vector<std::pair<unsigned int, unsigned int>> moved;
+
+						if (not self::pairs(from, to, moved))
+							return false;
+
+						out = _borders[from].evaluate(self::point(to));
+						for (const auto& p : moved)
+							out += _attributes[p.first].evaluate(self::point(p.second));
+						return true;
+					}
+
+					/* link condition: the neighbors both ends share are exactly the edge wings */
+					static auto manifold(const std::vector<edge>& from, const std::vector<edge>& to,
+										 const size_type wings) noexcept -> bool {
+
+						// both lists are sorted by neighbor
+						size_type common = 0U, i = 0U, j = 0U;
+
+						while (i < from.size() && j < to.size()) {
+							if (from[i].to < to[j].to) ++i;
+							else if (to[j].to < from[i].to) ++j;
+							else { ++common; ++i; ++j; }
+						}
+						return wings != 0U && common == wings;
+					}
+
+					/* a face around from, not on the edge, would turn over or vanish */
+					auto flips(const unsigned int from, const unsigned int to) const -> bool {
+
+						for (size_type i = _fan_offsets[from]; i < _fan_offsets[from + 1U]; ++i) {
+
+							const unsigned int* c = _corners.data() + (_fan[i] * 3U);
+
+							if (_position[c[0]] == to || _position[c[1]] == to || _position[c[2]] == to)
+								continue;
+
+							const double* before[3];
+							const double* after[3];
+
+							for (unsigned int k = 0U; k < 3U; ++k) {
+								before[k] = self::point(c[k]);
+								after[k]  = _position[c[k]] == from ? self::point(to) : before[k];
+							}
+
+							double n0[3], n1[3];
+							const double a0 = self::normal(before[0], before[1], before[2], n0);
+							const double a1 = self::normal(after[0], after[1], after[2], n1);
+
+							if (a1 <= a0 * 1e-6 || (n0[0] * n1[0] + n0[1] * n1[1] + n0[2] * n1[2]) <= 0.0)
+								return true;
+						}
+						return false;
+					}
+
+					/* collapse from onto to, quadrics merged */
+					auto collapse(const unsigned int from, const unsigned int to) -> void {
+
+						thread_local std::vector<std::pair<unsigned int, unsigned int>> moved;
+						static_cast<void>(self::pairs(from, to, moved));
+
+						const double* p = self::point(to);
+						const double w  = _geometry[from].w;
+
+						if (w > 0.0)
+							_error = std::max(_error, std::sqrt(_geometry[from].evaluate(p) / w));
+
+						for (const auto& m : moved) {
+							_target[m.first] = m.second;
+							_attributes[m.second] += _attributes[m.first];
+						}
+
+						_geometry[to] += _geometry[from];
+						_borders[to]  += _borders[from];
+						_alive[from] = 0U;
+					}
+
+					/* corners moved to their targets, degenerate triangles dropped */
+					auto compact(void) -> void {
+
+						size_type out = 0U;
+
+						for (size_type t = 0U; t < _subs.size(); ++t) {
+
+							unsigned int c[3];
+							for (unsigned int k = 0U; k < 3U; ++k)
+								c[k] = self::resolve(_corners[(t * 3U) + k]);
+
+							if (_position[c[0]] == _position[c[1]] || _position[c[1]] == _position[c[2]]
+							 || _position[c[0]] == _position[c[2]])
+								continue;
+
+							for (unsigned int k = 0U; k < 3U; ++k)
+								_corners[(out * 3U) + k] = c[k];
+							_subs[out++] = _subs[t];
+						}
+
+						_corners.resize(out * 3U);
+						_subs.resize(out);
+					}
+
+					/* final vertex of a collapse chain (path halving) */
+					auto resolve(unsigned int v) noexcept -> unsigned int {
+						while (_target[v] != v) {
+							_target[v] = _target[_target[v]];
+							v = _target[v];
+						}
+						return v;
+					}
+
+					/* scaled point of a vertex */
+					inline auto point(const unsigned int v) const noexcept -> const double* {
+						return _points.data() + (static_cast<size_type>(v) * DIMENSIONS);
+					}
+
+
+					// -- private static methods ------------------------------
+
+					/* unnormalized face normal of the positions, returns its length */
+					static auto normal(const double* a, const double* b, const double* c, double (&n)[3]) noexcept -> double {
+						const double e1[3] { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+						const double e2[3] { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+						n[0] = e1[1] * e2[2] - e1[2] * e2[1];
+						n[1] = e1[2] * e2[0] - e1[0] * e2[2];
+						n[2] = e1[0] * e2[1] - e1[1] * e2[0];
+						return std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+					}
+
+					/* orthonormal basis of the triangle plane over the first N coordinates */
+					template <unsigned N>
+					static auto basis(const double* p, const double* q, const double* r,
+									  double (&e1)[N], double (&e2)[N]) noexcept -> bool {
+
+						double l1 = 0.0;
+						for (unsigned i = 0U; i < N; ++i) {
+							e1[i] = q[i] - p[i];
+							l1 += e1[i] * e1[i];
+						}
+						if (l1 <= 0.0)
+							return false;
+
+						l1 = std::sqrt(l1);
+						double d = 0.0;
+						for (unsigned i = 0U; i < N; ++i) {
+							e1[i] /= l1;
+							d += e1[i] * (r[i] - p[i]);
+						}
+
+						double l2 = 0.0;
+						for (unsigned i = 0U; i < N; ++i) {
+							e2[i] = (r[i] - p[i]) - d * e1[i];
+							l2 += e2[i] * e2[i];
+						}
+						if (l2 <= 0.0)
+							return false;
+
+						l2 = std::sqrt(l2);
+						for (unsigned i = 0U; i < N; ++i)
+							e2[i] /= l2;
+						return true;
+					}
+
+
+					// -- private members -------------------------------------
+
+					/* source model */
+					const engine::model& _base;
+
+					/* vertex count */
+					size_type _count;
+
+					/* scaled vertices, DIMENSIONS per vertex */
+					std::vector<double> _points;
+
+					/* position id by vertex */
+					std::vector<unsigned int> _position;
+
+					/* next copy of the same position */
+					std::vector<unsigned int> _copy;
+
+					/* collapse target by vertex (itself: kept) */
+					std::vector<unsigned int> _target;
+
+					/* live positions */
+					std::vector<std::uint8_t> _alive;
+
+					/* attribute quadrics by vertex */
+					std::vector<attribute_quadric> _attributes;
+
+					/* geometric quadrics by position */
+					std::vector<position_quadric> _geometry;
+
+					/* border quadrics by position */
+					std::vector<position_quadric> _borders;
+
+					/* triangle corners */
+					engine::indexes _corners;
+
+					/* triangle submesh */
+					std::vector<std::uint32_t> _subs;
+
+					/* fan ranges by position */
+					std::vector<size_type> _fan_offsets;
+
+					/* fan triangles */
+					std::vector<unsigned int> _fan;
+
+					/* position scale to the unit box */
+					double _scale;
+
+					/* largest collapse error so far (scaled) */
+					double _error;
+
+			};
+
+	};
+
+}
+
+#endif // ENGINE_MESH_SIMPLIFIER_HPP
@@ -0,0 +1,253 @@
+#ifndef ENGINE_MESHLET_HPP
+#define ENGINE_MESHLET_HPP
+
+#include "vertex.hpp"
+#include "model.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- M E S H L E T -------------------------------------------------------
+
+	/* contiguous run of triangles with its culling data (object space) */
+	struct meshlet final {
+
+		/* first index */
+		std::uint32_t index_offset;
+
+		/* index count */
+		std::uint32_t index_count;
+
+		/* distinct vertices */
+		std::uint32_t vertex_count;
+
+		/* owning submesh */
+		std::uint32_t submesh;
+
+		/* bounding sphere center */
+		float center[3];
+
+		/* bounding sphere radius */
+		float radius;
+
+		/* average facing direction */
+		float cone_axis[3];
+
+		/* sine of the normal cone half angle (1: never backfacing) */
+		float cone_cutoff;
+	};
+
+	static_assert(sizeof(engine::meshlet) == 48U, "meshlet is stored as is in cooked files");
+
+	/* meshlet table */
+	using meshlets = std::vector<engine::meshlet>;
+
+
+	// -- M E S H L E T  B U I L D E R ----------------------------------------
+
+	/* splits each submesh, in index order, into runs of at most MAX_VERTICES
+	   distinct vertices and MAX_TRIANGLES triangles (run after the mesh
+	   optimizer, its order keeps runs compact), faces are oriented by their
+	   vertex normals when present, counter clockwise otherwise */
+
+	class meshlet_builder final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::meshlet_builder;
+
+			/* size type */
+			using size_type = std::size_t;
+
+
+			// -- public constants --------------------------------------------
+
+			/* distinct vertices per meshlet */
+			static constexpr size_type MAX_VERTICES = 64U;
+
+			/* triangles per meshlet */
+			static constexpr size_type MAX_TRIANGLES = 124U;
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* non-instanciable class */
+			meshlet_builder(void) = delete;
+
+
+			// -- public static methods ---------------------------------------
+
+			/* meshlets of a triangle list (whole index range as submesh 0 when the table is empty) */
+			static auto build(const engine::vpackage& package, const engine::submeshes& submeshes) -> engine::meshlets {
+
+				const auto& [vertices, indexes] = package;
+
+				engine::meshlets out;
+
+				if (vertices.empty() || indexes.size() < 3U)
+					return out;
+
+				// meshlet id + 1 that last used each vertex
+				std::vector<std::uint32_t> marks(vertices.size(), 0U);
+
+				auto range = [&](const size_type offset, const size_type count, const std::uint32_t submesh) -> void {
+
+					const size_type end = offset + (count - (count % 3U));
+
+					engine::meshlet current = self::open(offset, submesh);
+
+					for (size_type i = offset; i < end; i += 3U) {
+
+						const unsigned int a = indexes[i], b = indexes[i + 1U], c = indexes[i + 2U];
+						const auto mark = static_cast<std::uint32_t>(out.size() + 1U);
+
+						const size_type added = (marks[a] != mark ? 1U : 0U)
+											  + (marks[b] != mark && b != a ? 1U : 0U)
+											  + (marks[c] != mark && c != a && c != b ? 1U : 0U);
+
+						// full, close and retry the triangle on a fresh meshlet
+						if (current.vertex_count + added > MAX_VERTICES
+						 || (current.index_count / 3U) + 1U > MAX_TRIANGLES) {
+							self::close(current, vertices, indexes);
+							out.push_back(current);
+							current = self::open(i, submesh);
+							i -= 3U;
+							continue;
+						}
+
+						marks[a] = marks[b] = marks[c] = mark;
+						current.vertex_count += static_cast<std::uint32_t>(added);
+						current.index_count  += 3U;
+					}
+
+					if (current.index_count != 0U) {
+						self::close(current, vertices, indexes);
+						out.push_back(current);
+					}
+				};
+
+				if (submeshes.empty())
+					range(0U, indexes.size(), 0U);
+				else
+					for (size_type s = 0U; s < submeshes.size(); ++s)
+						range(submeshes[s].index_offset, submeshes[s].index_count, static_cast<std::uint32_t>(s));
+
+				return out;
+			}
+
+			/* meshlets of a model */
+			static auto build(const engine::model& model) -> engine::meshlets {
+				return self::build(model.package, model.submeshes);
+			}
+
+
+		private:
+
+			// -- private static methods --------------------------------------
+
+			/* empty meshlet at offset */
+			static inline auto open(const size_type offset, const std::uint32_t submesh) noexcept -> engine::meshlet {
+				return engine::meshlet{static_cast<std::uint32_t>(offset), 0U, 0U, submesh,
+									   {0.0f, 0.0f, 0.0f}, 0.0f, {0.0f, 0.0f, 1.0f}, 1.0f};
+			}
+
+			/* bounding sphere and normal cone */
+			static auto close(engine::meshlet& m, const engine::vertices& vertices,
+							  const engine::indexes& indexes) noexcept -> void {
+
+				const unsigned int* first = indexes.data() + m.index_offset;
+				const unsigned int* last  = first + m.index_count;
+
+				// sphere around the box center
+				auto box = engine::bounds::at(vertices[*first]);
+				for (const unsigned int* i = first; i != last; ++i)
+					box.expand(vertices[*i]);
+
+				double center[3];
+				for (unsigned int k = 0U; k < 3U; ++k)
+					center[k] = (static_cast<double>(box.min[k]) + box.max[k]) * 0.5;
+
+				double radius2 = 0.0;
+				for (const unsigned int* i = first; i != last; ++i) {
+					const auto& v = vertices[*i];
+					const double d[3] { v.px() - center[0], v.py() - center[1], v.pz() - center[2] };
+					const double l2 = d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+					radius2 = l2 > radius2 ? l2 : radius2;
+				}
+
+				// unit face normals
+				std::vector<double> normals;
+				normals.reserve(m.index_count);
+				double axis[3] { 0.0, 0.0, 0.0 };
+
+				for (const unsigned int* i = first; i != last; i += 3) {
+
+					const auto& a = vertices[i[0]];
+					const auto& b = vertices[i[1]];
+					const auto& c = vertices[i[2]];
+
+					const double e1[3] { b.px() - a.px(), b.py() - a.py(), b.pz() - a.pz() };
+					const double e2[3] { c.px() - a.px(), c.py() - a.py(), c.pz() - a.pz() };
+					double n[3] { e1[1] * e2[2] - e1[2] * e2[1],
+								  e1[2] * e2[0] - e1[0] * e2[2],
+								  e1[0] * e2[1] - e1[1] * e2[0] };
+
+					const double length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+					if (length == 0.0)
+						continue;
+
+					// authored normals win over winding
+					const double vn[3] { static_cast<double>(a.nx()) + b.nx() + c.nx(),
+										 static_cast<double>(a.ny()) + b.ny() + c.ny(),
+										 static_cast<double>(a.nz()) + b.nz() + c.nz() };
+					const double sign = (n[0] * vn[0] + n[1] * vn[1] + n[2] * vn[2]) < 0.0 ? -1.0 : 1.0;
+
+					for (unsigned int k = 0U; k < 3U; ++k) {
+						n[k] *= sign / length;
+						axis[k] += n[k];
+						normals.push_back(n[k]);
+					}
+				}
+
+				for (unsigned int k = 0U; k < 3U; ++k)
+					m.center[k] = static_cast<float>(center[k]);
+				// float rounding of the center stays inside the sphere
+				m.radius = static_cast<float>(std::sqrt(radius2)) * (1.0f + 1e-5f);
+
+				const double length = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+
+				if (length < 1e-9)
+					return;
+
+				double spread = 1.0;
+				for (size_type i = 0U; i < normals.size(); i += 3U) {
+					const double d = (normals[i] * axis[0] + normals[i + 1U] * axis[1] + normals[i + 2U] * axis[2]) / length;
+					spread = d < spread ? d : spread;
+				}
+
+				for (unsigned int k = 0U; k < 3U; ++k)
+					m.cone_axis[k] = static_cast<float>(axis[k] / length);
+
+				// faces wider than a hemisphere (almost) can always face the camera
+				m.cone_cutoff = spread <= 0.1 ? 1.0f
+							  : static_cast<float>(std::sqrt(1.0 - spread * spread)) * (1.0f + 1e-5f);
+				m.cone_cutoff = m.cone_cutoff > 1.0f ? 1.0f : m.cone_cutoff;
+			}
+
+	};
+
+}
+
+#endif // ENGINE_MESHLET_HPP
@@ -3,6 +3,8 @@
 
 // standard headers
 #include <array>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 
 // metal headers
@@ -71,16 +73,68 @@ namespace mtl {
 			}
 
 
+			// -- public accessors --------------------------------------------
+
+			/* size in bytes */
+			inline auto size(void) const noexcept -> std::size_t {
+				return _buffer != nullptr ? _buffer->length() : 0U;
+			}
+
+			/* cpu copy of the contents (managed storage) */
+			inline auto contents(void) const noexcept -> const void* {
+				return _buffer != nullptr ? _buffer->contents() : nullptr;
+			}
+
+
 			// -- public modifiers --------------------------------------------
 
 			/* set contents */
 			inline auto set_contents(const void* contents, const std::size_t size) noexcept -> void {
-				std::memcpy(_buffer->contents(), contents, size > _buffer->length() ? _buffer->length() : size);
+				const std::size_t bytes = size > _buffer->length() ? _buffer->length() : size;
+				std::memcpy(_buffer->contents(), contents, bytes);
+				_buffer->didModifyRange(NS::Range::Make(0U, bytes));
 			}
 
 			/* set contents */
 			inline auto set_contents(const void* contents) noexcept -> void {
 				std::memcpy(_buffer->contents(), contents, _buffer->length());
+				_buffer->didModifyRange(NS::Range::Make(0U, _buffer->length()));
+			}
+
+			/* overwrite only the blocks that differ from contents (same length),
+			   each run of changed blocks is flushed as one range, return bytes written */
+			inline auto patch(const void* contents) noexcept -> std::size_t {
+
+				auto* dst = static_cast<std::uint8_t*>(_buffer->contents());
+				const auto* src = static_cast<const std::uint8_t*>(contents);
+				const std::size_t length = _buffer->length();
+
+				std::size_t written = 0U;
+
+				for (std::size_t i = 0U; i < length;) {
+
+					// skip equal blocks
+					const std::size_t block = (length - i) < PATCH_BLOCK ? (length - i) : PATCH_BLOCK;
+					if (std::memcmp(dst + i, src + i, block) == 0) {
+						i += block;
+						continue;
+					}
+
+					// extend over differing blocks
+					std::size_t end = i + block;
+					while (end < length) {
+						const std::size_t next = (length - end) < PATCH_BLOCK ? (length - end) : PATCH_BLOCK;
+						if (std::memcmp(dst + end, src + end, next) == 0)
+							break;
+						end += next;
+					}
+
+					std::memcpy(dst + i, src + i, end - i);
+					_buffer->didModifyRange(NS::Range::Make(i, end - i));
+					written += end - i;
+					i = end;
+				}
+				return written;
 			}
 
 
@@ -108,6 +162,12 @@ namespace mtl {
 
 		private:
 
+			// -- private constants -------------------------------------------
+
+			/* patch comparison granularity */
+			static constexpr std::size_t PATCH_BLOCK = 256U;
+
+
 			// -- private members ---------------------------------------------
 
 			/* buffer */
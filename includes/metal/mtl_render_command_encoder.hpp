@@ -104,8 +104,10 @@ namespace mtl {
 			}
 
 			/* draw indexed primitives */
-			inline void draw_indexed_primitives(const MTL::PrimitiveType type, const std::size_t count, const mtl::buffer& buffer) noexcept {
-				_encoder->drawIndexedPrimitives(type, count, MTL::IndexTypeUInt32, buffer, static_cast<std::size_t>(0U));
+			inline void draw_indexed_primitives(const MTL::PrimitiveType type, const std::size_t count, const mtl::buffer& buffer,
+												const MTL::IndexType itype = MTL::IndexTypeUInt32,
+												const std::size_t offset = 0U) noexcept {
+				_encoder->drawIndexedPrimitives(type, count, itype, buffer, offset);
 			}
 
 			/* set fragment bytes */
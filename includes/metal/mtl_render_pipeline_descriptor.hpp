@@ -66,7 +66,7 @@ namespace mtl {
 
 
 
-				static_assert(name == "default_2D" || name == "default_3D", "invalid render pipeline descriptor name");
+				static_assert(name == "default_2D" || name == "default_3D" || name == "compact_3D" || name == "split_3D", "invalid render pipeline descriptor name");
 
 
 				if constexpr (name == "default_3D") {
@@ -77,6 +77,22 @@ namespace mtl {
 					// fragment function
 					descriptor.fragment_function<"fragment_main">();
 				}
+				else if constexpr (name == "compact_3D") {
+					// vertex descriptor
+					descriptor.vertex_descriptor<name>();
+					// vertex function (dequantizes, then same outputs as vertex_main)
+					descriptor.vertex_function<"vertex_compact">();
+					// fragment function
+					descriptor.fragment_function<"fragment_main">();
+				}
+				else if constexpr (name == "split_3D") {
+					// vertex descriptor (two streams, same stage_in as default_3D)
+					descriptor.vertex_descriptor<name>();
+					// vertex function
+					descriptor.vertex_function<"vertex_main">();
+					// fragment function
+					descriptor.fragment_function<"fragment_main">();
+				}
 				else if constexpr (name == "default_2D") {
 					// vertex descriptor
 					descriptor.vertex_descriptor<name>();
@@ -277,7 +293,9 @@ namespace mtl {
 			inline render_pipeline_descriptor_library(void)
 			: _descriptors{
 				mtl::render_pipeline_descriptor::make<"default_2D">(),
-				mtl::render_pipeline_descriptor::make<"default_3D">()} {
+				mtl::render_pipeline_descriptor::make<"default_3D">(),
+				mtl::render_pipeline_descriptor::make<"compact_3D">(),
+				mtl::render_pipeline_descriptor::make<"split_3D">()} {
 			}
 
 
@@ -294,13 +312,17 @@ namespace mtl {
 
 			/* vertex descriptors */
 			xns::literal_map<mtl::render_pipeline_descriptor, "default_2D",
-															  "default_3D"> _descriptors;
+															  "default_3D",
+															  "compact_3D",
+															  "split_3D"> _descriptors;
 
 
 			/* is valid literal */
 			template <xns::basic_string_literal name>
 			static constexpr bool is_valid_literal = name == "default_2D"
-												  || name == "default_3D";
+												  || name == "default_3D"
+												  || name == "compact_3D"
+												  || name == "split_3D";
 
 	};
 
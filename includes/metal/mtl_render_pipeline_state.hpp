@@ -158,7 +158,9 @@ namespace mtl {
 			: _states{
 				//mtl::render_pipeline_state{},
 				mtl::render_pipeline_descriptor_library::pipeline_descriptor<"default_2D">(),
-				mtl::render_pipeline_descriptor_library::pipeline_descriptor<"default_3D">()} {
+				mtl::render_pipeline_descriptor_library::pipeline_descriptor<"default_3D">(),
+				mtl::render_pipeline_descriptor_library::pipeline_descriptor<"compact_3D">(),
+				mtl::render_pipeline_descriptor_library::pipeline_descriptor<"split_3D">()} {
 			}
 
 
@@ -175,7 +177,9 @@ namespace mtl {
 
 			/* render pipeline states */
 			xns::literal_map<mtl::render_pipeline_state, "default_2D",
-														 "default_3D"> _states;
+														 "default_3D",
+														 "compact_3D",
+														 "split_3D"> _states;
 
 	};
 
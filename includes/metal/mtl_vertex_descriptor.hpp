@@ -4,9 +4,11 @@
 
 #include <stdexcept>
 #include <Metal/MTLVertexDescriptor.hpp>
-#include <simd/simd.h>
+#include "simd.hpp"
 
 #include "vertex.hpp"
+#include "compact_vertex.hpp"
+#include "vertex_streams.hpp"
 
 
 // -- M T L  N A M E S P A C E ------------------------------------------------
@@ -108,15 +110,52 @@ namespace mtl {
 				// position
 				descriptor.attribute(0, MTL::VertexFormat::VertexFormatFloat3, 0, 0);
 				// normal
-				descriptor.attribute(1, MTL::VertexFormat::VertexFormatFloat3, 0, sizeof(simd::float3));
+				descriptor.attribute(1, MTL::VertexFormat::VertexFormatFloat3, 0, sizeof(engine::simd::float3));
 				// texture coordinate
-				descriptor.attribute(2, MTL::VertexFormat::VertexFormatFloat2, 0, sizeof(simd::float3) * 2);
+				descriptor.attribute(2, MTL::VertexFormat::VertexFormatFloat2, 0, sizeof(engine::simd::float3) * 2);
 				// stride
 				descriptor.stride(0, sizeof(engine::vertex));
 
 				return descriptor;
 			}
 
+			/* compact 3D (engine::compact_vertex) */
+			static inline auto compact_3D(void) -> mtl::vertex_descriptor {
+				mtl::vertex_descriptor descriptor;
+				// position (unorm16, dequantized in the shader)
+				descriptor.attribute(0, MTL::VertexFormat::VertexFormatUShort4Normalized, 0, 0);
+				// octahedral normal
+				descriptor.attribute(1, MTL::VertexFormat::VertexFormatShort2Normalized, 0, sizeof(std::uint16_t) * 4);
+				// texture coordinate
+				descriptor.attribute(2, MTL::VertexFormat::VertexFormatHalf2, 0, sizeof(std::uint16_t) * 6);
+				// stride
+				descriptor.stride(0, sizeof(engine::compact_vertex));
+
+				return descriptor;
+			}
+
+			/* split 3D (packed positions in buffer 0, engine::vertex_attributes in buffer 6) */
+			static inline auto split_3D(void) -> mtl::vertex_descriptor {
+				mtl::vertex_descriptor descriptor;
+				// position
+				descriptor.attribute(0, MTL::VertexFormat::VertexFormatFloat3, 0, 0);
+				// normal
+				descriptor.attribute(1, MTL::VertexFormat::VertexFormatFloat3, ATTRIBUTE_BUFFER, 0);
+				// texture coordinate
+				descriptor.attribute(2, MTL::VertexFormat::VertexFormatFloat2, ATTRIBUTE_BUFFER, sizeof(float) * 3);
+				// strides
+				descriptor.stride(0, sizeof(float) * 3);
+				descriptor.stride(ATTRIBUTE_BUFFER, sizeof(engine::vertex_attributes));
+
+				return descriptor;
+			}
+
+
+			// -- public constants --------------------------------------------
+
+			/* attribute stream buffer index (after the uniforms and the dequantization) */
+			static constexpr unsigned int ATTRIBUTE_BUFFER = 6U;
+
 
 		private:
 
@@ -196,7 +235,9 @@ namespace mtl {
 			inline vertex_descriptor_library(void)
 			: _descriptors{
 				mtl::vertex_descriptor::default_2D(),
-				mtl::vertex_descriptor::default_3D()} {
+				mtl::vertex_descriptor::default_3D(),
+				mtl::vertex_descriptor::compact_3D(),
+				mtl::vertex_descriptor::split_3D()} {
 			}
 
 
@@ -213,7 +254,9 @@ namespace mtl {
 
 			/* vertex descriptors */
 			xns::literal_map<mtl::vertex_descriptor, "default_2D",
-													 "default_3D"> _descriptors;
+													 "default_3D",
+													 "compact_3D",
+													 "split_3D"> _descriptors;
 
 	};
 
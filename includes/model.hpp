@@ -0,0 +1,132 @@
+#ifndef ENGINE_MODEL_HPP
+#define ENGINE_MODEL_HPP
+
+#include "vertex.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- B O U N D S ---------------------------------------------------------
+
+	/* axis aligned bounding box */
+	struct bounds final {
+
+		/* minimum corner */
+		float min[3];
+
+		/* maximum corner */
+		float max[3];
+
+		/* empty box on one vertex */
+		static inline auto at(const engine::vertex& vertex) noexcept -> engine::bounds {
+			return {{vertex.px(), vertex.py(), vertex.pz()},
+					{vertex.px(), vertex.py(), vertex.pz()}};
+		}
+
+		/* grow to contain vertex */
+		inline auto expand(const engine::vertex& vertex) noexcept -> void {
+			const float p[3] { vertex.px(), vertex.py(), vertex.pz() };
+			for (unsigned int i = 0U; i < 3U; ++i) {
+				min[i] = p[i] < min[i] ? p[i] : min[i];
+				max[i] = p[i] > max[i] ? p[i] : max[i];
+			}
+		}
+	};
+
+
+	// -- S U B M E S H -------------------------------------------------------
+
+	/* index range drawn with one material */
+	struct submesh final {
+
+		/* first index */
+		std::uint32_t index_offset;
+
+		/* index count */
+		std::uint32_t index_count;
+
+		/* material id (NO_MATERIAL: owner default) */
+		std::uint32_t material;
+
+		/* reserved */
+		std::uint32_t reserved;
+
+		/* axis aligned bounds */
+		engine::bounds bounds;
+	};
+
+	/* submesh table */
+	using submeshes = std::vector<engine::submesh>;
+
+
+	// -- L O D ---------------------------------------------------------------
+
+	/* simplified level, a block of the lod index stream split like the base
+	   submesh table (one range per base submesh, same materials) */
+	struct lod final {
+
+		/* first index */
+		std::uint32_t index_offset;
+
+		/* index count */
+		std::uint32_t index_count;
+
+		/* object space distance to the base surface (upper estimate) */
+		float error;
+
+		/* reserved */
+		std::uint32_t reserved;
+	};
+
+	/* lod table, finest first */
+	using lods = std::vector<engine::lod>;
+
+
+	/* per vertex tangents, xyz unit tangent, w bitangent sign (bitangent = w * cross(normal, tangent)) */
+	using tangents = std::vector<simd::float4>;
+
+
+	// -- M O D E L -----------------------------------------------------------
+
+	/* welded mesh with its submesh table, sorted by material, and the
+	   names the material ids refer to (resolved against the libraries) */
+	struct model final {
+
+		/* no material */
+		static constexpr std::uint32_t NO_MATERIAL = 0xffffffffU;
+
+		/* vertices and indexes */
+		engine::vpackage package{};
+
+		/* submesh table */
+		engine::submeshes submeshes{};
+
+		/* material names, by id */
+		std::vector<std::string> materials{};
+
+		/* material library paths (relative to the source) */
+		std::vector<std::string> libraries{};
+
+		/* simplified levels (base excluded) */
+		engine::lods lods{};
+
+		/* level indexes, into the base vertex stream */
+		engine::indexes lod_indexes{};
+
+		/* level submesh tables, submesh count entries per level (empty without a base table) */
+		engine::submeshes lod_submeshes{};
+
+		/* tangents, one per vertex (empty without texture coordinates) */
+		engine::tangents tangents{};
+	};
+
+}
+
+#endif // ENGINE_MODEL_HPP
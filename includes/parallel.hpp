@@ -0,0 +1,80 @@
+#ifndef ENGINE_PARALLEL_HPP
+#define ENGINE_PARALLEL_HPP
+
+#include <thread>
+#include <vector>
+#include <cstddef>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- P A R A L L E L -----------------------------------------------------
+
+	/* fork-join helpers, the calling thread always takes the first task */
+
+	class parallel final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::parallel;
+
+			/* size type */
+			using size_type = std::size_t;
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* non-instanciable class */
+			parallel(void) = delete;
+
+
+			// -- public static methods ---------------------------------------
+
+			/* hardware concurrency (at least one) */
+			static inline auto concurrency(void) noexcept -> size_type {
+				const size_type count = std::thread::hardware_concurrency();
+				return count != 0U ? count : 1U;
+			}
+
+			/* run task(index) for each index in [0, count) on its own thread */
+			template <typename F>
+			static auto run(const size_type count, F&& task) -> void {
+
+				if (count == 0U)
+					return;
+
+				std::vector<std::thread> threads;
+				threads.reserve(count - 1U);
+
+				for (size_type i = 1U; i < count; ++i)
+					threads.emplace_back([&task, i](void) { task(i); });
+
+				task(static_cast<size_type>(0U));
+
+				for (auto& thread : threads)
+					thread.join();
+			}
+
+			/* split [0, size) in count contiguous slices, run task(slice, begin, end) */
+			template <typename F>
+			static auto slices(const size_type size, size_type count, F&& task) -> void {
+
+				count = count == 0U ? 1U : (count > size && size != 0U ? size : count);
+
+				self::run(count, [&task, size, count](const size_type slice) {
+					task(slice, (size * slice) / count, (size * (slice + 1U)) / count);
+				});
+			}
+
+	};
+
+}
+
+#endif // ENGINE_PARALLEL_HPP
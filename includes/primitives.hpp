@@ -0,0 +1,515 @@
+#ifndef ENGINE_PRIMITIVES_HPP
+#define ENGINE_PRIMITIVES_HPP
+
+#include "vertex.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- P R I M I T I V E ---------------------------------------------------
+
+	/* indexed geometry with its sizes in the type, 16-bit indexes when the
+	   vertex count allows it */
+	template <std::size_t V, std::size_t I, typename T = engine::vertex>
+	struct primitive final {
+
+		/* index type */
+		using index_type = std::conditional_t<(V <= 0x10000U), std::uint16_t, std::uint32_t>;
+
+		/* vertices */
+		std::array<T, V> vertices;
+
+		/* indexes */
+		std::array<index_type, I> indexes;
+	};
+
+
+	// -- P R I M I T I V E S -------------------------------------------------
+
+	/* compile time generators, centered on the origin within [-1, 1],
+	   vertices shared except along uv seams and hard edges, faces wound so
+	   cross(b - a, c - a) points outward (front faces for the default
+	   options); bind the result to a static constexpr to bake it in the
+	   binary:  static constexpr auto sphere = primitives::sphere<16U, 32U>(); */
+
+	class primitives final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::primitives;
+
+			/* size type */
+			using size_type = std::size_t;
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* non-instanciable class */
+			primitives(void) = delete;
+
+
+			// -- public static methods ---------------------------------------
+
+			/* N x N quads on the xz plane, facing +y */
+			template <size_type N>
+			static consteval auto grid(void) -> engine::primitive<(N + 1U) * (N + 1U), N * N * 6U> {
+
+				static_assert(N != 0U, "grid needs one cell");
+
+				engine::primitive<(N + 1U) * (N + 1U), N * N * 6U> out{};
+
+				self::sheet<N>(out, 0U, {0.0, 1.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, 0.0);
+
+				size_type k = 0U;
+				self::quads<N>(out, 0U, k);
+				return out;
+			}
+
+			/* grid cell edges as a line list */
+			template <size_type N>
+			static consteval auto grid_lines(void) -> engine::primitive<(N + 1U) * (N + 1U), N * (N + 1U) * 4U> {
+
+				static_assert(N != 0U, "grid needs one cell");
+
+				engine::primitive<(N + 1U) * (N + 1U), N * (N + 1U) * 4U> out{};
+
+				self::sheet<N>(out, 0U, {0.0, 1.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, 0.0);
+
+				size_type k = 0U;
+				for (size_type j = 0U; j <= N; ++j)
+					for (size_type i = 0U; i < N; ++i) {
+						// along x, then along z
+						self::line(out, k, (j * (N + 1U)) + i, (j * (N + 1U)) + i + 1U);
+						self::line(out, k, (i * (N + 1U)) + j, ((i + 1U) * (N + 1U)) + j);
+					}
+				return out;
+			}
+
+			/* box, each face split in N x N quads with its own vertices */
+			template <size_type N>
+			static consteval auto cuboid(void) -> engine::primitive<(N + 1U) * (N + 1U) * 6U, N * N * 36U> {
+
+				static_assert(N != 0U, "cuboid needs one cell per face");
+
+				engine::primitive<(N + 1U) * (N + 1U) * 6U, N * N * 36U> out{};
+
+				// normal, then the face axes with cross(v, u) = normal
+				constexpr double faces[6][3][3] {
+					{{+1.0, 0.0, 0.0}, {0.0, 0.0, +1.0}, {0.0, 1.0, 0.0}},
+					{{-1.0, 0.0, 0.0}, {0.0, 0.0, -1.0}, {0.0, 1.0, 0.0}},
+					{{0.0, +1.0, 0.0}, {+1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}},
+					{{0.0, -1.0, 0.0}, {-1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}},
+					{{0.0, 0.0, +1.0}, {0.0, +1.0, 0.0}, {1.0, 0.0, 0.0}},
+					{{0.0, 0.0, -1.0}, {0.0, -1.0, 0.0}, {1.0, 0.0, 0.0}},
+				};
+
+				size_type k = 0U;
+				for (size_type f = 0U; f < 6U; ++f) {
+					const size_type base = f * (N + 1U) * (N + 1U);
+					self::sheet<N>(out, base, faces[f][0], faces[f][1], faces[f][2], 1.0);
+					self::quads<N>(out, base, k);
+				}
+				return out;
+			}
+
+			/* unit sphere, R rings from pole to pole, S segments around y (seam and pole vertices repeated for uvs) */
+			template <size_type R, size_type S>
+			static consteval auto sphere(void) -> engine::primitive<(R + 1U) * (S + 1U), (R - 1U) * S * 6U> {
+
+				static_assert(R >= 2U && S >= 3U, "sphere needs two rings and three segments");
+
+				engine::primitive<(R + 1U) * (S + 1U), (R - 1U) * S * 6U> out{};
+
+				for (size_type r = 0U; r <= R; ++r)
+					for (size_type s = 0U; s <= S; ++s) {
+						const double theta = (PI * static_cast<double>(r)) / static_cast<double>(R);
+						const double phi   = (2.0 * PI * static_cast<double>(s % S)) / static_cast<double>(S);
+						const double x = self::sine(theta) * self::cosine(phi);
+						const double y = self::cosine(theta);
+						const double z = self::sine(theta) * self::sine(phi);
+						out.vertices[(r * (S + 1U)) + s] = self::make(x, y, z, x, y, z,
+							static_cast<double>(s) / static_cast<double>(S), static_cast<double>(r) / static_cast<double>(R));
+					}
+
+				size_type k = 0U;
+				for (size_type r = 0U; r < R; ++r)
+					for (size_type s = 0U; s < S; ++s) {
+						const size_type a = (r * (S + 1U)) + s;
+						const size_type b = a + S + 1U;
+						// one triangle of each pole quad collapses
+						if (r != 0U)
+							self::triangle(out, k, a, a + 1U, b);
+						if (r + 1U != R)
+							self::triangle(out, k, a + 1U, b + 1U, b);
+					}
+				return out;
+			}
+
+			/* cylinder of radius 1 along y, S segments, capped */
+			template <size_type S>
+			static consteval auto cylinder(void) -> engine::primitive<((S + 1U) * 2U) + ((S + 1U) * 2U), S * 12U> {
+
+				static_assert(S >= 3U, "cylinder needs three segments");
+
+				engine::primitive<((S + 1U) * 2U) + ((S + 1U) * 2U), S * 12U> out{};
+
+				// side, top then bottom row
+				for (size_type s = 0U; s <= S; ++s) {
+					const double phi = (2.0 * PI * static_cast<double>(s % S)) / static_cast<double>(S);
+					const double c = self::cosine(phi), n = self::sine(phi);
+					const double u = static_cast<double>(s) / static_cast<double>(S);
+					out.vertices[s]           = self::make(c, +1.0, n, c, 0.0, n, u, 0.0);
+					out.vertices[S + 1U + s]  = self::make(c, -1.0, n, c, 0.0, n, u, 1.0);
+				}
+
+				size_type k = 0U;
+				for (size_type s = 0U; s < S; ++s) {
+					self::triangle(out, k, s, s + 1U, S + 1U + s);
+					self::triangle(out, k, s + 1U, S + 2U + s, S + 1U + s);
+				}
+
+				self::cap<S>(out, (S + 1U) * 2U, +1.0, k);
+				self::cap<S>(out, ((S + 1U) * 2U) + S + 1U, -1.0, k);
+				return out;
+			}
+
+			/* cone of radius 1 from y = -1 to its apex at y = 1, S segments, capped */
+			template <size_type S>
+			static consteval auto cone(void) -> engine::primitive<(S + 1U) + S + (S + 1U), S * 6U> {
+
+				static_assert(S >= 3U, "cone needs three segments");
+
+				engine::primitive<(S + 1U) + S + (S + 1U), S * 6U> out{};
+
+				// slope normal of a height 2, radius 1 cone
+				const double ny = 1.0 / self::root(5.0);
+				const double nr = 2.0 / self::root(5.0);
+
+				// base ring, then one apex per segment (normal halfway)
+				for (size_type s = 0U; s <= S; ++s) {
+					const double phi = (2.0 * PI * static_cast<double>(s % S)) / static_cast<double>(S);
+					const double c = self::cosine(phi), n = self::sine(phi);
+					out.vertices[s] = self::make(c, -1.0, n, c * nr, ny, n * nr, static_cast<double>(s) / static_cast<double>(S), 1.0);
+				}
+
+				for (size_type s = 0U; s < S; ++s) {
+					const double phi = (2.0 * PI * (static_cast<double>(s) + 0.5)) / static_cast<double>(S);
+					out.vertices[S + 1U + s] = self::make(0.0, 1.0, 0.0, self::cosine(phi) * nr, ny, self::sine(phi) * nr,
+														  (static_cast<double>(s) + 0.5) / static_cast<double>(S), 0.0);
+				}
+
+				size_type k = 0U;
+				for (size_type s = 0U; s < S; ++s)
+					self::triangle(out, k, S + 1U + s, s + 1U, s);
+
+				self::cap<S>(out, (S + 1U) + S, -1.0, k);
+				return out;
+			}
+
+			/* torus around y, tube radius 0.25 on a 0.75 circle, R segments around the tube, S around y */
+			template <size_type R, size_type S>
+			static consteval auto torus(void) -> engine::primitive<(R + 1U) * (S + 1U), R * S * 6U> {
+
+				static_assert(R >= 3U && S >= 3U, "torus needs three segments each way");
+
+				engine::primitive<(R + 1U) * (S + 1U), R * S * 6U> out{};
+
+				constexpr double major = 0.75, minor = 0.25;
+
+				for (size_type r = 0U; r <= R; ++r)
+					for (size_type s = 0U; s <= S; ++s) {
+						const double v = (2.0 * PI * static_cast<double>(r % R)) / static_cast<double>(R);
+						const double u = (2.0 * PI * static_cast<double>(s % S)) / static_cast<double>(S);
+						const double cu = self::cosine(u), su = self::sine(u);
+						const double cv = self::cosine(v), sv = self::sine(v);
+						out.vertices[(r * (S + 1U)) + s] = self::make(
+							(major + (minor * cv)) * cu, minor * sv, (major + (minor * cv)) * su,
+							cv * cu, sv, cv * su,
+							static_cast<double>(s) / static_cast<double>(S), static_cast<double>(r) / static_cast<double>(R));
+					}
+
+				size_type k = 0U;
+				for (size_type r = 0U; r < R; ++r)
+					for (size_type s = 0U; s < S; ++s) {
+						const size_type a = (r * (S + 1U)) + s;
+						const size_type b = a + S + 1U;
+						self::triangle(out, k, a, b, a + 1U);
+						self::triangle(out, k, a + 1U, b, b + 1U);
+					}
+				return out;
+			}
+
+			/* regular icosahedron inscribed in the unit sphere */
+			static consteval auto icosahedron(void) -> engine::primitive<12U, 60U> {
+
+				engine::primitive<12U, 60U> out{};
+
+				const double t = (1.0 + self::root(5.0)) / 2.0;
+				const double l = self::root(1.0 + (t * t));
+
+				constexpr double corners[12][3] {
+					{-1.0, +1.0, 0.0}, {+1.0, +1.0, 0.0}, {-1.0, -1.0, 0.0}, {+1.0, -1.0, 0.0},
+					{0.0, -1.0, +1.0}, {0.0, +1.0, +1.0}, {0.0, -1.0, -1.0}, {0.0, +1.0, -1.0},
+					{+1.0, 0.0, -1.0}, {+1.0, 0.0, +1.0}, {-1.0, 0.0, -1.0}, {-1.0, 0.0, +1.0},
+				};
+
+				// unit coordinate on the short axis, golden ratio on the long one
+				for (size_type i = 0U; i < 12U; ++i) {
+					double p[3];
+					for (size_type c = 0U; c < 3U; ++c) {
+						const bool longer = (i < 4U && c == 1U) || (i >= 4U && i < 8U && c == 2U) || (i >= 8U && c == 0U);
+						p[c] = (corners[i][c] * (longer ? t : 1.0)) / l;
+					}
+					out.vertices[i] = self::make(p[0], p[1], p[2], p[0], p[1], p[2],
+												 0.5 + (0.5 * p[0]), 0.5 - (0.5 * p[1]));
+				}
+
+				constexpr size_type faces[20][3] {
+					{0, 11, 5}, {0, 5, 1}, {0, 1, 7}, {0, 7, 10}, {0, 10, 11},
+					{1, 5, 9}, {5, 11, 4}, {11, 10, 2}, {10, 7, 6}, {7, 1, 8},
+					{3, 9, 4}, {3, 4, 2}, {3, 2, 6}, {3, 6, 8}, {3, 8, 9},
+					{4, 9, 5}, {2, 4, 11}, {6, 2, 10}, {8, 6, 7}, {9, 8, 1},
+				};
+
+				size_type k = 0U;
+				for (const auto& f : faces)
+					self::outward(out, k, f[0], f[1], f[2]);
+				return out;
+			}
+
+			/* regular octahedron inscribed in the unit sphere */
+			static consteval auto octahedron(void) -> engine::primitive<6U, 24U> {
+
+				engine::primitive<6U, 24U> out{};
+
+				constexpr double corners[6][3] {
+					{+1.0, 0.0, 0.0}, {-1.0, 0.0, 0.0}, {0.0, +1.0, 0.0},
+					{0.0, -1.0, 0.0}, {0.0, 0.0, +1.0}, {0.0, 0.0, -1.0},
+				};
+
+				for (size_type i = 0U; i < 6U; ++i) {
+					const auto& p = corners[i];
+					out.vertices[i] = self::make(p[0], p[1], p[2], p[0], p[1], p[2],
+												 0.5 + (0.5 * p[0]), 0.5 - (0.5 * p[1]));
+				}
+
+				size_type k = 0U;
+				for (const size_type y : {2U, 3U})
+					for (const size_type x : {0U, 1U})
+						for (const size_type z : {4U, 5U})
+							self::outward(out, k, x, y, z);
+				return out;
+			}
+
+			/* unit disc of S segments in the xy plane (2D vertices, fan around the center) */
+			template <size_type S>
+			static consteval auto circle(void) -> engine::primitive<S + 1U, S * 3U, engine::vertex_2D> {
+
+				static_assert(S >= 3U, "circle needs three segments");
+
+				engine::primitive<S + 1U, S * 3U, engine::vertex_2D> out{};
+
+				out.vertices[0U] = engine::vertex_2D{0.0f, 0.0f};
+
+				for (size_type s = 0U; s < S; ++s) {
+					const double angle = (2.0 * PI * static_cast<double>(s)) / static_cast<double>(S);
+					out.vertices[s + 1U] = engine::vertex_2D{static_cast<float>(self::cosine(angle)),
+															 static_cast<float>(self::sine(angle))};
+				}
+
+				// inverse index order
+				size_type k = 0U;
+				for (size_type s = 0U; s < S; ++s)
+					self::triangle(out, k, 0U, ((s + 1U) % S) + 1U, s + 1U);
+				return out;
+			}
+
+
+		private:
+
+			// -- private constants -------------------------------------------
+
+			/* pi */
+			static constexpr double PI = 3.14159265358979323846;
+
+
+			// -- private static methods --------------------------------------
+
+			/* sine, reduced to [-pi/2, pi/2] then taylor series */
+			static constexpr auto sine(double x) noexcept -> double {
+
+				const double turns = x / (2.0 * PI);
+				x -= 2.0 * PI * static_cast<double>(static_cast<long long>(turns + (turns < 0.0 ? -0.5 : 0.5)));
+
+				if (x > PI / 2.0)
+					x = PI - x;
+				else if (x < -PI / 2.0)
+					x = -PI - x;
+
+				double term = x, sum = x;
+				for (int n = 1; n < 12; ++n) {
+					term *= -(x * x) / static_cast<double>((2 * n) * ((2 * n) + 1));
+					sum  += term;
+				}
+				return sum;
+			}
+
+			/* cosine */
+			static constexpr auto cosine(const double x) noexcept -> double {
+				return self::sine(x + (PI / 2.0));
+			}
+
+			/* square root, newton iterations */
+			static constexpr auto root(const double x) noexcept -> double {
+
+				if (x <= 0.0)
+					return 0.0;
+
+				double r = x > 1.0 ? x : 1.0;
+				for (int i = 0; i < 64; ++i) {
+					const double next = 0.5 * (r + (x / r));
+					if (next == r)
+						break;
+					r = next;
+				}
+				return r;
+			}
+
+			/* vertex from doubles */
+			static constexpr auto make(const double px, const double py, const double pz,
+									   const double nx, const double ny, const double nz,
+									   const double tu, const double tv) noexcept -> engine::vertex {
+				return engine::vertex{static_cast<float>(px), static_cast<float>(py), static_cast<float>(pz),
+									  static_cast<float>(nx), static_cast<float>(ny), static_cast<float>(nz),
+									  static_cast<float>(tu), static_cast<float>(tv)};
+			}
+
+			/* append triangle */
+			template <typename P>
+			static constexpr auto triangle(P& out, size_type& k, const size_type a,
+										   const size_type b, const size_type c) noexcept -> void {
+				using index = typename P::index_type;
+				out.indexes[k++] = static_cast<index>(a);
+				out.indexes[k++] = static_cast<index>(b);
+				out.indexes[k++] = static_cast<index>(c);
+			}
+
+			/* append line */
+			template <typename P>
+			static constexpr auto line(P& out, size_type& k, const size_type a, const size_type b) noexcept -> void {
+				using index = typename P::index_type;
+				out.indexes[k++] = static_cast<index>(a);
+				out.indexes[k++] = static_cast<index>(b);
+			}
+
+			/* append triangle, turned so its face points away from the origin */
+			template <typename P>
+			static constexpr auto outward(P& out, size_type& k, const size_type a,
+										  const size_type b, const size_type c) noexcept -> void {
+
+				const auto& va = out.vertices[a];
+				const auto& vb = out.vertices[b];
+				const auto& vc = out.vertices[c];
+
+				const double e1[3] { vb.px() - va.px(), vb.py() - va.py(), vb.pz() - va.pz() };
+				const double e2[3] { vc.px() - va.px(), vc.py() - va.py(), vc.pz() - va.pz() };
+				const double n[3] { (e1[1] * e2[2]) - (e1[2] * e2[1]),
+									(e1[2] * e2[0]) - (e1[0] * e2[2]),
+									(e1[0] * e2[1]) - (e1[1] * e2[0]) };
+
+				const double facing = (n[0] * (va.px() + vb.px() + vc.px()))
+									+ (n[1] * (va.py() + vb.py() + vc.py()))
+									+ (n[2] * (va.pz() + vb.pz() + vc.pz()));
+
+				if (facing >= 0.0)
+					self::triangle(out, k, a, b, c);
+				else
+					self::triangle(out, k, a, c, b);
+			}
+
+			/* (N + 1)^2 vertices at base: offset along normal, u and v from -1 to 1 */
+			template <size_type N, typename P>
+			static constexpr auto sheet(P& out, const size_type base, const double (&normal)[3],
+										const double (&u)[3], const double (&v)[3], const double offset) noexcept -> void {
+
+				for (size_type j = 0U; j <= N; ++j)
+					for (size_type i = 0U; i <= N; ++i) {
+
+						const double a = ((2.0 * static_cast<double>(i)) / static_cast<double>(N)) - 1.0;
+						const double b = ((2.0 * static_cast<double>(j)) / static_cast<double>(N)) - 1.0;
+
+						double p[3];
+						for (size_type c = 0U; c < 3U; ++c)
+							p[c] = (normal[c] * offset) + (u[c] * a) + (v[c] * b);
+
+						out.vertices[base + (j * (N + 1U)) + i] = self::make(p[0], p[1], p[2],
+							normal[0], normal[1], normal[2],
+							static_cast<double>(i) / static_cast<double>(N), static_cast<double>(j) / static_cast<double>(N));
+					}
+			}
+
+			/* two triangles per cell of a sheet whose axes satisfy cross(v, u) = normal */
+			template <size_type N, typename P>
+			static constexpr auto quads(P& out, const size_type base, size_type& k) noexcept -> void {
+				for (size_type j = 0U; j < N; ++j)
+					for (size_type i = 0U; i < N; ++i) {
+						const size_type a = base + (j * (N + 1U)) + i;
+						const size_type c = a + N + 1U;
+						self::triangle(out, k, a, c, a + 1U);
+						self::triangle(out, k, a + 1U, c, c + 1U);
+					}
+			}
+
+			/* disc at height y facing sign(y): center then S rim vertices at base */
+			template <size_type S, typename P>
+			static constexpr auto cap(P& out, const size_type base, const double y, size_type& k) noexcept -> void {
+
+				const double ny = y > 0.0 ? 1.0 : -1.0;
+
+				out.vertices[base] = self::make(0.0, y, 0.0, 0.0, ny, 0.0, 0.5, 0.5);
+
+				for (size_type s = 0U; s < S; ++s) {
+					const double phi = (2.0 * PI * static_cast<double>(s)) / static_cast<double>(S);
+					const double c = self::cosine(phi), n = self::sine(phi);
+					out.vertices[base + 1U + s] = self::make(c, y, n, 0.0, ny, 0.0, 0.5 + (0.5 * c), 0.5 + (0.5 * n));
+				}
+
+				for (size_type s = 0U; s < S; ++s) {
+					const size_type a = base + 1U + s;
+					const size_type b = base + 1U + ((s + 1U) % S);
+					self::outward_cap(out, k, base, a, b, ny);
+				}
+			}
+
+			/* cap triangle wound to face ny */
+			template <typename P>
+			static constexpr auto outward_cap(P& out, size_type& k, const size_type center,
+											  const size_type a, const size_type b, const double ny) noexcept -> void {
+				const auto& vc = out.vertices[center];
+				const auto& va = out.vertices[a];
+				const auto& vb = out.vertices[b];
+				// y of cross(a - center, b - center)
+				const double y = ((va.pz() - vc.pz()) * (vb.px() - vc.px())) - ((va.px() - vc.px()) * (vb.pz() - vc.pz()));
+				if ((y >= 0.0) == (ny > 0.0))
+					self::triangle(out, k, center, a, b);
+				else
+					self::triangle(out, k, center, b, a);
+			}
+
+	};
+
+}
+
+#endif // ENGINE_PRIMITIVES_HPP
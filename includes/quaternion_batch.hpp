@@ -0,0 +1,91 @@
+#ifndef ENGINE_QUATERNION_BATCH_HEADER
+#define ENGINE_QUATERNION_BATCH_HEADER
+
+#include "simd.hpp"
+#include "simd_pack.hpp"
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- Q U A T E R N I O N  B A T C H --------------------------------------
+
+	/* quaternion operations over structure-of-arrays inputs (x, y, z and w
+	   in four float arrays, vectors in three), a pack of elements at a time
+	   on the instruction set selected at startup (simd_pack); products,
+	   rotated vectors and matrices match the simd::quatf functions (bit for
+	   bit without fp contraction), interpolations agree with them to a few
+	   ulp; every set gets the same bits */
+
+	class quaternion_batch final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::quaternion_batch;
+
+			/* size type */
+			using size_type = std::size_t;
+
+			/* quaternion arrays */
+			using quats = const float* const (&)[4];
+
+			/* output quaternion arrays */
+			using quats_out = float* const (&)[4];
+
+			/* vector arrays */
+			using vectors = const float* const (&)[3];
+
+			/* output vector arrays */
+			using vectors_out = float* const (&)[3];
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* non-instanciable class */
+			quaternion_batch(void) = delete;
+
+
+			// -- public static methods ---------------------------------------
+
+			/* out = a * b, b applied first */
+			static inline auto multiply(quats a, quats b, quats_out out, const size_type count) noexcept -> void {
+				static const auto kernel = ENGINE_SIMD_CHOOSE(quaternion_kernels::multiply);
+				kernel(a, b, out, count);
+			}
+
+			/* out = v rotated by the unit quaternion q */
+			static inline auto rotate(quats q, vectors v, vectors_out out, const size_type count) noexcept -> void {
+				static const auto kernel = ENGINE_SIMD_CHOOSE(quaternion_kernels::rotate);
+				kernel(q, v, out, count);
+			}
+
+			/* normalized linear interpolation from a to b by t, shorter arc */
+			static inline auto nlerp(quats a, quats b, const float* t, quats_out out, const size_type count) noexcept -> void {
+				static const auto kernel = ENGINE_SIMD_CHOOSE(quaternion_kernels::nlerp);
+				kernel(a, b, t, out, count);
+			}
+
+			/* spherical interpolation from a to b by t, shorter arc (nlerp
+			   where the two are nearly parallel) */
+			static inline auto slerp(quats a, quats b, const float* t, quats_out out, const size_type count) noexcept -> void {
+				static const auto kernel = ENGINE_SIMD_CHOOSE(quaternion_kernels::slerp);
+				kernel(a, b, t, out, count);
+			}
+
+			/* rotation matrices of unit quaternions */
+			static inline auto matrices(quats q, simd::float4x4* out, const size_type count) noexcept -> void {
+				static const auto kernel = ENGINE_SIMD_CHOOSE(quaternion_kernels::matrices);
+				kernel(q, out, count);
+			}
+
+	};
+
+}
+
+#endif // ENGINE_QUATERNION_BATCH_HEADER
@@ -0,0 +1,249 @@
+// -- Q U A T E R N I O N  K E R N E L S --------------------------------------
+
+/* no include guard: simd_kernels.hpp includes this once per instruction set
+   in namespace engine::simd::<set>, inside the target region of the set,
+   after sweep and math::kernel of the set; quaternion_batch dispatches to
+   the copy of the selected set */
+
+
+/* quaternion operations over structure-of-arrays inputs, a pack of elements
+   at a time, see quaternion_batch */
+
+class quaternion_kernels final {
+
+
+	public:
+
+		// -- public types ----------------------------------------------------
+
+		/* size type */
+		using size_type = std::size_t;
+
+		/* quaternion arrays */
+		using quats = const float* const (&)[4];
+
+		/* output quaternion arrays */
+		using quats_out = float* const (&)[4];
+
+		/* vector arrays */
+		using vectors = const float* const (&)[3];
+
+		/* output vector arrays */
+		using vectors_out = float* const (&)[3];
+
+
+		// -- public lifecycle ------------------------------------------------
+
+		/* non-instanciable class */
+		quaternion_kernels(void) = delete;
+
+
+		// -- public static methods -------------------------------------------
+
+		/* out = a * b, b applied first */
+		static inline auto multiply(quats a, quats b, quats_out out, const size_type count) noexcept -> void {
+			sweep<multiply_step>(count, a, b, out);
+		}
+
+		/* out = v rotated by the unit quaternion q */
+		static inline auto rotate(quats q, vectors v, vectors_out out, const size_type count) noexcept -> void {
+			sweep<rotate_step>(count, q, v, out);
+		}
+
+		/* normalized linear interpolation from a to b by t, shorter arc */
+		static inline auto nlerp(quats a, quats b, const float* t, quats_out out, const size_type count) noexcept -> void {
+			sweep<nlerp_step>(count, a, b, t, out);
+		}
+
+		/* spherical interpolation from a to b by t, shorter arc */
+		static inline auto slerp(quats a, quats b, const float* t, quats_out out, const size_type count) noexcept -> void {
+			sweep<slerp_step>(count, a, b, t, out);
+		}
+
+		/* rotation matrices of unit quaternions */
+		static inline auto matrices(quats q, simd::float4x4* out, const size_type count) noexcept -> void {
+			sweep<matrix_step>(count, q, out);
+		}
+
+
+		// -- public static register methods ----------------------------------
+
+		/* hamilton product of one register of quaternions, as simd::quatf */
+		template <typename L>
+		static inline auto product(const typename L::reg ax, const typename L::reg ay,
+								   const typename L::reg az, const typename L::reg aw,
+								   const typename L::reg bx, const typename L::reg by,
+								   const typename L::reg bz, const typename L::reg bw,
+								   typename L::reg (&out)[4]) noexcept -> void {
+
+			out[0] = L::add(L::add(L::add(L::mul(aw, bx), L::mul(ax, bw)), L::mul(ay, bz)), L::mul(az, L::neg(by)));
+			out[1] = L::add(L::add(L::add(L::mul(aw, by), L::mul(ax, L::neg(bz))), L::mul(ay, bw)), L::mul(az, bx));
+			out[2] = L::add(L::add(L::add(L::mul(aw, bz), L::mul(ax, by)), L::mul(ay, L::neg(bx))), L::mul(az, bw));
+			out[3] = L::add(L::add(L::add(L::mul(aw, bw), L::mul(ax, L::neg(bx))), L::mul(ay, L::neg(by))), L::mul(az, L::neg(bz)));
+		}
+
+		/* rotation matrix columns of one register of unit quaternions, as simd::matrix3x3 */
+		template <typename L>
+		static inline auto rotation(const typename L::reg x, const typename L::reg y,
+									const typename L::reg z, const typename L::reg w,
+									typename L::reg (&c)[3][3]) noexcept -> void {
+
+			const auto one = L::splat(1.0f), two = L::splat(2.0f);
+			const auto xx = L::mul(x, x), yy = L::mul(y, y), zz = L::mul(z, z);
+			const auto xy = L::mul(x, y), xz = L::mul(x, z), yz = L::mul(y, z);
+			const auto xw = L::mul(x, w), yw = L::mul(y, w), zw = L::mul(z, w);
+
+			c[0][0] = L::sub(one, L::mul(two, L::add(yy, zz)));
+			c[0][1] = L::mul(two, L::add(xy, zw));
+			c[0][2] = L::mul(two, L::sub(xz, yw));
+
+			c[1][0] = L::mul(two, L::sub(xy, zw));
+			c[1][1] = L::sub(one, L::mul(two, L::add(xx, zz)));
+			c[1][2] = L::mul(two, L::add(yz, xw));
+
+			c[2][0] = L::mul(two, L::add(xz, yw));
+			c[2][1] = L::mul(two, L::sub(yz, xw));
+			c[2][2] = L::sub(one, L::mul(two, L::add(xx, yy)));
+		}
+
+
+	private:
+
+		// -- private types ---------------------------------------------------
+
+		/* one register of products */
+		struct multiply_step final {
+			template <typename L>
+			static inline auto apply(const size_type i, quats a, quats b, quats_out out) noexcept -> void {
+
+				typename L::reg q[4];
+				quaternion_kernels::product<L>(L::load(a[0] + i), L::load(a[1] + i), L::load(a[2] + i), L::load(a[3] + i),
+											   L::load(b[0] + i), L::load(b[1] + i), L::load(b[2] + i), L::load(b[3] + i), q);
+
+				for (unsigned int k = 0U; k < 4U; ++k)
+					L::store(out[k] + i, q[k]);
+			}
+		};
+
+		/* one register of rotated vectors */
+		struct rotate_step final {
+			template <typename L>
+			static inline auto apply(const size_type i, quats q, vectors v, vectors_out out) noexcept -> void {
+
+				const auto ux = L::load(q[0] + i), uy = L::load(q[1] + i), uz = L::load(q[2] + i);
+				const auto w  = L::load(q[3] + i);
+				const auto vx = L::load(v[0] + i), vy = L::load(v[1] + i), vz = L::load(v[2] + i);
+
+				// v + 2w (u x v) + 2 u x (u x v), as simd::act
+				const auto two = L::splat(2.0f);
+				const auto tx = L::mul(L::sub(L::mul(uy, vz), L::mul(uz, vy)), two);
+				const auto ty = L::mul(L::sub(L::mul(uz, vx), L::mul(ux, vz)), two);
+				const auto tz = L::mul(L::sub(L::mul(ux, vy), L::mul(uy, vx)), two);
+
+				L::store(out[0] + i, L::add(L::add(vx, L::mul(tx, w)), L::sub(L::mul(uy, tz), L::mul(uz, ty))));
+				L::store(out[1] + i, L::add(L::add(vy, L::mul(ty, w)), L::sub(L::mul(uz, tx), L::mul(ux, tz))));
+				L::store(out[2] + i, L::add(L::add(vz, L::mul(tz, w)), L::sub(L::mul(ux, ty), L::mul(uy, tx))));
+			}
+		};
+
+		/* one register of normalized linear interpolations */
+		struct nlerp_step final {
+			template <typename L>
+			static inline auto apply(const size_type i, quats a, quats b, const float* t, quats_out out) noexcept -> void {
+
+				typename L::reg p[4], q[4];
+				quaternion_kernels::shorter<L>(a, b, i, p, q);
+
+				typename L::reg r[4];
+				quaternion_kernels::lerp<L>(p, q, L::load(t + i), r);
+
+				for (unsigned int k = 0U; k < 4U; ++k)
+					L::store(out[k] + i, r[k]);
+			}
+		};
+
+		/* one register of spherical interpolations (nlerp where the two
+		   are nearly parallel) */
+		struct slerp_step final {
+			template <typename L>
+			static inline auto apply(const size_type i, quats a, quats b, const float* t, quats_out out) noexcept -> void {
+
+				typename L::reg p[4], q[4];
+				const auto d = quaternion_kernels::shorter<L>(a, b, i, p, q);
+				const auto s = L::load(t + i);
+
+				typename L::reg near[4];
+				quaternion_kernels::lerp<L>(p, q, s, near);
+
+				// sin((1 - t) angle) / sin(angle) and sin(t angle) / sin(angle)
+				const auto angle = math::kernel<L>::acos(L::min(d, L::splat(1.0f)));
+
+				typename L::reg sa, ca, s0, c0, s1, c1;
+				math::kernel<L>::sincos(angle, sa, ca);
+				math::kernel<L>::sincos(L::mul(L::sub(L::splat(1.0f), s), angle), s0, c0);
+				math::kernel<L>::sincos(L::mul(s, angle), s1, c1);
+
+				const auto inv = L::div(L::splat(1.0f), sa);
+				const auto wa = L::mul(s0, inv), wb = L::mul(s1, inv);
+				const auto parallel = L::less(L::splat(0.9995f), d);
+
+				for (unsigned int k = 0U; k < 4U; ++k)
+					L::store(out[k] + i, L::select(parallel, near[k], L::add(L::mul(p[k], wa), L::mul(q[k], wb))));
+			}
+		};
+
+		/* one register of rotation matrices */
+		struct matrix_step final {
+			template <typename L>
+			static inline auto apply(const size_type i, quats q, simd::float4x4* out) noexcept -> void {
+
+				typename L::reg c[3][3];
+				quaternion_kernels::rotation<L>(L::load(q[0] + i), L::load(q[1] + i), L::load(q[2] + i), L::load(q[3] + i), c);
+
+				const auto zero = L::splat(0.0f);
+				for (unsigned int k = 0U; k < 3U; ++k)
+					L::column(out + i, k, c[k][0], c[k][1], c[k][2], zero);
+				L::column(out + i, 3U, zero, zero, zero, L::splat(1.0f));
+			}
+		};
+
+
+		// -- private static methods ------------------------------------------
+
+		/* load a and b, b negated where the arc through it is the longer
+		   one, returns the (non negative) dot product */
+		template <typename L>
+		static inline auto shorter(quats a, quats b, const size_type i,
+								   typename L::reg (&p)[4], typename L::reg (&q)[4]) noexcept -> typename L::reg {
+
+			for (unsigned int k = 0U; k < 4U; ++k) {
+				p[k] = L::load(a[k] + i);
+				q[k] = L::load(b[k] + i);
+			}
+
+			const auto d = L::add(L::add(L::mul(p[0], q[0]), L::mul(p[1], q[1])),
+								  L::add(L::mul(p[2], q[2]), L::mul(p[3], q[3])));
+			const auto flip = L::less(d, L::splat(0.0f));
+
+			for (unsigned int k = 0U; k < 4U; ++k)
+				q[k] = L::select(flip, L::neg(q[k]), q[k]);
+
+			return L::abs(d);
+		}
+
+		/* normalize(p + (q - p) t) */
+		template <typename L>
+		static inline auto lerp(const typename L::reg (&p)[4], const typename L::reg (&q)[4],
+								const typename L::reg t, typename L::reg (&out)[4]) noexcept -> void {
+
+			for (unsigned int k = 0U; k < 4U; ++k)
+				out[k] = L::add(p[k], L::mul(L::sub(q[k], p[k]), t));
+
+			const auto length = L::sqrt(L::add(L::add(L::mul(out[0], out[0]), L::mul(out[1], out[1])),
+											   L::add(L::mul(out[2], out[2]), L::mul(out[3], out[3]))));
+
+			for (unsigned int k = 0U; k < 4U; ++k)
+				out[k] = L::div(out[k], length);
+		}
+
+};
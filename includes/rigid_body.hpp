@@ -21,13 +21,13 @@ namespace engine {
 			// -- private members ---------------------------------------------
 
 			/* position */
-			::simd::float3 _position;
+			simd::float3 _position;
 
 			/* previous position */
-			::simd::float3 _previous;
+			simd::float3 _previous;
 
 			/* acceleration */
-			::simd::float3 _acceleration;
+			simd::float3 _acceleration;
 
 			/* mass */
 			float _mass;
@@ -43,66 +43,31 @@ namespace engine {
 	// acceleration = velocity / time
 	//     velocity = Δposition / Δtime
 
-	inline auto force(const float mass, const ::simd::float3& acceleration) noexcept -> ::simd::float3 {
+	inline auto force(const float mass, const simd::float3& acceleration) noexcept -> simd::float3 {
 		return mass * acceleration;
 	}
 
-	inline auto acceleration(const float mass, const ::simd::float3& force) noexcept -> ::simd::float3 {
+	inline auto acceleration(const float mass, const simd::float3& force) noexcept -> simd::float3 {
 		return force / mass;
 	}
 
-	inline auto acceleration(const ::simd::float3& velocity, const float time) noexcept -> ::simd::float3 {
+	inline auto acceleration(const simd::float3& velocity, const float time) noexcept -> simd::float3 {
 		return velocity / time;
 	}
 
-	inline auto _velocity(const ::simd::float3& position, const float time) noexcept -> ::simd::float3 {
+	inline auto _velocity(const simd::float3& position, const float time) noexcept -> simd::float3 {
 		return position / time;
 	}
 
 
 
-	template <decltype(sizeof(0)) N>
-	class transform final {
-
-		// -- assertions ------------------------------------------------------
-
-		/* require 2, 3 or 4 dimensions */
-		static_assert(N == 2 || N == 3 || N == 4, "): TRANSFORM: dimension must be 2, 3 or 4");
-
-
-		public:
-
-			// -- public type -------------------------------------------------
-
-			/* self type */
-			using self = engine::transform<N>;
-
-			/* position type */
-			using position = engine::simd<float, N>;
-
-			/* rotation type */
-			using rotation = engine::simd<float, N>;
-
-
-		private:
-
-			// -- private members ---------------------------------------------
-
-			/* position */
-			position _position;
-
-			/* rotation */
-			::simd::quatf _rotation;
-
-	};
-
 	class mass_inertia final {
 
 		public:
 
 
-			auto compute_force(void) const noexcept -> ::simd::float3 {
-				return ::simd::float3{0.0f, _mass * -9.81f, 0.0f};
+			auto compute_force(void) const noexcept -> simd::float3 {
+				return simd::float3{0.0f, _mass * -9.81f, 0.0f};
 			}
 
 		private:
@@ -128,7 +93,7 @@ namespace engine {
 			float _mass;
 
 			/* inertia */
-			::simd::float3x3 _inertia;
+			simd::float3x3 _inertia;
 
 	};
 
@@ -142,10 +107,10 @@ namespace engine {
 			// -- private members ---------------------------------------------
 
 			/* linear */
-			::simd::float3 _linear;
+			simd::float3 _linear;
 
 			/* angular */
-			::simd::float3 _angular;
+			simd::float3 _angular;
 
 	};
 
@@ -172,7 +137,7 @@ namespace engine {
 		private:
 
 			/* apply force */
-			auto apply_force(const ::simd::float3& force) noexcept -> void {
+			auto apply_force(const simd::float3& force) noexcept -> void {
 			}
 
 			/* update position */
@@ -196,7 +161,7 @@ namespace engine {
 			// -- private members ---------------------------------------------
 
 			/* transform */
-			engine::transform<2> _transform;
+			engine::transform _transform;
 
 			/* mass inertia */
 			engine::mass_inertia _mass_inertia;
@@ -0,0 +1,252 @@
+#ifndef ENGINE_SCANNER_HPP
+#define ENGINE_SCANNER_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#	include <immintrin.h>
+#elif defined(__ARM_NEON)
+#	include <arm_neon.h>
+#endif
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- S C A N N E R -------------------------------------------------------
+
+	/* classifies 64 bytes per step into bit masks (bit i <=> byte i) of line
+	   feeds, blanks and control bytes, the runs the stream parser skips in bulk
+	   avx2: 2 x 32 bytes, sse: 4 x 16 bytes, neon: 4 x 16 bytes, scalar fallback */
+
+	class scanner final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::scanner;
+
+			/* mask type */
+			using mask_type = std::uint64_t;
+
+			/* size type */
+			using size_type = std::size_t;
+
+
+			// -- public constants --------------------------------------------
+
+			/* block size */
+			enum : size_type { BLOCK_SIZE = 64U };
+
+
+			// -- M A S K S ---------------------------------------------------
+
+			struct masks final {
+
+				/* '\n' */
+				mask_type newline;
+
+				/* ' ', '\t' */
+				mask_type blank;
+
+				/* control bytes ending a comment run ('\0' - '\x1f' except '\t', '\x7f') */
+				mask_type control;
+			};
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* non-instanciable class */
+			scanner(void) = delete;
+
+
+			// -- public static methods ---------------------------------------
+
+			/* classify one block of 64 bytes (unaligned) */
+			static inline auto classify(const char* block) noexcept -> masks {
+
+				masks m{};
+
+			#if defined(__AVX2__)
+
+				const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+				const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));
+
+				const auto eq = [&](const char c) noexcept -> mask_type {
+					const __m256i v = _mm256_set1_epi8(c);
+					return  static_cast<mask_type>(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, v))))
+						 | (static_cast<mask_type>(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, v)))) << 32);
+				};
+
+				// unsigned x <= limit
+				const auto le = [](const __m256i x, const char limit) noexcept -> std::uint32_t {
+					return static_cast<std::uint32_t>(_mm256_movemask_epi8(
+								_mm256_cmpeq_epi8(_mm256_min_epu8(x, _mm256_set1_epi8(limit)), x)));
+				};
+
+				const mask_type ctrl =  static_cast<mask_type>(le(lo, 0x1f))
+									 | (static_cast<mask_type>(le(hi, 0x1f)) << 32);
+
+			#elif defined(__SSE2__)
+
+				const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+				const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16));
+				const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 32));
+				const __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 48));
+
+				const auto pack = [](const __m128i a, const __m128i b, const __m128i c, const __m128i d) noexcept -> mask_type {
+					return  static_cast<mask_type>(static_cast<std::uint16_t>(_mm_movemask_epi8(a)))
+						 | (static_cast<mask_type>(static_cast<std::uint16_t>(_mm_movemask_epi8(b))) << 16)
+						 | (static_cast<mask_type>(static_cast<std::uint16_t>(_mm_movemask_epi8(c))) << 32)
+						 | (static_cast<mask_type>(static_cast<std::uint16_t>(_mm_movemask_epi8(d))) << 48);
+				};
+
+				const auto eq = [&](const char c) noexcept -> mask_type {
+					const __m128i v = _mm_set1_epi8(c);
+					return pack(_mm_cmpeq_epi8(v0, v), _mm_cmpeq_epi8(v1, v),
+								_mm_cmpeq_epi8(v2, v), _mm_cmpeq_epi8(v3, v));
+				};
+
+				// unsigned x <= limit
+				const auto le = [](const __m128i x, const char limit) noexcept -> __m128i {
+					return _mm_cmpeq_epi8(_mm_min_epu8(x, _mm_set1_epi8(limit)), x);
+				};
+
+				const mask_type ctrl = pack(le(v0, 0x1f), le(v1, 0x1f), le(v2, 0x1f), le(v3, 0x1f));
+
+			#elif defined(__ARM_NEON)
+
+				const uint8x16_t v0 = vld1q_u8(reinterpret_cast<const std::uint8_t*>(block));
+				const uint8x16_t v1 = vld1q_u8(reinterpret_cast<const std::uint8_t*>(block + 16));
+				const uint8x16_t v2 = vld1q_u8(reinterpret_cast<const std::uint8_t*>(block + 32));
+				const uint8x16_t v3 = vld1q_u8(reinterpret_cast<const std::uint8_t*>(block + 48));
+
+				// no movemask on neon, fold lanes with pairwise additions
+				const auto pack = [](const uint8x16_t a, const uint8x16_t b, const uint8x16_t c, const uint8x16_t d) noexcept -> mask_type {
+					const uint8x16_t bits = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+											 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
+					uint8x16_t s0 = vpaddq_u8(vandq_u8(a, bits), vandq_u8(b, bits));
+					uint8x16_t s1 = vpaddq_u8(vandq_u8(c, bits), vandq_u8(d, bits));
+					s0 = vpaddq_u8(s0, s1);
+					s0 = vpaddq_u8(s0, s0);
+					return vgetq_lane_u64(vreinterpretq_u64_u8(s0), 0);
+				};
+
+				const auto eq = [&](const char c) noexcept -> mask_type {
+					const uint8x16_t v = vdupq_n_u8(static_cast<std::uint8_t>(c));
+					return pack(vceqq_u8(v0, v), vceqq_u8(v1, v), vceqq_u8(v2, v), vceqq_u8(v3, v));
+				};
+
+				const auto le = [](const uint8x16_t x, const std::uint8_t limit) noexcept -> uint8x16_t {
+					return vcleq_u8(x, vdupq_n_u8(limit));
+				};
+
+				const mask_type ctrl = pack(le(v0, 0x1f), le(v1, 0x1f), le(v2, 0x1f), le(v3, 0x1f));
+
+			#else
+
+				const auto eq = [&](const char c) noexcept -> mask_type {
+					mask_type r = 0U;
+					for (size_type i = 0U; i < BLOCK_SIZE; ++i)
+						r |= static_cast<mask_type>(block[i] == c) << i;
+					return r;
+				};
+
+				mask_type ctrl = 0U;
+
+				for (size_type i = 0U; i < BLOCK_SIZE; ++i)
+					ctrl |= static_cast<mask_type>(static_cast<unsigned char>(block[i]) <= 0x1fU) << i;
+
+			#endif
+
+				const mask_type tab = eq('\t');
+
+				m.newline = eq('\n');
+				m.blank   = eq(' ') | tab;
+				m.control = (ctrl & ~tab) | eq('\x7f');
+
+				return m;
+			}
+
+
+			/* find next line feed (or end) */
+			static inline auto find_newline(const char* it, const char* const end) noexcept -> const char* {
+				for (; (end - it) >= static_cast<std::ptrdiff_t>(BLOCK_SIZE); it += BLOCK_SIZE) {
+					const mask_type m = self::classify(it).newline;
+					if (m != 0U)
+						return it + self::first(m);
+				}
+				while (it != end && *it != '\n')
+					++it;
+				return it;
+			}
+
+			/* find next control byte, end of a comment run (or end) */
+			static inline auto find_control(const char* it, const char* const end) noexcept -> const char* {
+				for (; (end - it) >= static_cast<std::ptrdiff_t>(BLOCK_SIZE); it += BLOCK_SIZE) {
+					const mask_type m = self::classify(it).control;
+					if (m != 0U)
+						return it + self::first(m);
+				}
+				while (it != end) {
+					const auto c = static_cast<unsigned char>(*it);
+					if ((c <= 0x1fU && c != '\t') || c == 0x7fU)
+						break;
+					++it;
+				}
+				return it;
+			}
+
+			/* skip blank run */
+			static inline auto skip_blanks(const char* it, const char* const end) noexcept -> const char* {
+				// short runs are the common case
+				size_type n = 0U;
+				while (it != end && (*it == ' ' || *it == '\t') && n < 16U) {
+					++it;
+					++n;
+				}
+				if (n < 16U)
+					return it;
+
+				for (; (end - it) >= static_cast<std::ptrdiff_t>(BLOCK_SIZE); it += BLOCK_SIZE) {
+					const mask_type m = ~self::classify(it).blank;
+					if (m != 0U)
+						return it + self::first(m);
+				}
+				while (it != end && (*it == ' ' || *it == '\t'))
+					++it;
+				return it;
+			}
+
+			/* count line feeds */
+			static inline auto count_lines(const char* it, const char* const end) noexcept -> size_type {
+				size_type count = 0U;
+				for (; (end - it) >= static_cast<std::ptrdiff_t>(BLOCK_SIZE); it += BLOCK_SIZE)
+					count += static_cast<size_type>(__builtin_popcountll(self::classify(it).newline));
+				for (; it != end; ++it)
+					count += (*it == '\n');
+				return count;
+			}
+
+
+		private:
+
+			// -- private static methods --------------------------------------
+
+			/* index of first set bit */
+			static inline auto first(const mask_type mask) noexcept -> size_type {
+				return static_cast<size_type>(__builtin_ctzll(mask));
+			}
+
+	};
+
+}
+
+#endif // ENGINE_SCANNER_HPP
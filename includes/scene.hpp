@@ -6,124 +6,17 @@
 #include "mesh_library.hpp"
 #include "wavefront.hpp"
 #include "mesh.hpp"
+#include "primitives.hpp"
 #include "game_object.hpp"
 
 
-/* will be moved in the class to avoid recreating the mesh every frame */
+/* floor grid, baked at compile time (one line list shared by every floor object) */
 
 inline auto create_floor() -> engine::mesh& {
 
-//	print("createFloor");
-	float from = -1;
-	float to   = +1;
-	float y    = 0;
-	float s    = 0.1f;
+	static constexpr auto lines = engine::primitives::grid_lines<20U>();
 
-	std::uint32_t i = 0;
-
-	engine::vpackage pack;
-
-	for (float z = from; z < to; z += s) {
-		for (float x = from; x < to; x += s) {
-
-			pack.first.emplace_back(x, y, z);
-			pack.first.emplace_back(x + s, y, z);
-			pack.first.emplace_back(x, y, z + s);
-			pack.first.emplace_back(x + s, y, z + s);
-
-			pack.second.emplace_back(i + 0);
-			pack.second.emplace_back(i + 1);
-			pack.second.emplace_back(i + 1);
-			pack.second.emplace_back(i + 3);
-			pack.second.emplace_back(i + 3);
-			pack.second.emplace_back(i + 2);
-			pack.second.emplace_back(i + 2);
-			pack.second.emplace_back(i + 0);
-
-			i += 4;
-
-		}
-
-	}
-
-
-	static engine::mesh mesh{pack};
-
-	return mesh;
-}
-
-
-inline auto create_cuboid(const float width, const float height, const float depth) -> engine::mesh& {
-
-	engine::vpackage pack;
-
-	auto& vec = pack.first;
-
-	// remap to 0.0 - 1.0
-	//auto max = std::max({width, height, depth});
-
-	float x = width  / 2;
-	float y = height / 2;
-	float z = depth  / 2;
-
-
-	// FRONT
-	vec.emplace_back(-x, -y, -z, +0.0, +0.0, -1.0);
-	vec.emplace_back(+x, -y, -z, +0.0, +0.0, -1.0);
-	vec.emplace_back(+x, +y, -z, +0.0, +0.0, -1.0);
-	vec.emplace_back(-x, +y, -z, +0.0, +0.0, -1.0);
-	// BACK
-	vec.emplace_back(+x, -y, +z, +0.0, +0.0, +1.0);
-	vec.emplace_back(-x, -y, +z, +0.0, +0.0, +1.0);
-	vec.emplace_back(-x, +y, +z, +0.0, +0.0, +1.0);
-	vec.emplace_back(+x, +y, +z, +0.0, +0.0, +1.0);
-	// UP
-	vec.emplace_back(-x, +y, -z, +0.0, +1.0, +0.0);
-	vec.emplace_back(+x, +y, -z, +0.0, +1.0, +0.0);
-	vec.emplace_back(+x, +y, +z, +0.0, +1.0, +0.0);
-	vec.emplace_back(-x, +y, +z, +0.0, +1.0, +0.0);
-	// DOWN
-	vec.emplace_back(-x, -y, +z, +0.0, -1.0, +0.0);
-	vec.emplace_back(+x, -y, +z, +0.0, -1.0, +0.0);
-	vec.emplace_back(+x, -y, -z, +0.0, -1.0, +0.0);
-	vec.emplace_back(-x, -y, -z, +0.0, -1.0, +0.0);
-	// LEFT
-	vec.emplace_back(-x, -y, +z, -1.0, +0.0, +0.0);
-	vec.emplace_back(-x, -y, -z, -1.0, +0.0, +0.0);
-	vec.emplace_back(-x, +y, -z, -1.0, +0.0, +0.0);
-	vec.emplace_back(-x, +y, +z, -1.0, +0.0, +0.0);
-	// RIGHT
-	vec.emplace_back(+x, -y, -z, +1.0, +0.0, +0.0);
-	vec.emplace_back(+x, -y, +z, +1.0, +0.0, +0.0);
-	vec.emplace_back(+x, +y, +z, +1.0, +0.0, +0.0);
-	vec.emplace_back(+x, +y, -z, +1.0, +0.0, +0.0);
-
-	auto& idxs = pack.second;
-
-	idxs = {
-		 0,  1,  2,  2,  3,  0,
-		 4,  5,  6,  6,  7,  4,
-		 8,  9, 10, 10, 11,  8,
-		12, 13, 14, 14, 15, 12,
-		16, 17, 18, 18, 19, 16,
-		20, 21, 22, 22, 23, 20
-	};
-
-	// inverse order for back cullmode
-
-	idxs = {
-		2,  1,  0,  0,  3,  2,
-		6,  5,  4,  4,  7,  6,
-		10,  9,  8,  8, 11, 10,
-		14, 13, 12, 12, 15, 14,
-		18, 17, 16, 16, 19, 18,
-		22, 21, 20, 20, 23, 22
-
-	};
-
-
-
-	static engine::mesh mesh{pack};
+	static engine::mesh mesh{lines};
 
 	return mesh;
 }
@@ -155,8 +48,9 @@ namespace engine {
 			: _camera{}, _objects{}, _floor{}, _cuboid{} {
 
 
-				_cuboid.set_mesh(create_cuboid(8.0f, 19.0f, 3.0f));
+				_cuboid.set_mesh(engine::mesh_library::get(engine::mesh_library::CUBOID));
 				_cuboid.material().color(0.1f, 0.1f, 0.1f, 1.0f);
+				_cuboid.transform().scale(4.0f, 9.5f, 1.5f);
 				_cuboid.transform().position().y = 9.5f;
 				//_cuboid.options().cullmode(MTL::CullModeFront);
 
@@ -168,19 +62,19 @@ namespace engine {
 
 				_floor[0].transform().scale(30.0f);
 
-				_floor[1].transform().rotation().z = 1.5708f;
+				_floor[1].transform().euler(simd::float3{0.0f, 0.0f, 1.5708f});
 				_floor[1].transform().position().x = 1.0f;
 				_floor[1].transform().position().y = 1.0f;
 
-				_floor[2].transform().rotation().z = 1.5708f;
+				_floor[2].transform().euler(simd::float3{0.0f, 0.0f, 1.5708f});
 				_floor[2].transform().position().x = -1.0f;
 				_floor[2].transform().position().y = 1.0f;
 
-				_floor[3].transform().rotation().x = 1.5708f;
+				_floor[3].transform().euler(simd::float3{1.5708f, 0.0f, 0.0f});
 				_floor[3].transform().position().z = 1.0f;
 				_floor[3].transform().position().y = 1.0f;
 
-				_floor[4].transform().rotation().x = 1.5708f;
+				_floor[4].transform().euler(simd::float3{1.5708f, 0.0f, 0.0f});
 				_floor[4].transform().position().z = -1.0f;
 				_floor[4].transform().position().y = 1.0f;
 
@@ -253,10 +147,11 @@ namespace engine {
 				static float angle = 0.0f;
 				static float angle2 = 0.0f;
 
-				for (auto& object : _objects) {
-					object.transform().rotation().y = angle;
-					object.transform().rotation().x = angle2;
-				}
+				// one turn for every object, trig once per frame
+				const simd::quatf spin = engine::matrix::rotation(simd::float3{angle2, angle, 0.0f});
+
+				for (auto& object : _objects)
+					object.transform().rotation() = spin;
 
 				angle += 0.008f;
 				angle2 += 0.005f;
@@ -294,12 +189,15 @@ namespace engine {
 
 				_camera.render(encoder);
 
+				engine::cluster_culling culling{_camera.projection(), _camera.view(), _camera.position(),
+												static_cast<float>(engine::screen::height())};
+
 				 _floor[0].render(encoder);
 
 				 _cuboid.render(encoder);
 
 				 for (auto& object : _objects)
-				 	object.render(encoder);
+				 	object.render(encoder, culling);
 				 //_objects.front().render(encoder);
 			}
 
@@ -61,6 +61,7 @@ namespace engine {
 				mtl::function{"default_vertex_2d", _library},
 				mtl::function{"default_fragment_2d", _library},
 				mtl::function{"vertex_main", _library},
+				mtl::function{"vertex_compact", _library},
 				mtl::function{"fragment_main", _library}
 			  } {
 			}
@@ -75,6 +76,7 @@ namespace engine {
 			xns::literal_map<mtl::function, "default_vertex_2d",
 											"default_fragment_2d",
 											"vertex_main",
+											"vertex_compact",
 											"fragment_main"> _functions;
 
 	};
@@ -2,6 +2,7 @@
 #define ENGINE_SHAPES_HEADER
 
 #include "vertex.hpp"
+#include "primitives.hpp"
 #include "mesh.hpp"
 
 #include <xns>
@@ -15,38 +16,11 @@ namespace engine {
 
 
 
+	/* unit circle baked at compile time (scale through the transform) */
 	template <xns::size_t segments>
-	inline auto make_circle(const float radius) -> engine::mesh {
-
-		std::vector<engine::vertex_2D> vertices;
-		std::vector<unsigned int> indexes;
-
-		//xns::array<engine::vertex_2D, segments + 1> vertices;
-
-		// -- vertices --------------------------------------------------------
-
-		// center
-		vertices.push_back(engine::vertex_2D{0.0f, 0.0f});
-
-		// circumference
-		for (unsigned int i = 0; i < segments; ++i) {
-			const float angle = 2.0f * M_PI * (i / static_cast<float>(segments));
-			vertices.push_back(engine::vertex_2D{radius * std::cos(angle), radius * std::sin(angle)});
-		}
-
-		std::cout << "segments: " << segments << std::endl;
-		std::cout << "size: " << vertices.size() << std::endl;
-
-		// -- indexes ---------------------------------------------------------
-
-		// inverse index order
-		for (unsigned int i = 0; i < segments; ++i) {
-			indexes.push_back(0);
-			indexes.push_back((i + 1) % segments + 1);
-			indexes.push_back(i + 1);
-		}
-
-		return engine::mesh{vertices, indexes};
+	inline auto make_circle(void) -> engine::mesh {
+		static constexpr auto circle = engine::primitives::circle<segments>();
+		return engine::mesh{circle};
 	}
 
 
@@ -122,7 +96,7 @@ namespace engine {
 			/* default constructor */
 			inline shapes(void) noexcept
 			: _shapes{
-				make_circle<320>(1.0f),
+				make_circle<320>(),
 				self::make_square(),
 				self::make_triangle()} {
 			}
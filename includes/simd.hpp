@@ -1,217 +1,1108 @@
-#ifndef SIMD_HEADER
-#define SIMD_HEADER
-
-#include <xns>
-
-
-#if not __has_attribute(ext_vector_type)
-#	error "): SIMD: compiler does not support SIMD. :("
+#ifndef ENGINE_SIMD_HEADER
+#define ENGINE_SIMD_HEADER
+
+// -- B A C K E N D -----------------------------------------------------------
+
+/* picked at compile time: sse on x86-64 (avx for matrix products when the
+   target has it), neon on arm64, plain loops elsewhere or when
+   ENGINE_SIMD_SCALAR is defined; lanes are summed in the same order and
+   never fused, so the backends agree bit for bit under -ffp-contract=off */
+
+#if defined(ENGINE_SIMD_SCALAR)
+#elif defined(__SSE2__) || defined(_M_X64)
+#	define ENGINE_SIMD_SSE
+#	include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#	define ENGINE_SIMD_NEON
+#	include <arm_neon.h>
+#else
+#	define ENGINE_SIMD_SCALAR
 #endif
 
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
 
 // -- E N G I N E  N A M E S P A C E ------------------------------------------
 
 namespace engine {
 
 
-	template <typename T, xns::size_t N>
-	class simd final {
+	// -- S I M D  N A M E S P A C E ------------------------------------------
 
+	/* engine-owned vector, matrix and quaternion types, laid out like the
+	   shader types (float3 padded to 16 bytes, column-major matrices) so
+	   they upload as is */
 
-		// -- assertions ------------------------------------------------------
+	namespace simd {
 
-		/* arithmetic type */
-		static_assert(xns::is_arithmetic<T>, "T must be arithmetic type.");
 
-		/* minimum size */
-		static_assert(N > 1, "): SIMD: N must be greater than 1. :(");
+		/* backend name */
+		#if defined(ENGINE_SIMD_SSE) && defined(__AVX__)
+		inline constexpr const char* backend = "avx";
+		#elif defined(ENGINE_SIMD_SSE)
+		inline constexpr const char* backend = "sse";
+		#elif defined(ENGINE_SIMD_NEON)
+		inline constexpr const char* backend = "neon";
+		#else
+		inline constexpr const char* backend = "scalar";
+		#endif
 
 
-		public:
+		// -- F L O A T 2 -----------------------------------------------------
 
-			// -- public type -------------------------------------------------
+		struct alignas(8) float2 final {
 
-			/* self type */
-			using self = engine::simd<T, N>;
+			/* lanes */
+			static constexpr std::size_t size = 2U;
 
-			/* value type */
-			using value_type = T;
+			/* default constructor */
+			inline constexpr float2(void) noexcept
+			: x{0.0f}, y{0.0f} {}
 
-			/* underlying type */
-			using underlying = __attribute__((__ext_vector_type__(N))) value_type;
+			/* broadcast constructor */
+			inline constexpr explicit float2(const float s) noexcept
+			: x{s}, y{s} {}
 
+			/* components constructor */
+			inline constexpr float2(const float x, const float y) noexcept
+			: x{x}, y{y} {}
 
-			// -- public lifecycle --------------------------------------------
+			/* lane */
+			inline constexpr auto operator[](const std::size_t i) noexcept -> float& {
+				return i == 0U ? x : y;
+			}
 
-			/* default constructor */
-			inline constexpr simd(void) noexcept
-			: _data{} {}
+			/* const lane */
+			inline constexpr auto operator[](const std::size_t i) const noexcept -> float {
+				return i == 0U ? x : y;
+			}
+
+			/* components */
+			float x, y;
+		};
 
-			/* value constructor */
-			template <typename... A> requires (sizeof...(A) == N)
-			inline constexpr simd(const A&... value) noexcept
-			: _data{value...} {}
 
-			/* copy constructor */
-			inline constexpr simd(const self& other) noexcept
-			: _data{other._data} {}
+		// -- F L O A T 3 -----------------------------------------------------
 
-			/* move constructor */
-			inline constexpr simd(self&& other) noexcept
-			: simd{other} {}
+		struct alignas(16) float3 final {
 
-			/* destructor */
-			inline ~simd(void) noexcept = default;
+			/* lanes */
+			static constexpr std::size_t size = 3U;
+
+			/* default constructor */
+			inline constexpr float3(void) noexcept
+			: x{0.0f}, y{0.0f}, z{0.0f}, _pad{0.0f} {}
 
+			/* broadcast constructor */
+			inline constexpr explicit float3(const float s) noexcept
+			: x{s}, y{s}, z{s}, _pad{0.0f} {}
 
-			// -- public assignment operators ---------------------------------
+			/* components constructor */
+			inline constexpr float3(const float x, const float y, const float z) noexcept
+			: x{x}, y{y}, z{z}, _pad{0.0f} {}
 
-			/* copy assignment operator */
-			inline constexpr auto operator=(const self& other) noexcept -> self& {
-				_data = other._data;
-				return *this;
+			/* lane */
+			inline constexpr auto operator[](const std::size_t i) noexcept -> float& {
+				return i == 0U ? x : (i == 1U ? y : z);
 			}
 
-			/* move assignment operator */
-			inline constexpr auto operator=(self&& other) noexcept -> self& {
-				return self::operator=(other);
+			/* const lane */
+			inline constexpr auto operator[](const std::size_t i) const noexcept -> float {
+				return i == 0U ? x : (i == 1U ? y : z);
 			}
 
+			/* components */
+			float x, y, z;
 
-			// -- public accessors --------------------------------------------
+			/* fourth lane, kept at zero */
+			float _pad;
+		};
 
-			/* get */
-			inline constexpr auto get(const xns::size_t index) const noexcept -> value_type {
-				return _data[index];
-			}
 
+		// -- F L O A T 4 -----------------------------------------------------
 
-			// -- public modifiers --------------------------------------------
+		struct alignas(16) float4 final {
 
-			/* set */
-			inline constexpr auto set(const xns::size_t index, const value_type value) noexcept -> void {
-				_data[index] = value;
-			}
+			/* lanes */
+			static constexpr std::size_t size = 4U;
 
+			/* default constructor */
+			inline constexpr float4(void) noexcept
+			: x{0.0f}, y{0.0f}, z{0.0f}, w{0.0f} {}
 
+			/* broadcast constructor */
+			inline constexpr explicit float4(const float s) noexcept
+			: x{s}, y{s}, z{s}, w{s} {}
 
-			// -- public arithmetic operators ---------------------------------
+			/* components constructor */
+			inline constexpr float4(const float x, const float y, const float z, const float w) noexcept
+			: x{x}, y{y}, z{z}, w{w} {}
 
-			/* add self */
-			inline constexpr auto operator+=(const self& other) noexcept -> self& {
-				_data += other._data;
-				return *this;
-			}
+			/* vector and w constructor */
+			inline constexpr float4(const float3& v, const float w) noexcept
+			: x{v.x}, y{v.y}, z{v.z}, w{w} {}
 
-			/* add value */
-			inline constexpr auto operator+=(const value_type value) noexcept -> self& {
-				_data += value;
-				return *this;
+			/* lane */
+			inline constexpr auto operator[](const std::size_t i) noexcept -> float& {
+				return i == 0U ? x : (i == 1U ? y : (i == 2U ? z : w));
 			}
 
-			/* subtract self */
-			inline constexpr auto operator-=(const self& other) noexcept -> self& {
-				_data -= other._data;
-				return *this;
+			/* const lane */
+			inline constexpr auto operator[](const std::size_t i) const noexcept -> float {
+				return i == 0U ? x : (i == 1U ? y : (i == 2U ? z : w));
 			}
 
-			/* subtract value */
-			inline constexpr auto operator-=(const value_type value) noexcept -> self& {
-				_data -= value;
-				return *this;
-			}
+			/* components */
+			float x, y, z, w;
+		};
 
-			/* multiply self */
-			inline constexpr auto operator*=(const self& other) noexcept -> self& {
-				_data *= other._data;
-				return *this;
-			}
 
-			/* multiply value */
-			inline constexpr auto operator*=(const value_type value) noexcept -> self& {
-				_data *= value;
-				return *this;
-			}
+		/* sized vector type */
+		template <std::size_t N>
+		using floatn = std::conditional_t<N == 2U, float2, std::conditional_t<N == 3U, float3, float4>>;
 
-			/* divide self */
-			inline constexpr auto operator/=(const self& other) noexcept -> self& {
-				_data /= other._data;
-				return *this;
-			}
+		/* one of the vector types */
+		template <typename T>
+		concept vector_type = std::is_same_v<T, float2> || std::is_same_v<T, float3> || std::is_same_v<T, float4>;
 
-			/* divide value */
-			inline constexpr auto operator/=(const value_type value) noexcept -> self& {
-				_data /= value;
-				return *this;
-			}
+		/* vector type held in a register */
+		template <typename T>
+		concept wide_type = std::is_same_v<T, float3> || std::is_same_v<T, float4>;
 
 
+		// -- F L O A T 3 X 3 -------------------------------------------------
 
-			// -- public unary operators --------------------------------------
+		struct float3x3 final {
 
-			/* positive */
-			inline constexpr auto operator+(void) const noexcept -> const self& {
-				return *this;
-			}
+			/* zero constructor */
+			inline constexpr float3x3(void) noexcept
+			: columns{} {}
 
-			/* negative */
-			inline constexpr auto operator-(void) const noexcept -> self {
-				return self{*this} *= -1;
-			}
+			/* diagonal constructor */
+			inline constexpr explicit float3x3(const float d) noexcept
+			: columns{float3{d, 0.0f, 0.0f}, float3{0.0f, d, 0.0f}, float3{0.0f, 0.0f, d}} {}
 
+			/* columns constructor */
+			inline constexpr float3x3(const float3& c0, const float3& c1, const float3& c2) noexcept
+			: columns{c0, c1, c2} {}
 
-			// -- public binary operators -------------------------------------
+			/* columns */
+			float3 columns[3];
+		};
 
-			/* add self */
-			inline constexpr auto operator+(const self& other) const noexcept -> self {
-				return self{*this} += other;
-			}
 
-			/* add value */
-			inline constexpr auto operator+(const value_type value) const noexcept -> self {
-				return self{*this} += value;
-			}
+		// -- F L O A T 4 X 4 -------------------------------------------------
 
-			/* subtract self */
-			inline constexpr auto operator-(const self& other) const noexcept -> self {
-				return self{*this} -= other;
-			}
+		struct float4x4 final {
 
-			/* subtract value */
-			inline constexpr auto operator-(const value_type value) const noexcept -> self {
-				return self{*this} -= value;
-			}
+			/* zero constructor */
+			inline constexpr float4x4(void) noexcept
+			: columns{} {}
 
-			/* multiply self */
-			inline constexpr auto operator*(const self& other) const noexcept -> self {
-				return self{*this} *= other;
-			}
+			/* diagonal constructor */
+			inline constexpr explicit float4x4(const float d) noexcept
+			: columns{float4{d, 0.0f, 0.0f, 0.0f}, float4{0.0f, d, 0.0f, 0.0f},
+					  float4{0.0f, 0.0f, d, 0.0f}, float4{0.0f, 0.0f, 0.0f, d}} {}
+
+			/* columns constructor */
+			inline constexpr float4x4(const float4& c0, const float4& c1, const float4& c2, const float4& c3) noexcept
+			: columns{c0, c1, c2, c3} {}
+
+			/* columns */
+			float4 columns[4];
+		};
+
+
+		// -- Q U A T F -------------------------------------------------------
+
+		struct quatf final {
+
+			/* identity constructor */
+			inline constexpr quatf(void) noexcept
+			: vector{0.0f, 0.0f, 0.0f, 1.0f} {}
 
-			/* multiply value */
-			inline constexpr auto operator*(const value_type value) const noexcept -> self {
-				return self{*this} *= value;
+			/* imaginary and real parts constructor */
+			inline constexpr quatf(const float ix, const float iy, const float iz, const float r) noexcept
+			: vector{ix, iy, iz, r} {}
+
+			/* vector constructor */
+			inline constexpr explicit quatf(const float4& v) noexcept
+			: vector{v} {}
+
+			/* rotation of angle radians around a unit axis */
+			inline quatf(const float angle, const float3& axis) noexcept
+			: vector{axis.x * std::sin(angle * 0.5f), axis.y * std::sin(angle * 0.5f),
+					 axis.z * std::sin(angle * 0.5f), std::cos(angle * 0.5f)} {}
+
+			/* imaginary part in xyz, real part in w */
+			float4 vector;
+		};
+
+
+		// -- L A N E S -------------------------------------------------------
+
+		/* four float lanes of the selected backend */
+
+		class lanes final {
+
+
+			public:
+
+				// -- public types --------------------------------------------
+
+				#if defined(ENGINE_SIMD_SSE)
+				/* register type */
+				using reg = __m128;
+				#elif defined(ENGINE_SIMD_NEON)
+				/* register type */
+				using reg = float32x4_t;
+				#else
+				/* register type */
+				struct reg final { float v[4]; };
+				#endif
+
+
+				// -- public lifecycle ----------------------------------------
+
+				/* non-instanciable class */
+				lanes(void) = delete;
+
+
+				// -- public static methods -----------------------------------
+
+				/* load four floats */
+				static inline auto load(const float* p) noexcept -> reg {
+					#if defined(ENGINE_SIMD_SSE)
+					return _mm_loadu_ps(p);
+					#elif defined(ENGINE_SIMD_NEON)
+					return vld1q_f32(p);
+					#else
+					return reg{{p[0], p[1], p[2], p[3]}};
+					#endif
+				}
+
+				/* store four floats */
+				static inline auto store(float* p, const reg r) noexcept -> void {
+					#if defined(ENGINE_SIMD_SSE)
+					_mm_storeu_ps(p, r);
+					#elif defined(ENGINE_SIMD_NEON)
+					vst1q_f32(p, r);
+					#else
+					p[0] = r.v[0]; p[1] = r.v[1]; p[2] = r.v[2]; p[3] = r.v[3];
+					#endif
+				}
+
+				/* same value in every lane */
+				static inline auto splat(const float s) noexcept -> reg {
+					#if defined(ENGINE_SIMD_SSE)
+					return _mm_set1_ps(s);
+					#elif defined(ENGINE_SIMD_NEON)
+					return vdupq_n_f32(s);
+					#else
+					return reg{{s, s, s, s}};
+					#endif
+				}
+
+				/* lane K in every lane */
+				template <int K>
+				static inline auto broadcast(const reg r) noexcept -> reg {
+					#if defined(ENGINE_SIMD_SSE)
+					return _mm_shuffle_ps(r, r, _MM_SHUFFLE(K, K, K, K));
+					#elif defined(ENGINE_SIMD_NEON)
+					return vdupq_laneq_f32(r, K);
+					#else
+					return reg{{r.v[K], r.v[K], r.v[K], r.v[K]}};
+					#endif
+				}
+
+				/* lane 3 cleared */
+				static inline auto clear_w(const reg r) noexcept -> reg {
+					#if defined(ENGINE_SIMD_SSE)
+					return _mm_and_ps(r, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+					#elif defined(ENGINE_SIMD_NEON)
+					return vsetq_lane_f32(0.0f, r, 3);
+					#else
+					return reg{{r.v[0], r.v[1], r.v[2], 0.0f}};
+					#endif
+				}
+
+				/* a + b */
+				static inline auto add(const reg a, const reg b) noexcept -> reg {
+					#if defined(ENGINE_SIMD_SSE)
+					return _mm_add_ps(a, b);
+					#elif defined(ENGINE_SIMD_NEON)
+					return vaddq_f32(a, b);
+					#else
+					return reg{{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}};
+					#endif
+				}
+
+				/* a - b */
+				static inline auto sub(const reg a, const reg b) noexcept -> reg {
+					#if defined(ENGINE_SIMD_SSE)
+					return _mm_sub_ps(a, b);
+					#elif defined(ENGINE_SIMD_NEON)
+					return vsubq_f32(a, b);
+					#else
+					return reg{{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}};
+					#endif
+				}
+
+				/* a * b */
+				static inline auto mul(const reg a, const reg b) noexcept -> reg {
+					#if defined(ENGINE_SIMD_SSE)
+					return _mm_mul_ps(a, b);
+					#elif defined(ENGINE_SIMD_NEON)
+					return vmulq_f32(a, b);
+					#else
+					return reg{{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}};
+					#endif
+				}
+
+				/* a / b */
+				static inline auto div(const reg a, const reg b) noexcept -> reg {
+					#if defined(ENGINE_SIMD_SSE)
+					return _mm_div_ps(a, b);
+					#elif defined(ENGINE_SIMD_NEON)
+					return vdivq_f32(a, b);
+					#else
+					return reg{{a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2], a.v[3] / b.v[3]}};
+					#endif
+				}
+
+				/* lane minimum */
+				static inline auto min(const reg a, const reg b) noexcept -> reg {
+					#if defined(ENGINE_SIMD_SSE)
+					return _mm_min_ps(a, b);
+					#elif defined(ENGINE_SIMD_NEON)
+					return vminq_f32(a, b);
+					#else
+					return reg{{a.v[0] < b.v[0] ? a.v[0] : b.v[0], a.v[1] < b.v[1] ? a.v[1] : b.v[1],
+								a.v[2] < b.v[2] ? a.v[2] : b.v[2], a.v[3] < b.v[3] ? a.v[3] : b.v[3]}};
+					#endif
+				}
+
+				/* lane maximum */
+				static inline auto max(const reg a, const reg b) noexcept -> reg {
+					#if defined(ENGINE_SIMD_SSE)
+					return _mm_max_ps(a, b);
+					#elif defined(ENGINE_SIMD_NEON)
+					return vmaxq_f32(a, b);
+					#else
+					return reg{{a.v[0] > b.v[0] ? a.v[0] : b.v[0], a.v[1] > b.v[1] ? a.v[1] : b.v[1],
+								a.v[2] > b.v[2] ? a.v[2] : b.v[2], a.v[3] > b.v[3] ? a.v[3] : b.v[3]}};
+					#endif
+				}
+
+				/* lane absolute value */
+				static inline auto abs(const reg a) noexcept -> reg {
+					#if defined(ENGINE_SIMD_SSE)
+					return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+					#elif defined(ENGINE_SIMD_NEON)
+					return vabsq_f32(a);
+					#else
+					return reg{{std::fabs(a.v[0]), std::fabs(a.v[1]), std::fabs(a.v[2]), std::fabs(a.v[3])}};
+					#endif
+				}
+
+				/* (x + y) + z of a * b */
+				static inline auto dot3(const reg a, const reg b) noexcept -> float {
+					#if defined(ENGINE_SIMD_SSE)
+					const __m128 m = _mm_mul_ps(a, b);
+					const __m128 s = _mm_add_ss(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 1, 1, 1)));
+					return _mm_cvtss_f32(_mm_add_ss(s, _mm_movehl_ps(m, m)));
+					#elif defined(ENGINE_SIMD_NEON)
+					const float32x4_t m = vmulq_f32(a, b);
+					return vget_lane_f32(vpadd_f32(vget_low_f32(m), vget_low_f32(m)), 0) + vgetq_lane_f32(m, 2);
+					#else
+					return ((a.v[0] * b.v[0]) + (a.v[1] * b.v[1])) + (a.v[2] * b.v[2]);
+					#endif
+				}
+
+				/* (x + y) + (z + w) of a * b */
+				static inline auto dot4(const reg a, const reg b) noexcept -> float {
+					#if defined(ENGINE_SIMD_SSE)
+					const __m128 m = _mm_mul_ps(a, b);
+					const __m128 s = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+					return _mm_cvtss_f32(_mm_add_ss(s, _mm_movehl_ps(s, s)));
+					#elif defined(ENGINE_SIMD_NEON)
+					const float32x4_t m = vmulq_f32(a, b);
+					const float32x2_t p = vpadd_f32(vget_low_f32(m), vget_high_f32(m));
+					return vget_lane_f32(p, 0) + vget_lane_f32(p, 1);
+					#else
+					return ((a.v[0] * b.v[0]) + (a.v[1] * b.v[1])) + ((a.v[2] * b.v[2]) + (a.v[3] * b.v[3]));
+					#endif
+				}
+
+				/* cross product of the xyz lanes, lane 3 cleared */
+				static inline auto cross(const reg a, const reg b) noexcept -> reg {
+					#if defined(ENGINE_SIMD_SSE)
+					const __m128 a_yzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+					const __m128 b_yzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+					const __m128 c = _mm_sub_ps(_mm_mul_ps(a, b_yzx), _mm_mul_ps(a_yzx, b));
+					return self::clear_w(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)));
+					#elif defined(ENGINE_SIMD_NEON)
+					const float32x4_t a_yzx = self::yzx(a);
+					const float32x4_t b_yzx = self::yzx(b);
+					const float32x4_t c = vsubq_f32(vmulq_f32(a, b_yzx), vmulq_f32(a_yzx, b));
+					return self::clear_w(self::yzx(c));
+					#else
+					return reg{{(a.v[1] * b.v[2]) - (a.v[2] * b.v[1]),
+								(a.v[2] * b.v[0]) - (a.v[0] * b.v[2]),
+								(a.v[0] * b.v[1]) - (a.v[1] * b.v[0]), 0.0f}};
+					#endif
+				}
+
+				/* ((c0 * v.x + c1 * v.y) + c2 * v.z) + c3 * v.w */
+				static inline auto combine(const reg c0, const reg c1, const reg c2, const reg c3, const reg v) noexcept -> reg {
+					reg r = self::mul(c0, self::broadcast<0>(v));
+					r = self::add(r, self::mul(c1, self::broadcast<1>(v)));
+					r = self::add(r, self::mul(c2, self::broadcast<2>(v)));
+					return self::add(r, self::mul(c3, self::broadcast<3>(v)));
+				}
+
+				/* (c0 * v.x + c1 * v.y) + c2 * v.z */
+				static inline auto combine(const reg c0, const reg c1, const reg c2, const reg v) noexcept -> reg {
+					reg r = self::mul(c0, self::broadcast<0>(v));
+					r = self::add(r, self::mul(c1, self::broadcast<1>(v)));
+					return self::add(r, self::mul(c2, self::broadcast<2>(v)));
+				}
+
+
+			private:
+
+				// -- private types -------------------------------------------
+
+				/* self type */
+				using self = engine::simd::lanes;
+
+
+				// -- private static methods ----------------------------------
+
+				#if defined(ENGINE_SIMD_NEON)
+				/* y z x y */
+				static inline auto yzx(const float32x4_t a) noexcept -> float32x4_t {
+					return vcombine_f32(vext_f32(vget_low_f32(a), vget_high_f32(a), 1), vget_low_f32(a));
+				}
+				#endif
+
+		};
+
+
+		// -- vector operators ------------------------------------------------
+
+		/* a + b */
+		template <vector_type V>
+		inline constexpr auto operator+(const V& a, const V& b) noexcept -> V {
+			if constexpr (wide_type<V>)
+				if (not std::is_constant_evaluated()) {
+					V r;
+					lanes::store(&r.x, lanes::add(lanes::load(&a.x), lanes::load(&b.x)));
+					return r;
+				}
+			V r;
+			for (std::size_t i = 0U; i < V::size; ++i)
+				r[i] = a[i] + b[i];
+			return r;
+		}
+
+		/* a - b */
+		template <vector_type V>
+		inline constexpr auto operator-(const V& a, const V& b) noexcept -> V {
+			if constexpr (wide_type<V>)
+				if (not std::is_constant_evaluated()) {
+					V r;
+					lanes::store(&r.x, lanes::sub(lanes::load(&a.x), lanes::load(&b.x)));
+					return r;
+				}
+			V r;
+			for (std::size_t i = 0U; i < V::size; ++i)
+				r[i] = a[i] - b[i];
+			return r;
+		}
+
+		/* a * b, lane by lane */
+		template <vector_type V>
+		inline constexpr auto operator*(const V& a, const V& b) noexcept -> V {
+			if constexpr (wide_type<V>)
+				if (not std::is_constant_evaluated()) {
+					V r;
+					lanes::store(&r.x, lanes::mul(lanes::load(&a.x), lanes::load(&b.x)));
+					return r;
+				}
+			V r;
+			for (std::size_t i = 0U; i < V::size; ++i)
+				r[i] = a[i] * b[i];
+			return r;
+		}
+
+		/* a / b, lane by lane */
+		template <vector_type V>
+		inline constexpr auto operator/(const V& a, const V& b) noexcept -> V {
+			if constexpr (wide_type<V>)
+				if (not std::is_constant_evaluated()) {
+					V r;
+					auto q = lanes::div(lanes::load(&a.x), lanes::load(&b.x));
+					// float3 padding divides zero by zero
+					if constexpr (V::size == 3U)
+						q = lanes::clear_w(q);
+					lanes::store(&r.x, q);
+					return r;
+				}
+			V r;
+			for (std::size_t i = 0U; i < V::size; ++i)
+				r[i] = a[i] / b[i];
+			return r;
+		}
+
+		/* v * s */
+		template <vector_type V>
+		inline constexpr auto operator*(const V& v, const float s) noexcept -> V {
+			if constexpr (wide_type<V>)
+				if (not std::is_constant_evaluated()) {
+					V r;
+					lanes::store(&r.x, lanes::mul(lanes::load(&v.x), lanes::splat(s)));
+					return r;
+				}
+			V r;
+			for (std::size_t i = 0U; i < V::size; ++i)
+				r[i] = v[i] * s;
+			return r;
+		}
+
+		/* s * v */
+		template <vector_type V>
+		inline constexpr auto operator*(const float s, const V& v) noexcept -> V {
+			return v * s;
+		}
+
+		/* v / s */
+		template <vector_type V>
+		inline constexpr auto operator/(const V& v, const float s) noexcept -> V {
+			if constexpr (wide_type<V>)
+				if (not std::is_constant_evaluated()) {
+					V r;
+					auto q = lanes::div(lanes::load(&v.x), lanes::splat(s));
+					if constexpr (V::size == 3U)
+						q = lanes::clear_w(q);
+					lanes::store(&r.x, q);
+					return r;
+				}
+			V r;
+			for (std::size_t i = 0U; i < V::size; ++i)
+				r[i] = v[i] / s;
+			return r;
+		}
+
+		/* -v */
+		template <vector_type V>
+		inline constexpr auto operator-(const V& v) noexcept -> V {
+			return V{} - v;
+		}
+
+		/* a += b */
+		template <vector_type V>
+		inline constexpr auto operator+=(V& a, const V& b) noexcept -> V& {
+			return a = a + b;
+		}
+
+		/* a -= b */
+		template <vector_type V>
+		inline constexpr auto operator-=(V& a, const V& b) noexcept -> V& {
+			return a = a - b;
+		}
+
+		/* a *= b */
+		template <vector_type V>
+		inline constexpr auto operator*=(V& a, const V& b) noexcept -> V& {
+			return a = a * b;
+		}
+
+		/* a /= b */
+		template <vector_type V>
+		inline constexpr auto operator/=(V& a, const V& b) noexcept -> V& {
+			return a = a / b;
+		}
+
+		/* v *= s */
+		template <vector_type V>
+		inline constexpr auto operator*=(V& v, const float s) noexcept -> V& {
+			return v = v * s;
+		}
+
+		/* v /= s */
+		template <vector_type V>
+		inline constexpr auto operator/=(V& v, const float s) noexcept -> V& {
+			return v = v / s;
+		}
+
+
+		// -- vector functions ------------------------------------------------
+
+		/* dot product, (x + y) + (z + w) on every backend */
+		template <vector_type V>
+		inline constexpr auto dot(const V& a, const V& b) noexcept -> float {
+			if constexpr (wide_type<V>)
+				if (not std::is_constant_evaluated()) {
+					if constexpr (V::size == 3U)
+						return lanes::dot3(lanes::load(&a.x), lanes::load(&b.x));
+					else
+						return lanes::dot4(lanes::load(&a.x), lanes::load(&b.x));
+				}
+			if constexpr (V::size == 2U)
+				return (a.x * b.x) + (a.y * b.y);
+			else if constexpr (V::size == 3U)
+				return ((a.x * b.x) + (a.y * b.y)) + (a.z * b.z);
+			else
+				return ((a.x * b.x) + (a.y * b.y)) + ((a.z * b.z) + (a.w * b.w));
+		}
+
+		/* cross product */
+		inline constexpr auto cross(const float3& a, const float3& b) noexcept -> float3 {
+			if (not std::is_constant_evaluated()) {
+				float3 r;
+				lanes::store(&r.x, lanes::cross(lanes::load(&a.x), lanes::load(&b.x)));
+				return r;
+			}
+			return float3{(a.y * b.z) - (a.z * b.y), (a.z * b.x) - (a.x * b.z), (a.x * b.y) - (a.y * b.x)};
+		}
+
+		/* squared length */
+		template <vector_type V>
+		inline constexpr auto length_squared(const V& v) noexcept -> float {
+			return simd::dot(v, v);
+		}
+
+		/* length */
+		template <vector_type V>
+		inline auto length(const V& v) noexcept -> float {
+			return std::sqrt(simd::dot(v, v));
+		}
+
+		/* unit vector (no check against zero length) */
+		template <vector_type V>
+		inline auto normalize(const V& v) noexcept -> V {
+			return v * (1.0f / simd::length(v));
+		}
+
+		/* squared distance */
+		template <vector_type V>
+		inline constexpr auto distance_squared(const V& a, const V& b) noexcept -> float {
+			return simd::length_squared(a - b);
+		}
+
+		/* distance */
+		template <vector_type V>
+		inline auto distance(const V& a, const V& b) noexcept -> float {
+			return simd::length(a - b);
+		}
+
+		/* lane minimum */
+		template <vector_type V>
+		inline constexpr auto min(const V& a, const V& b) noexcept -> V {
+			if constexpr (wide_type<V>)
+				if (not std::is_constant_evaluated()) {
+					V r;
+					lanes::store(&r.x, lanes::min(lanes::load(&a.x), lanes::load(&b.x)));
+					return r;
+				}
+			V r;
+			for (std::size_t i = 0U; i < V::size; ++i)
+				r[i] = a[i] < b[i] ? a[i] : b[i];
+			return r;
+		}
+
+		/* lane maximum */
+		template <vector_type V>
+		inline constexpr auto max(const V& a, const V& b) noexcept -> V {
+			if constexpr (wide_type<V>)
+				if (not std::is_constant_evaluated()) {
+					V r;
+					lanes::store(&r.x, lanes::max(lanes::load(&a.x), lanes::load(&b.x)));
+					return r;
+				}
+			V r;
+			for (std::size_t i = 0U; i < V::size; ++i)
+				r[i] = a[i] > b[i] ? a[i] : b[i];
+			return r;
+		}
+
+		/* lane absolute value */
+		template <vector_type V>
+		inline constexpr auto abs(const V& v) noexcept -> V {
+			if constexpr (wide_type<V>)
+				if (not std::is_constant_evaluated()) {
+					V r;
+					lanes::store(&r.x, lanes::abs(lanes::load(&v.x)));
+					return r;
+				}
+			V r;
+			for (std::size_t i = 0U; i < V::size; ++i)
+				r[i] = v[i] < 0.0f ? -v[i] : v[i];
+			return r;
+		}
+
+		/* lanes clamped to [lo, hi] */
+		template <vector_type V>
+		inline constexpr auto clamp(const V& v, const V& lo, const V& hi) noexcept -> V {
+			return simd::min(simd::max(v, lo), hi);
+		}
+
+		/* a + (b - a) * t */
+		template <vector_type V>
+		inline constexpr auto mix(const V& a, const V& b, const float t) noexcept -> V {
+			return a + ((b - a) * t);
+		}
+
+
+		// -- matrix functions ------------------------------------------------
+
+		/* m * v */
+		inline constexpr auto operator*(const float4x4& m, const float4& v) noexcept -> float4 {
+			if (not std::is_constant_evaluated()) {
+				float4 r;
+				lanes::store(&r.x, lanes::combine(lanes::load(&m.columns[0].x), lanes::load(&m.columns[1].x),
+												  lanes::load(&m.columns[2].x), lanes::load(&m.columns[3].x),
+												  lanes::load(&v.x)));
+				return r;
+			}
+			return (((m.columns[0] * v.x) + (m.columns[1] * v.y)) + (m.columns[2] * v.z)) + (m.columns[3] * v.w);
+		}
+
+		/* a * b */
+		inline constexpr auto operator*(const float4x4& a, const float4x4& b) noexcept -> float4x4 {
+
+			if (std::is_constant_evaluated())
+				return float4x4{a * b.columns[0], a * b.columns[1], a * b.columns[2], a * b.columns[3]};
+
+			float4x4 r;
+
+			#if defined(ENGINE_SIMD_SSE) && defined(__AVX__)
+			// two result columns per register
+			auto pair = [](const float* p) noexcept -> __m256 {
+				const __m128 c = _mm_loadu_ps(p);
+				return _mm256_insertf128_ps(_mm256_castps128_ps256(c), c, 1);
+			};
+
+			const __m256 a0 = pair(&a.columns[0].x);
+			const __m256 a1 = pair(&a.columns[1].x);
+			const __m256 a2 = pair(&a.columns[2].x);
+			const __m256 a3 = pair(&a.columns[3].x);
+
+			for (unsigned int j = 0U; j < 4U; j += 2U) {
+				const __m256 v = _mm256_loadu_ps(&b.columns[j].x);
+				__m256 c = _mm256_mul_ps(a0, _mm256_permute_ps(v, 0x00));
+				c = _mm256_add_ps(c, _mm256_mul_ps(a1, _mm256_permute_ps(v, 0x55)));
+				c = _mm256_add_ps(c, _mm256_mul_ps(a2, _mm256_permute_ps(v, 0xaa)));
+				c = _mm256_add_ps(c, _mm256_mul_ps(a3, _mm256_permute_ps(v, 0xff)));
+				_mm256_storeu_ps(&r.columns[j].x, c);
+			}
+			#else
+			const auto c0 = lanes::load(&a.columns[0].x);
+			const auto c1 = lanes::load(&a.columns[1].x);
+			const auto c2 = lanes::load(&a.columns[2].x);
+			const auto c3 = lanes::load(&a.columns[3].x);
+
+			for (unsigned int j = 0U; j < 4U; ++j)
+				lanes::store(&r.columns[j].x, lanes::combine(c0, c1, c2, c3, lanes::load(&b.columns[j].x)));
+			#endif
+
+			return r;
+		}
+
+		/* m * v */
+		inline constexpr auto operator*(const float3x3& m, const float3& v) noexcept -> float3 {
+			if (not std::is_constant_evaluated()) {
+				float3 r;
+				lanes::store(&r.x, lanes::combine(lanes::load(&m.columns[0].x), lanes::load(&m.columns[1].x),
+												  lanes::load(&m.columns[2].x), lanes::load(&v.x)));
+				return r;
+			}
+			return ((m.columns[0] * v.x) + (m.columns[1] * v.y)) + (m.columns[2] * v.z);
+		}
+
+		/* a * b */
+		inline constexpr auto operator*(const float3x3& a, const float3x3& b) noexcept -> float3x3 {
+			return float3x3{a * b.columns[0], a * b.columns[1], a * b.columns[2]};
+		}
+
+		/* m * s */
+		inline constexpr auto operator*(const float3x3& m, const float s) noexcept -> float3x3 {
+			return float3x3{m.columns[0] * s, m.columns[1] * s, m.columns[2] * s};
+		}
+
+		/* m * s */
+		inline constexpr auto operator*(const float4x4& m, const float s) noexcept -> float4x4 {
+			return float4x4{m.columns[0] * s, m.columns[1] * s, m.columns[2] * s, m.columns[3] * s};
+		}
+
+		/* a * b */
+		inline constexpr auto mul(const float4x4& a, const float4x4& b) noexcept -> float4x4 {
+			return a * b;
+		}
+
+		/* m * v */
+		inline constexpr auto mul(const float4x4& m, const float4& v) noexcept -> float4 {
+			return m * v;
+		}
+
+		/* a * b */
+		inline constexpr auto mul(const float3x3& a, const float3x3& b) noexcept -> float3x3 {
+			return a * b;
+		}
+
+		/* m * v */
+		inline constexpr auto mul(const float3x3& m, const float3& v) noexcept -> float3 {
+			return m * v;
+		}
+
+		/* transpose */
+		inline constexpr auto transpose(const float4x4& m) noexcept -> float4x4 {
+
+			if (not std::is_constant_evaluated()) {
+				float4x4 r;
+				#if defined(ENGINE_SIMD_SSE)
+				__m128 c0 = _mm_loadu_ps(&m.columns[0].x), c1 = _mm_loadu_ps(&m.columns[1].x);
+				__m128 c2 = _mm_loadu_ps(&m.columns[2].x), c3 = _mm_loadu_ps(&m.columns[3].x);
+				_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+				_mm_storeu_ps(&r.columns[0].x, c0); _mm_storeu_ps(&r.columns[1].x, c1);
+				_mm_storeu_ps(&r.columns[2].x, c2); _mm_storeu_ps(&r.columns[3].x, c3);
+				return r;
+				#elif defined(ENGINE_SIMD_NEON)
+				const float32x4x2_t t0 = vzipq_f32(vld1q_f32(&m.columns[0].x), vld1q_f32(&m.columns[2].x));
+				const float32x4x2_t t1 = vzipq_f32(vld1q_f32(&m.columns[1].x), vld1q_f32(&m.columns[3].x));
+				const float32x4x2_t r0 = vzipq_f32(t0.val[0], t1.val[0]);
+				const float32x4x2_t r1 = vzipq_f32(t0.val[1], t1.val[1]);
+				vst1q_f32(&r.columns[0].x, r0.val[0]); vst1q_f32(&r.columns[1].x, r0.val[1]);
+				vst1q_f32(&r.columns[2].x, r1.val[0]); vst1q_f32(&r.columns[3].x, r1.val[1]);
+				return r;
+				#endif
 			}
 
-			/* divide self */
-			inline constexpr auto operator/(const self& other) const noexcept -> self {
-				return self{*this} /= other;
+			float4x4 r;
+			for (std::size_t i = 0U; i < 4U; ++i)
+				for (std::size_t j = 0U; j < 4U; ++j)
+					r.columns[i][j] = m.columns[j][i];
+			return r;
+		}
+
+		/* transpose */
+		inline constexpr auto transpose(const float3x3& m) noexcept -> float3x3 {
+			return float3x3{float3{m.columns[0].x, m.columns[1].x, m.columns[2].x},
+							float3{m.columns[0].y, m.columns[1].y, m.columns[2].y},
+							float3{m.columns[0].z, m.columns[1].z, m.columns[2].z}};
+		}
+
+		/* determinant */
+		inline constexpr auto determinant(const float3x3& m) noexcept -> float {
+			return simd::dot(m.columns[0], simd::cross(m.columns[1], m.columns[2]));
+		}
+
+		/* inverse (no check against a singular matrix) */
+		inline constexpr auto inverse(const float3x3& m) noexcept -> float3x3 {
+			// rows of the inverse are the cross products of the columns
+			const float3 r0 = simd::cross(m.columns[1], m.columns[2]);
+			const float3 r1 = simd::cross(m.columns[2], m.columns[0]);
+			const float3 r2 = simd::cross(m.columns[0], m.columns[1]);
+			return simd::transpose(float3x3{r0, r1, r2}) * (1.0f / simd::dot(m.columns[0], r0));
+		}
+
+		/* determinant */
+		inline constexpr auto determinant(const float4x4& m) noexcept -> float {
+			const float4 c0 = m.columns[0], c1 = m.columns[1], c2 = m.columns[2], c3 = m.columns[3];
+			const float s0 = c0.x * c1.y - c1.x * c0.y, s1 = c0.x * c1.z - c1.x * c0.z;
+			const float s2 = c0.x * c1.w - c1.x * c0.w, s3 = c0.y * c1.z - c1.y * c0.z;
+			const float s4 = c0.y * c1.w - c1.y * c0.w, s5 = c0.z * c1.w - c1.z * c0.w;
+			const float t5 = c2.z * c3.w - c3.z * c2.w, t4 = c2.y * c3.w - c3.y * c2.w;
+			const float t3 = c2.y * c3.z - c3.y * c2.z, t2 = c2.x * c3.w - c3.x * c2.w;
+			const float t1 = c2.x * c3.z - c3.x * c2.z, t0 = c2.x * c3.y - c3.x * c2.y;
+			return s0 * t5 - s1 * t4 + s2 * t3 + s3 * t2 - s4 * t1 + s5 * t0;
+		}
+
+		/* inverse by cofactors (no check against a singular matrix) */
+		inline constexpr auto inverse(const float4x4& m) noexcept -> float4x4 {
+
+			// 2x2 minors of the first two and the last two columns
+			const float4 c0 = m.columns[0], c1 = m.columns[1], c2 = m.columns[2], c3 = m.columns[3];
+			const float s0 = c0.x * c1.y - c1.x * c0.y, s1 = c0.x * c1.z - c1.x * c0.z;
+			const float s2 = c0.x * c1.w - c1.x * c0.w, s3 = c0.y * c1.z - c1.y * c0.z;
+			const float s4 = c0.y * c1.w - c1.y * c0.w, s5 = c0.z * c1.w - c1.z * c0.w;
+			const float t5 = c2.z * c3.w - c3.z * c2.w, t4 = c2.y * c3.w - c3.y * c2.w;
+			const float t3 = c2.y * c3.z - c3.y * c2.z, t2 = c2.x * c3.w - c3.x * c2.w;
+			const float t1 = c2.x * c3.z - c3.x * c2.z, t0 = c2.x * c3.y - c3.x * c2.y;
+
+			const float d = 1.0f / (s0 * t5 - s1 * t4 + s2 * t3 + s3 * t2 - s4 * t1 + s5 * t0);
+
+			return float4x4{
+				float4{( c1.y * t5 - c1.z * t4 + c1.w * t3) * d,
+					   (-c0.y * t5 + c0.z * t4 - c0.w * t3) * d,
+					   ( c3.y * s5 - c3.z * s4 + c3.w * s3) * d,
+					   (-c2.y * s5 + c2.z * s4 - c2.w * s3) * d},
+				float4{(-c1.x * t5 + c1.z * t2 - c1.w * t1) * d,
+					   ( c0.x * t5 - c0.z * t2 + c0.w * t1) * d,
+					   (-c3.x * s5 + c3.z * s2 - c3.w * s1) * d,
+					   ( c2.x * s5 - c2.z * s2 + c2.w * s1) * d},
+				float4{( c1.x * t4 - c1.y * t2 + c1.w * t0) * d,
+					   (-c0.x * t4 + c0.y * t2 - c0.w * t0) * d,
+					   ( c3.x * s4 - c3.y * s2 + c3.w * s0) * d,
+					   (-c2.x * s4 + c2.y * s2 - c2.w * s0) * d},
+				float4{(-c1.x * t3 + c1.y * t1 - c1.z * t0) * d,
+					   ( c0.x * t3 - c0.y * t1 + c0.z * t0) * d,
+					   (-c3.x * s3 + c3.y * s1 - c3.z * s0) * d,
+					   ( c2.x * s3 - c2.y * s1 + c2.z * s0) * d}
+			};
+		}
+
+
+		// -- quaternion functions --------------------------------------------
+
+		/* imaginary part */
+		inline constexpr auto imag(const quatf& q) noexcept -> float3 {
+			return float3{q.vector.x, q.vector.y, q.vector.z};
+		}
+
+		/* real part */
+		inline constexpr auto real(const quatf& q) noexcept -> float {
+			return q.vector.w;
+		}
+
+		/* hamilton product, b applied first: ((aw b + ax b1) + ay b2) + az b3
+		   with b1 = (bw, -bz, by, -bx), b2 = (bz, bw, -bx, -by), b3 = (-by, bx, bw, -bz) */
+		inline constexpr auto operator*(const quatf& a, const quatf& b) noexcept -> quatf {
+
+			if (not std::is_constant_evaluated()) {
+				quatf r;
+				#if defined(ENGINE_SIMD_SSE)
+				const __m128 q = _mm_loadu_ps(&b.vector.x);
+				const __m128 p = _mm_loadu_ps(&a.vector.x);
+				const __m128 b1 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(0, 1, 2, 3)), _mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f));
+				const __m128 b2 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(1, 0, 3, 2)), _mm_setr_ps(1.0f, 1.0f, -1.0f, -1.0f));
+				const __m128 b3 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(2, 3, 0, 1)), _mm_setr_ps(-1.0f, 1.0f, 1.0f, -1.0f));
+				__m128 c = _mm_mul_ps(lanes::broadcast<3>(p), q);
+				c = _mm_add_ps(c, _mm_mul_ps(lanes::broadcast<0>(p), b1));
+				c = _mm_add_ps(c, _mm_mul_ps(lanes::broadcast<1>(p), b2));
+				c = _mm_add_ps(c, _mm_mul_ps(lanes::broadcast<2>(p), b3));
+				_mm_storeu_ps(&r.vector.x, c);
+				return r;
+				#elif defined(ENGINE_SIMD_NEON)
+				static constexpr float s1[4] { 1.0f, -1.0f, 1.0f, -1.0f };
+				static constexpr float s2[4] { 1.0f, 1.0f, -1.0f, -1.0f };
+				static constexpr float s3[4] { -1.0f, 1.0f, 1.0f, -1.0f };
+				const float32x4_t q = vld1q_f32(&b.vector.x);
+				const float32x4_t p = vld1q_f32(&a.vector.x);
+				const float32x4_t yxwz = vrev64q_f32(q);
+				const float32x4_t b1 = vmulq_f32(vcombine_f32(vget_high_f32(yxwz), vget_low_f32(yxwz)), vld1q_f32(s1));
+				const float32x4_t b2 = vmulq_f32(vcombine_f32(vget_high_f32(q), vget_low_f32(q)), vld1q_f32(s2));
+				const float32x4_t b3 = vmulq_f32(yxwz, vld1q_f32(s3));
+				float32x4_t c = vmulq_laneq_f32(q, p, 3);
+				c = vaddq_f32(c, vmulq_laneq_f32(b1, p, 0));
+				c = vaddq_f32(c, vmulq_laneq_f32(b2, p, 1));
+				c = vaddq_f32(c, vmulq_laneq_f32(b3, p, 2));
+				vst1q_f32(&r.vector.x, c);
+				return r;
+				#endif
 			}
 
-			/* divide value */
-			inline constexpr auto operator/(const value_type value) const noexcept -> self {
-				return self{*this} /= value;
+			const float ax = a.vector.x, ay = a.vector.y, az = a.vector.z, aw = a.vector.w;
+			const float bx = b.vector.x, by = b.vector.y, bz = b.vector.z, bw = b.vector.w;
+
+			return quatf{((aw * bx + ax * bw) + ay * bz) + az * -by,
+						 ((aw * by + ax * -bz) + ay * bw) + az * bx,
+						 ((aw * bz + ax * by) + ay * -bx) + az * bw,
+						 ((aw * bw + ax * -bx) + ay * -by) + az * -bz};
+		}
+
+		/* dot product */
+		inline constexpr auto dot(const quatf& a, const quatf& b) noexcept -> float {
+			return simd::dot(a.vector, b.vector);
+		}
+
+		/* length */
+		inline auto length(const quatf& q) noexcept -> float {
+			return simd::length(q.vector);
+		}
+
+		/* unit quaternion */
+		inline auto normalize(const quatf& q) noexcept -> quatf {
+			return quatf{simd::normalize(q.vector)};
+		}
+
+		/* conjugate */
+		inline constexpr auto conjugate(const quatf& q) noexcept -> quatf {
+			return quatf{-q.vector.x, -q.vector.y, -q.vector.z, q.vector.w};
+		}
+
+		/* inverse */
+		inline constexpr auto inverse(const quatf& q) noexcept -> quatf {
+			return quatf{simd::conjugate(q).vector * (1.0f / simd::dot(q.vector, q.vector))};
+		}
+
+		/* v rotated by the unit quaternion q */
+		inline constexpr auto act(const quatf& q, const float3& v) noexcept -> float3 {
+			// v + 2w (u x v) + 2 u x (u x v)
+			const float3 u = simd::imag(q);
+			const float3 t = simd::cross(u, v) * 2.0f;
+			return (v + (t * q.vector.w)) + simd::cross(u, t);
+		}
+
+		/* rotation matrix of the unit quaternion q */
+		inline constexpr auto matrix3x3(const quatf& q) noexcept -> float3x3 {
+			const float x = q.vector.x, y = q.vector.y, z = q.vector.z, w = q.vector.w;
+			return float3x3{
+				float3{1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y + z * w), 2.0f * (x * z - y * w)},
+				float3{2.0f * (x * y - z * w), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z + x * w)},
+				float3{2.0f * (x * z + y * w), 2.0f * (y * z - x * w), 1.0f - 2.0f * (x * x + y * y)}
+			};
+		}
+
+		/* rotation matrix of the unit quaternion q */
+		inline constexpr auto matrix4x4(const quatf& q) noexcept -> float4x4 {
+			const float3x3 r = simd::matrix3x3(q);
+			return float4x4{float4{r.columns[0], 0.0f}, float4{r.columns[1], 0.0f},
+							float4{r.columns[2], 0.0f}, float4{0.0f, 0.0f, 0.0f, 1.0f}};
+		}
+
+		/* normalized linear interpolation along the shorter arc (slerp's path,
+		   not its constant speed) */
+		inline auto nlerp(const quatf& a, const quatf& b, const float t) noexcept -> quatf {
+			const float4 to = simd::dot(a.vector, b.vector) < 0.0f ? -b.vector : b.vector;
+			return simd::normalize(quatf{simd::mix(a.vector, to, t)});
+		}
+
+		/* spherical interpolation along the shorter arc */
+		inline auto slerp(const quatf& a, const quatf& b, const float t) noexcept -> quatf {
+
+			float4 to = b.vector;
+			float d = simd::dot(a.vector, to);
+
+			if (d < 0.0f) {
+				to = -to;
+				d  = -d;
 			}
 
+			// nearly parallel, a normalized lerp is exact enough
+			if (d > 0.9995f)
+				return simd::normalize(quatf{simd::mix(a.vector, to, t)});
+
+			const float angle = std::acos(d);
+			const float s = 1.0f / std::sin(angle);
+			return quatf{(a.vector * (std::sin((1.0f - t) * angle) * s)) + (to * (std::sin(t * angle) * s))};
+		}
 
-		private:
 
-			// -- private members ---------------------------------------------
+		// -- layout checks ---------------------------------------------------
 
-			/* data */
-			underlying _data;
+		static_assert(sizeof(float2)   ==  8U && alignof(float2) ==  8U, "float2 must match the shader layout");
+		static_assert(sizeof(float3)   == 16U && alignof(float3) == 16U, "float3 must match the shader layout");
+		static_assert(sizeof(float4)   == 16U && alignof(float4) == 16U, "float4 must match the shader layout");
+		static_assert(sizeof(float3x3) == 48U, "float3x3 must match the shader layout");
+		static_assert(sizeof(float4x4) == 64U, "float4x4 must match the shader layout");
+		static_assert(sizeof(quatf)    == 16U, "quatf must match the shader layout");
 
-	};
+	} // namespace simd
 
 }
 
-#endif // SIMD_HEADER
+#endif // ENGINE_SIMD_HEADER
@@ -0,0 +1,27 @@
+// -- S I M D  K E R N E L S --------------------------------------------------
+
+/* no include guard: the kernels of the runtime dispatch, included by
+   simd_pack.hpp once per instruction set in namespace engine::simd::<set>,
+   inside the target region of the set, where pack names the lanes of the
+   set; a kernel written against the lanes joins the dispatch by being
+   included below, everything it calls included before it */
+
+
+/* S::apply<L>(i, args...) over [0, count): whole packs first, then the
+   remainder one by one on wide_scalar */
+template <typename S, typename... A>
+inline auto sweep(const std::size_t count, A&&... args) noexcept -> void {
+
+	std::size_t i = 0U;
+
+	for (; i + pack::size <= count; i += pack::size)
+		S::template apply<pack>(i, args...);
+
+	for (; i < count; ++i)
+		S::template apply<simd::wide_scalar>(i, args...);
+}
+
+
+#include "transcendental_kernel.hpp"
+#include "quaternion_kernels.hpp"
+#include "transform_kernels.hpp"
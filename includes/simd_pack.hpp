@@ -0,0 +1,154 @@
+#ifndef ENGINE_SIMD_PACK_HEADER
+#define ENGINE_SIMD_PACK_HEADER
+
+#include "simd.hpp"
+#include "simd_target.hpp"
+#include "simd_wide.hpp"
+#include "transcendental.hpp"
+
+#include <cstddef>
+
+
+// -- S I M D  P A C K S ------------------------------------------------------
+
+/* the kernels of simd_kernels.hpp compiled once per instruction set of
+   simd::sets, each copy in namespace engine::simd::<set> inside the target
+   region of the set, pack naming the widest lanes the set runs: scalar
+   (wide_scalar), sse4.2 (wide_sse), avx2 (wide_avx) and avx-512
+   (wide_avx512) on x86-64, scalar and neon (wide_neon) on arm64; callers
+   go through ENGINE_SIMD_CHOOSE, which picks the copy of the set detected
+   at startup, or name a set to compare them */
+
+
+// -- scalar ------------------------------------------------------------------
+
+namespace engine {
+	namespace simd {
+		namespace scalar {
+
+			/* lanes of the set */
+			using pack = simd::wide_scalar;
+
+			#include "simd_kernels.hpp"
+		}
+	}
+}
+
+
+#if defined(ENGINE_SIMD_DISPATCH)
+
+// -- sse4.2 ------------------------------------------------------------------
+
+ENGINE_SIMD_TARGET_SSE42
+
+namespace engine {
+	namespace simd {
+		namespace sse42 {
+
+			/* lanes of the set */
+			using pack = simd::wide_sse;
+
+			#include "simd_kernels.hpp"
+		}
+	}
+}
+
+ENGINE_SIMD_TARGET_END
+
+
+// -- avx2 --------------------------------------------------------------------
+
+ENGINE_SIMD_TARGET_AVX2
+
+namespace engine {
+	namespace simd {
+		namespace avx2 {
+
+			/* lanes of the set */
+			using pack = simd::wide_avx;
+
+			#include "simd_kernels.hpp"
+		}
+	}
+}
+
+ENGINE_SIMD_TARGET_END
+
+
+// -- avx-512 -----------------------------------------------------------------
+
+ENGINE_SIMD_TARGET_AVX512
+
+namespace engine {
+	namespace simd {
+		namespace avx512 {
+
+			/* lanes of the set */
+			using pack = simd::wide_avx512;
+
+			#include "simd_kernels.hpp"
+		}
+	}
+}
+
+ENGINE_SIMD_TARGET_END
+
+#elif defined(ENGINE_SIMD_NEON)
+
+// -- neon --------------------------------------------------------------------
+
+namespace engine {
+	namespace simd {
+		namespace neon {
+
+			/* lanes of the set */
+			using pack = simd::wide_neon;
+
+			#include "simd_kernels.hpp"
+		}
+	}
+}
+
+#endif
+
+
+// -- D I S P A T C H ---------------------------------------------------------
+
+/* name of the selected set's copy of a kernel (or of any name the sets
+   define), one of engine::simd::<set>::name in the order of simd::sets;
+   pointers to kernels are worth keeping in a function-local static */
+
+#if defined(ENGINE_SIMD_DISPATCH)
+#	define ENGINE_SIMD_CHOOSE(name) \
+		engine::simd::choose(engine::simd::scalar::name, engine::simd::sse42::name, \
+							 engine::simd::avx2::name,   engine::simd::avx512::name)
+#elif defined(ENGINE_SIMD_NEON)
+#	define ENGINE_SIMD_CHOOSE(name) \
+		engine::simd::choose(engine::simd::scalar::name, engine::simd::neon::name)
+#else
+#	define ENGINE_SIMD_CHOOSE(name) \
+		engine::simd::choose(engine::simd::scalar::name)
+#endif
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- S I M D  N A M E S P A C E ------------------------------------------
+
+	namespace simd {
+
+
+		/* floats per pack of the selected set */
+		inline auto width(void) noexcept -> std::size_t {
+			static const std::size_t size = ENGINE_SIMD_CHOOSE(pack::size);
+			return size;
+		}
+
+	} // namespace simd
+
+}
+
+#endif // ENGINE_SIMD_PACK_HEADER
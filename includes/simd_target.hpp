@@ -0,0 +1,155 @@
+#ifndef ENGINE_SIMD_TARGET_HEADER
+#define ENGINE_SIMD_TARGET_HEADER
+
+#include "simd.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+
+// -- T A R G E T  R E G I O N S ----------------------------------------------
+
+/* functions defined between ENGINE_SIMD_TARGET_<SET> and ENGINE_SIMD_TARGET_END
+   are compiled for the features of that set added to those of the command
+   line, so one x86-64 binary built for the baseline (no -march) carries a
+   copy of each kernel per set and picks one at startup; a region adds
+   features but removes none, under -march=native every copy, scalar
+   included, may use the encodings of the host and runs only there (gcc and
+   clang only; lambdas escape the clang pragma, kernels compiled in a region
+   are written without them); only the target changes, optimization options
+   stay those of the translation unit so the lanes inline everywhere; like
+   the backends, the sets agree bit for bit under -ffp-contract=off (gcc
+   fuses products into fma by default, in the avx-512 region even without
+   -mfma) */
+
+#if defined(ENGINE_SIMD_SSE) && (defined(__clang__) || defined(__GNUC__))
+#	define ENGINE_SIMD_DISPATCH
+#	if defined(__clang__)
+#		define ENGINE_SIMD_TARGET_SSE42  _Pragma("clang attribute push(__attribute__((target(\"sse4.2\"))), apply_to = function)")
+#		define ENGINE_SIMD_TARGET_AVX2   _Pragma("clang attribute push(__attribute__((target(\"avx2\"))), apply_to = function)")
+#		define ENGINE_SIMD_TARGET_AVX512 _Pragma("clang attribute push(__attribute__((target(\"avx512f\"))), apply_to = function)")
+#		define ENGINE_SIMD_TARGET_END    _Pragma("clang attribute pop")
+#	else
+#		define ENGINE_SIMD_TARGET_SSE42  _Pragma("GCC push_options") _Pragma("GCC target(\"sse4.2\")") _Pragma("GCC diagnostic push")
+#		define ENGINE_SIMD_TARGET_AVX2   _Pragma("GCC push_options") _Pragma("GCC target(\"avx2\")") _Pragma("GCC diagnostic push")
+/* gcc before 13 sees the undefined registers of its avx-512 intrinsics as uninitialized */
+#		define ENGINE_SIMD_TARGET_AVX512 _Pragma("GCC push_options") _Pragma("GCC target(\"avx512f\")") _Pragma("GCC diagnostic push") \
+										  _Pragma("GCC diagnostic ignored \"-Wuninitialized\"")
+#		define ENGINE_SIMD_TARGET_END    _Pragma("GCC diagnostic pop") _Pragma("GCC pop_options")
+#	endif
+#else
+#	define ENGINE_SIMD_TARGET_SSE42
+#	define ENGINE_SIMD_TARGET_AVX2
+#	define ENGINE_SIMD_TARGET_AVX512
+#	define ENGINE_SIMD_TARGET_END
+#endif
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- S I M D  N A M E S P A C E ------------------------------------------
+
+	namespace simd {
+
+
+		// -- I N S T R U C T I O N  S E T S ----------------------------------
+
+		/* instruction sets a kernel is compiled for */
+		enum isa : unsigned int {
+			SCALAR,
+			SSE42,
+			AVX2,
+			AVX512,
+			NEON
+		};
+
+		/* sets compiled into this binary, in order of preference */
+		#if defined(ENGINE_SIMD_DISPATCH)
+		inline constexpr simd::isa sets[] { simd::SCALAR, simd::SSE42, simd::AVX2, simd::AVX512 };
+		#elif defined(ENGINE_SIMD_NEON)
+		inline constexpr simd::isa sets[] { simd::SCALAR, simd::NEON };
+		#else
+		inline constexpr simd::isa sets[] { simd::SCALAR };
+		#endif
+
+
+		// -- instruction set functions ---------------------------------------
+
+		/* name of a set, as ENGINE_SIMD takes it */
+		inline auto name(const simd::isa set) noexcept -> const char* {
+			switch (set) {
+				case simd::SSE42:  return "sse4.2";
+				case simd::AVX2:   return "avx2";
+				case simd::AVX512: return "avx512";
+				case simd::NEON:   return "neon";
+				default:           return "scalar";
+			}
+		}
+
+		/* true when the set is compiled in and the cpu (and the os, for the
+		   wider registers) runs it */
+		inline auto available(const simd::isa set) noexcept -> bool {
+
+			bool compiled = false;
+			for (const auto s : simd::sets)
+				compiled = compiled || s == set;
+
+			if (compiled == false)
+				return false;
+
+			#if defined(ENGINE_SIMD_DISPATCH)
+			__builtin_cpu_init();
+			switch (set) {
+				case simd::SSE42:  return __builtin_cpu_supports("sse4.2");
+				case simd::AVX2:   return __builtin_cpu_supports("avx2");
+				case simd::AVX512: return __builtin_cpu_supports("avx512f");
+				default:           return true;
+			}
+			#else
+			return true;
+			#endif
+		}
+
+		/* best available set, or the one ENGINE_SIMD names when it is
+		   available (to compare the sets or to sidestep one on a machine) */
+		inline auto detect(void) noexcept -> simd::isa {
+
+			simd::isa best = simd::SCALAR;
+			for (const auto s : simd::sets)
+				if (simd::available(s))
+					best = s;
+
+			if (const char* forced = std::getenv("ENGINE_SIMD")) {
+				for (const auto s : simd::sets)
+					if (std::strcmp(forced, simd::name(s)) == 0 && simd::available(s))
+						return s;
+			}
+			return best;
+		}
+
+		/* set of the dispatched kernels, detected once */
+		inline auto selected(void) noexcept -> simd::isa {
+			static const simd::isa set = simd::detect();
+			return set;
+		}
+
+		/* the kernel of the selected set, given one per set of simd::sets */
+		template <typename F, typename... R>
+		inline auto choose(const F first, const R... rest) noexcept -> F {
+			static_assert(sizeof...(R) + 1U == sizeof(simd::sets) / sizeof(simd::sets[0]),
+						  "one kernel per compiled set");
+			const F kernels[] { first, rest... };
+			for (std::size_t i = 0U; i < sizeof...(R) + 1U; ++i)
+				if (simd::sets[i] == simd::selected())
+					return kernels[i];
+			return first;
+		}
+
+	} // namespace simd
+
+}
+
+#endif // ENGINE_SIMD_TARGET_HEADER
@@ -0,0 +1,412 @@
+#ifndef ENGINE_SIMD_WIDE_HEADER
+#define ENGINE_SIMD_WIDE_HEADER
+
+#include "simd.hpp"
+#include "simd_target.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- S I M D  N A M E S P A C E ------------------------------------------
+
+	namespace simd {
+
+
+		// -- W I D E  L A N E S ----------------------------------------------
+
+		/* one register of floats of each structure-of-arrays kernel, the
+		   pack of simd_pack: the kernels are written once against these
+		   members and run on the lanes of the selected instruction set
+		   (sixteen with avx-512, eight with avx2, four with sse or neon),
+		   then on wide_scalar for the remainder; every width runs the same
+		   operations in the same order, so an element gets the same bits
+		   wherever it sits in its array and whichever set runs it (rsqrt
+		   is the 12-bit estimate on every x86 width, the scalar tail uses
+		   it too); wide_avx and wide_avx512 are compiled in their target
+		   regions, callable from code of that set or wider only */
+
+
+		/* one float, tail of every kernel */
+		struct wide_scalar final {
+
+			using reg  = float;
+			using ints = std::int32_t;
+			using mask = bool;
+
+			static constexpr std::size_t size = 1U;
+
+			static inline auto load(const float* p) noexcept -> reg { return *p; }
+			static inline auto store(float* p, const reg r) noexcept -> void { *p = r; }
+			static inline auto first(const reg r) noexcept -> float { return r; }
+			static inline auto splat(const float s) noexcept -> reg { return s; }
+			static inline auto add(const reg a, const reg b) noexcept -> reg { return a + b; }
+			static inline auto sub(const reg a, const reg b) noexcept -> reg { return a - b; }
+			static inline auto mul(const reg a, const reg b) noexcept -> reg { return a * b; }
+			static inline auto div(const reg a, const reg b) noexcept -> reg { return a / b; }
+			static inline auto sqrt(const reg a) noexcept -> reg { return std::sqrt(a); }
+			static inline auto min(const reg a, const reg b) noexcept -> reg { return std::min(a, b); }
+			static inline auto max(const reg a, const reg b) noexcept -> reg { return std::max(a, b); }
+			static inline auto neg(const reg a) noexcept -> reg { return -a; }
+			static inline auto abs(const reg a) noexcept -> reg { return std::abs(a); }
+			static inline auto copysign(const reg a, const reg b) noexcept -> reg { return std::copysign(a, b); }
+
+			/* reciprocal square root estimate (of about that many bits), the
+			   one of the wide lanes */
+			#if defined(ENGINE_SIMD_SSE)
+			static constexpr unsigned int estimate = 12U;
+			static inline auto rsqrt(const reg a) noexcept -> reg { return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(a))); }
+			#elif defined(ENGINE_SIMD_NEON)
+			static constexpr unsigned int estimate = 8U;
+			static inline auto rsqrt(const reg a) noexcept -> reg { return vrsqrtes_f32(a); }
+			#else
+			static constexpr unsigned int estimate = 24U;
+			static inline auto rsqrt(const reg a) noexcept -> reg { return 1.0f / std::sqrt(a); }
+			#endif
+
+			static inline auto less(const reg a, const reg b) noexcept -> mask { return a < b; }
+			static inline auto select(const mask m, const reg a, const reg b) noexcept -> reg { return m ? a : b; }
+
+			/* nearest integer, ties to even like the vector conversions */
+			#if defined(ENGINE_SIMD_SSE)
+			static inline auto round(const reg a) noexcept -> ints { return _mm_cvtss_si32(_mm_set_ss(a)); }
+			#elif defined(ENGINE_SIMD_NEON)
+			static inline auto round(const reg a) noexcept -> ints { return vcvtns_s32_f32(a); }
+			#else
+			static inline auto round(const reg a) noexcept -> ints { return static_cast<ints>(std::lrint(a)); }
+			#endif
+			static inline auto convert(const ints a) noexcept -> reg { return static_cast<reg>(a); }
+			static inline auto next(const ints a) noexcept -> ints { return a + 1; }
+			static inline auto bit(const ints a, const std::int32_t b) noexcept -> mask { return (a & b) != 0; }
+
+			/* a * 2^n through the exponent field, for a normal result */
+			static inline auto scale(const reg a, const ints n) noexcept -> reg {
+				std::uint32_t b;
+				std::memcpy(&b, &a, sizeof(b));
+				b += static_cast<std::uint32_t>(n) << 23;
+				reg r;
+				std::memcpy(&r, &b, sizeof(r));
+				return r;
+			}
+
+			/* unbiased exponent of a positive normal float */
+			static inline auto exponent(const reg a) noexcept -> ints {
+				std::uint32_t b;
+				std::memcpy(&b, &a, sizeof(b));
+				return static_cast<ints>(b >> 23) - 127;
+			}
+
+			/* significand of a positive normal float, in [1, 2) */
+			static inline auto mantissa(const reg a) noexcept -> reg {
+				std::uint32_t b;
+				std::memcpy(&b, &a, sizeof(b));
+				b = (b & 0x007fffffU) | 0x3f800000U;
+				reg r;
+				std::memcpy(&r, &b, sizeof(r));
+				return r;
+			}
+
+			/* column k of the matrix from its four rows */
+			static inline auto column(float4x4* out, const unsigned int k,
+									  const reg x, const reg y, const reg z, const reg w) noexcept -> void {
+				out->columns[k] = float4{x, y, z, w};
+			}
+		};
+
+
+		#if defined(ENGINE_SIMD_SSE)
+		/* four floats, sse2 */
+		struct wide_sse final {
+
+			using reg  = __m128;
+			using ints = __m128i;
+			using mask = __m128;
+
+			static constexpr std::size_t size = 4U;
+
+			static inline auto load(const float* p) noexcept -> reg { return _mm_loadu_ps(p); }
+			static inline auto store(float* p, const reg r) noexcept -> void { _mm_storeu_ps(p, r); }
+			static inline auto first(const reg r) noexcept -> float { return _mm_cvtss_f32(r); }
+			static inline auto splat(const float s) noexcept -> reg { return _mm_set1_ps(s); }
+			static inline auto add(const reg a, const reg b) noexcept -> reg { return _mm_add_ps(a, b); }
+			static inline auto sub(const reg a, const reg b) noexcept -> reg { return _mm_sub_ps(a, b); }
+			static inline auto mul(const reg a, const reg b) noexcept -> reg { return _mm_mul_ps(a, b); }
+			static inline auto div(const reg a, const reg b) noexcept -> reg { return _mm_div_ps(a, b); }
+			static inline auto sqrt(const reg a) noexcept -> reg { return _mm_sqrt_ps(a); }
+			static inline auto min(const reg a, const reg b) noexcept -> reg { return _mm_min_ps(a, b); }
+			static inline auto max(const reg a, const reg b) noexcept -> reg { return _mm_max_ps(a, b); }
+			static inline auto neg(const reg a) noexcept -> reg { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+			static inline auto abs(const reg a) noexcept -> reg { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+			static inline auto copysign(const reg a, const reg b) noexcept -> reg {
+				const __m128 sign = _mm_set1_ps(-0.0f);
+				return _mm_or_ps(_mm_andnot_ps(sign, a), _mm_and_ps(sign, b));
+			}
+
+			static constexpr unsigned int estimate = wide_scalar::estimate;
+			static inline auto rsqrt(const reg a) noexcept -> reg { return _mm_rsqrt_ps(a); }
+
+			static inline auto less(const reg a, const reg b) noexcept -> mask { return _mm_cmplt_ps(a, b); }
+			static inline auto select(const mask m, const reg a, const reg b) noexcept -> reg {
+				return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+			}
+
+			static inline auto round(const reg a) noexcept -> ints { return _mm_cvtps_epi32(a); }
+			static inline auto convert(const ints a) noexcept -> reg { return _mm_cvtepi32_ps(a); }
+			static inline auto next(const ints a) noexcept -> ints { return _mm_add_epi32(a, _mm_set1_epi32(1)); }
+			static inline auto bit(const ints a, const std::int32_t b) noexcept -> mask {
+				const __m128i m = _mm_set1_epi32(b);
+				return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(a, m), m));
+			}
+
+			static inline auto scale(const reg a, const ints n) noexcept -> reg {
+				return _mm_castsi128_ps(_mm_add_epi32(_mm_castps_si128(a), _mm_slli_epi32(n, 23)));
+			}
+			static inline auto exponent(const reg a) noexcept -> ints {
+				return _mm_sub_epi32(_mm_srli_epi32(_mm_castps_si128(a), 23), _mm_set1_epi32(127));
+			}
+			static inline auto mantissa(const reg a) noexcept -> reg {
+				return _mm_or_ps(_mm_and_ps(a, _mm_castsi128_ps(_mm_set1_epi32(0x007fffff))), _mm_set1_ps(1.0f));
+			}
+
+			static inline auto column(float4x4* out, const unsigned int k,
+									  reg x, reg y, reg z, reg w) noexcept -> void {
+				_MM_TRANSPOSE4_PS(x, y, z, w);
+				_mm_storeu_ps(&out[0].columns[k].x, x);
+				_mm_storeu_ps(&out[1].columns[k].x, y);
+				_mm_storeu_ps(&out[2].columns[k].x, z);
+				_mm_storeu_ps(&out[3].columns[k].x, w);
+			}
+		};
+		#endif
+
+
+		#if defined(ENGINE_SIMD_SSE) && (defined(ENGINE_SIMD_DISPATCH) || defined(__AVX2__))
+		ENGINE_SIMD_TARGET_AVX2
+		/* eight floats, avx2 */
+		struct wide_avx final {
+
+			using reg  = __m256;
+			using ints = __m256i;
+			using mask = __m256;
+
+			static constexpr std::size_t size = 8U;
+
+			static inline auto load(const float* p) noexcept -> reg { return _mm256_loadu_ps(p); }
+			static inline auto store(float* p, const reg r) noexcept -> void { _mm256_storeu_ps(p, r); }
+			static inline auto first(const reg r) noexcept -> float { return _mm256_cvtss_f32(r); }
+			static inline auto splat(const float s) noexcept -> reg { return _mm256_set1_ps(s); }
+			static inline auto add(const reg a, const reg b) noexcept -> reg { return _mm256_add_ps(a, b); }
+			static inline auto sub(const reg a, const reg b) noexcept -> reg { return _mm256_sub_ps(a, b); }
+			static inline auto mul(const reg a, const reg b) noexcept -> reg { return _mm256_mul_ps(a, b); }
+			static inline auto div(const reg a, const reg b) noexcept -> reg { return _mm256_div_ps(a, b); }
+			static inline auto sqrt(const reg a) noexcept -> reg { return _mm256_sqrt_ps(a); }
+			static inline auto min(const reg a, const reg b) noexcept -> reg { return _mm256_min_ps(a, b); }
+			static inline auto max(const reg a, const reg b) noexcept -> reg { return _mm256_max_ps(a, b); }
+			static inline auto neg(const reg a) noexcept -> reg { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+			static inline auto abs(const reg a) noexcept -> reg { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+			static inline auto copysign(const reg a, const reg b) noexcept -> reg {
+				const __m256 sign = _mm256_set1_ps(-0.0f);
+				return _mm256_or_ps(_mm256_andnot_ps(sign, a), _mm256_and_ps(sign, b));
+			}
+
+			static constexpr unsigned int estimate = wide_scalar::estimate;
+			static inline auto rsqrt(const reg a) noexcept -> reg { return _mm256_rsqrt_ps(a); }
+
+			static inline auto less(const reg a, const reg b) noexcept -> mask { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+			static inline auto select(const mask m, const reg a, const reg b) noexcept -> reg { return _mm256_blendv_ps(b, a, m); }
+
+			static inline auto round(const reg a) noexcept -> ints { return _mm256_cvtps_epi32(a); }
+			static inline auto convert(const ints a) noexcept -> reg { return _mm256_cvtepi32_ps(a); }
+			static inline auto next(const ints a) noexcept -> ints { return _mm256_add_epi32(a, _mm256_set1_epi32(1)); }
+			static inline auto bit(const ints a, const std::int32_t b) noexcept -> mask {
+				const __m256i m = _mm256_set1_epi32(b);
+				return _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(a, m), m));
+			}
+
+			static inline auto scale(const reg a, const ints n) noexcept -> reg {
+				return _mm256_castsi256_ps(_mm256_add_epi32(_mm256_castps_si256(a), _mm256_slli_epi32(n, 23)));
+			}
+			static inline auto exponent(const reg a) noexcept -> ints {
+				return _mm256_sub_epi32(_mm256_srli_epi32(_mm256_castps_si256(a), 23), _mm256_set1_epi32(127));
+			}
+			static inline auto mantissa(const reg a) noexcept -> reg {
+				return _mm256_or_ps(_mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x007fffff))), _mm256_set1_ps(1.0f));
+			}
+
+			/* transposed per 128-bit half: low half elements 0-3, high half 4-7 */
+			static inline auto column(float4x4* out, const unsigned int k,
+									  const reg x, const reg y, const reg z, const reg w) noexcept -> void {
+				const __m256 t0 = _mm256_unpacklo_ps(x, y), t1 = _mm256_unpackhi_ps(x, y);
+				const __m256 t2 = _mm256_unpacklo_ps(z, w), t3 = _mm256_unpackhi_ps(z, w);
+				const __m256 r[4] {
+					_mm256_shuffle_ps(t0, t2, 0x44), _mm256_shuffle_ps(t0, t2, 0xee),
+					_mm256_shuffle_ps(t1, t3, 0x44), _mm256_shuffle_ps(t1, t3, 0xee)
+				};
+				for (unsigned int j = 0U; j < 4U; ++j) {
+					_mm_storeu_ps(&out[j + 0U].columns[k].x, _mm256_castps256_ps128(r[j]));
+					_mm_storeu_ps(&out[j + 4U].columns[k].x, _mm256_extractf128_ps(r[j], 1));
+				}
+			}
+		};
+		ENGINE_SIMD_TARGET_END
+		#endif
+
+
+		#if defined(ENGINE_SIMD_SSE) && (defined(ENGINE_SIMD_DISPATCH) || defined(__AVX512F__))
+		ENGINE_SIMD_TARGET_AVX512
+		/* sixteen floats, avx-512 */
+		struct wide_avx512 final {
+
+			using reg  = __m512;
+			using ints = __m512i;
+			using mask = __mmask16;
+
+			static constexpr std::size_t size = 16U;
+
+			static inline auto load(const float* p) noexcept -> reg { return _mm512_loadu_ps(p); }
+			static inline auto store(float* p, const reg r) noexcept -> void { _mm512_storeu_ps(p, r); }
+			static inline auto first(const reg r) noexcept -> float { return _mm512_cvtss_f32(r); }
+			static inline auto splat(const float s) noexcept -> reg { return _mm512_set1_ps(s); }
+			static inline auto add(const reg a, const reg b) noexcept -> reg { return _mm512_add_ps(a, b); }
+			static inline auto sub(const reg a, const reg b) noexcept -> reg { return _mm512_sub_ps(a, b); }
+			static inline auto mul(const reg a, const reg b) noexcept -> reg { return _mm512_mul_ps(a, b); }
+			static inline auto div(const reg a, const reg b) noexcept -> reg { return _mm512_div_ps(a, b); }
+			static inline auto sqrt(const reg a) noexcept -> reg { return _mm512_sqrt_ps(a); }
+			static inline auto min(const reg a, const reg b) noexcept -> reg { return _mm512_min_ps(a, b); }
+			static inline auto max(const reg a, const reg b) noexcept -> reg { return _mm512_max_ps(a, b); }
+			static inline auto neg(const reg a) noexcept -> reg {
+				return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_set1_epi32(INT32_MIN)));
+			}
+			static inline auto abs(const reg a) noexcept -> reg {
+				return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a), _mm512_set1_epi32(INT32_MAX)));
+			}
+			static inline auto copysign(const reg a, const reg b) noexcept -> reg {
+				const __m512i sign = _mm512_set1_epi32(INT32_MIN);
+				return _mm512_castsi512_ps(_mm512_or_si512(_mm512_andnot_si512(sign, _mm512_castps_si512(a)),
+														   _mm512_and_si512(sign, _mm512_castps_si512(b))));
+			}
+
+			static constexpr unsigned int estimate = wide_scalar::estimate;
+			/* the 12-bit estimate by halves, rsqrt14 would not give the bits of the other sets */
+			static inline auto rsqrt(const reg a) noexcept -> reg {
+				const __m256 low  = _mm256_rsqrt_ps(_mm512_castps512_ps256(a));
+				const __m256 high = _mm256_rsqrt_ps(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(a), 1)));
+				return _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512(low)), _mm256_castps_pd(high), 1));
+			}
+
+			static inline auto less(const reg a, const reg b) noexcept -> mask { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+			static inline auto select(const mask m, const reg a, const reg b) noexcept -> reg { return _mm512_mask_blend_ps(m, b, a); }
+
+			static inline auto round(const reg a) noexcept -> ints { return _mm512_cvtps_epi32(a); }
+			static inline auto convert(const ints a) noexcept -> reg { return _mm512_cvtepi32_ps(a); }
+			static inline auto next(const ints a) noexcept -> ints { return _mm512_add_epi32(a, _mm512_set1_epi32(1)); }
+			static inline auto bit(const ints a, const std::int32_t b) noexcept -> mask {
+				return _mm512_test_epi32_mask(a, _mm512_set1_epi32(b));
+			}
+
+			static inline auto scale(const reg a, const ints n) noexcept -> reg {
+				return _mm512_castsi512_ps(_mm512_add_epi32(_mm512_castps_si512(a), _mm512_slli_epi32(n, 23)));
+			}
+			static inline auto exponent(const reg a) noexcept -> ints {
+				return _mm512_sub_epi32(_mm512_srli_epi32(_mm512_castps_si512(a), 23), _mm512_set1_epi32(127));
+			}
+			static inline auto mantissa(const reg a) noexcept -> reg {
+				return _mm512_castsi512_ps(_mm512_or_si512(_mm512_and_si512(_mm512_castps_si512(a), _mm512_set1_epi32(0x007fffff)),
+														   _mm512_set1_epi32(0x3f800000)));
+			}
+
+			/* transposed per 128-bit quarter: quarter q holds elements 4q to 4q+3 */
+			static inline auto column(float4x4* out, const unsigned int k,
+									  const reg x, const reg y, const reg z, const reg w) noexcept -> void {
+				const __m512 t0 = _mm512_unpacklo_ps(x, y), t1 = _mm512_unpackhi_ps(x, y);
+				const __m512 t2 = _mm512_unpacklo_ps(z, w), t3 = _mm512_unpackhi_ps(z, w);
+				const __m512 r[4] {
+					_mm512_shuffle_ps(t0, t2, 0x44), _mm512_shuffle_ps(t0, t2, 0xee),
+					_mm512_shuffle_ps(t1, t3, 0x44), _mm512_shuffle_ps(t1, t3, 0xee)
+				};
+				for (unsigned int j = 0U; j < 4U; ++j) {
+					_mm_storeu_ps(&out[j +  0U].columns[k].x, _mm512_castps512_ps128(r[j]));
+					_mm_storeu_ps(&out[j +  4U].columns[k].x, _mm512_extractf32x4_ps(r[j], 1));
+					_mm_storeu_ps(&out[j +  8U].columns[k].x, _mm512_extractf32x4_ps(r[j], 2));
+					_mm_storeu_ps(&out[j + 12U].columns[k].x, _mm512_extractf32x4_ps(r[j], 3));
+				}
+			}
+		};
+		ENGINE_SIMD_TARGET_END
+		#endif
+
+
+		#if defined(ENGINE_SIMD_NEON)
+		/* four floats, neon */
+		struct wide_neon final {
+
+			using reg  = float32x4_t;
+			using ints = int32x4_t;
+			using mask = uint32x4_t;
+
+			static constexpr std::size_t size = 4U;
+
+			static inline auto load(const float* p) noexcept -> reg { return vld1q_f32(p); }
+			static inline auto store(float* p, const reg r) noexcept -> void { vst1q_f32(p, r); }
+			static inline auto first(const reg r) noexcept -> float { return vgetq_lane_f32(r, 0); }
+			static inline auto splat(const float s) noexcept -> reg { return vdupq_n_f32(s); }
+			static inline auto add(const reg a, const reg b) noexcept -> reg { return vaddq_f32(a, b); }
+			static inline auto sub(const reg a, const reg b) noexcept -> reg { return vsubq_f32(a, b); }
+			static inline auto mul(const reg a, const reg b) noexcept -> reg { return vmulq_f32(a, b); }
+			static inline auto div(const reg a, const reg b) noexcept -> reg { return vdivq_f32(a, b); }
+			static inline auto sqrt(const reg a) noexcept -> reg { return vsqrtq_f32(a); }
+			static inline auto min(const reg a, const reg b) noexcept -> reg { return vminq_f32(a, b); }
+			static inline auto max(const reg a, const reg b) noexcept -> reg { return vmaxq_f32(a, b); }
+			static inline auto neg(const reg a) noexcept -> reg { return vnegq_f32(a); }
+			static inline auto abs(const reg a) noexcept -> reg { return vabsq_f32(a); }
+			static inline auto copysign(const reg a, const reg b) noexcept -> reg { return vbslq_f32(vdupq_n_u32(0x80000000U), b, a); }
+
+			static constexpr unsigned int estimate = wide_scalar::estimate;
+			static inline auto rsqrt(const reg a) noexcept -> reg { return vrsqrteq_f32(a); }
+
+			static inline auto less(const reg a, const reg b) noexcept -> mask { return vcltq_f32(a, b); }
+			static inline auto select(const mask m, const reg a, const reg b) noexcept -> reg { return vbslq_f32(m, a, b); }
+
+			static inline auto round(const reg a) noexcept -> ints { return vcvtnq_s32_f32(a); }
+			static inline auto convert(const ints a) noexcept -> reg { return vcvtq_f32_s32(a); }
+			static inline auto next(const ints a) noexcept -> ints { return vaddq_s32(a, vdupq_n_s32(1)); }
+			static inline auto bit(const ints a, const std::int32_t b) noexcept -> mask { return vtstq_s32(a, vdupq_n_s32(b)); }
+
+			static inline auto scale(const reg a, const ints n) noexcept -> reg {
+				return vreinterpretq_f32_s32(vaddq_s32(vreinterpretq_s32_f32(a), vshlq_n_s32(n, 23)));
+			}
+			static inline auto exponent(const reg a) noexcept -> ints {
+				return vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_f32(a), 23)), vdupq_n_s32(127));
+			}
+			static inline auto mantissa(const reg a) noexcept -> reg {
+				return vreinterpretq_f32_u32(vorrq_u32(vandq_u32(vreinterpretq_u32_f32(a), vdupq_n_u32(0x007fffffU)),
+													   vdupq_n_u32(0x3f800000U)));
+			}
+
+			static inline auto column(float4x4* out, const unsigned int k,
+									  const reg x, const reg y, const reg z, const reg w) noexcept -> void {
+				const float32x4x2_t t0 = vzipq_f32(x, z);
+				const float32x4x2_t t1 = vzipq_f32(y, w);
+				const float32x4x2_t r0 = vzipq_f32(t0.val[0], t1.val[0]);
+				const float32x4x2_t r1 = vzipq_f32(t0.val[1], t1.val[1]);
+				vst1q_f32(&out[0].columns[k].x, r0.val[0]);
+				vst1q_f32(&out[1].columns[k].x, r0.val[1]);
+				vst1q_f32(&out[2].columns[k].x, r1.val[0]);
+				vst1q_f32(&out[3].columns[k].x, r1.val[1]);
+			}
+		};
+		#endif
+
+	} // namespace simd
+
+}
+
+#endif // ENGINE_SIMD_WIDE_HEADER
@@ -0,0 +1,179 @@
+#ifndef ENGINE_TRANSFORM_BATCH_HEADER
+#define ENGINE_TRANSFORM_BATCH_HEADER
+
+#include "simd.hpp"
+#include "simd_pack.hpp"
+#include "quaternion_batch.hpp"
+
+#include <vector>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- T R A N S F O R M  B A T C H ----------------------------------------
+
+	/* positions, unit quaternion rotations and scales stored as ten float
+	   arrays, composed into world matrices a pack of objects at a time on the
+	   instruction set selected at startup (sixteen with avx-512, eight with
+	   avx2, four with sse4.2 or neon); same result as matrix::trs (bit for
+	   bit without fp contraction), same bits for an object wherever it sits
+	   in the batch and whichever set composes it */
+
+	class transform_batch final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::transform_batch;
+
+			/* size type */
+			using size_type = std::size_t;
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* default constructor */
+			inline transform_batch(void)
+			: _px{}, _py{}, _pz{}, _qx{}, _qy{}, _qz{}, _qw{}, _sx{}, _sy{}, _sz{}, _matrices{} {}
+
+			/* copy constructor */
+			transform_batch(const self&) = default;
+
+			/* move constructor */
+			transform_batch(self&&) noexcept = default;
+
+			/* destructor */
+			~transform_batch(void) noexcept = default;
+
+
+			// -- public assignment operators ---------------------------------
+
+			/* copy assignment operator */
+			auto operator=(const self&) -> self& = default;
+
+			/* move assignment operator */
+			auto operator=(self&&) noexcept -> self& = default;
+
+
+			// -- public accessors --------------------------------------------
+
+			/* objects */
+			inline auto size(void) const noexcept -> size_type {
+				return _px.size();
+			}
+
+			/* position */
+			inline auto position(const size_type i) const noexcept -> simd::float3 {
+				return simd::float3{_px[i], _py[i], _pz[i]};
+			}
+
+			/* rotation */
+			inline auto rotation(const size_type i) const noexcept -> simd::quatf {
+				return simd::quatf{_qx[i], _qy[i], _qz[i], _qw[i]};
+			}
+
+			/* scale */
+			inline auto scale(const size_type i) const noexcept -> simd::float3 {
+				return simd::float3{_sx[i], _sy[i], _sz[i]};
+			}
+
+			/* world matrices (as of the last update) */
+			inline auto matrices(void) const noexcept -> const std::vector<simd::float4x4>& {
+				return _matrices;
+			}
+
+
+			// -- public modifiers --------------------------------------------
+
+			/* append an object, returns its index */
+			inline auto push(const simd::float3& position,
+							 const simd::quatf& rotation,
+							 const simd::float3& scale = simd::float3{1.0f}) -> size_type {
+
+				_px.push_back(position.x); _py.push_back(position.y); _pz.push_back(position.z);
+				_qx.push_back(rotation.vector.x); _qy.push_back(rotation.vector.y);
+				_qz.push_back(rotation.vector.z); _qw.push_back(rotation.vector.w);
+				_sx.push_back(scale.x);    _sy.push_back(scale.y);    _sz.push_back(scale.z);
+
+				return _px.size() - 1U;
+			}
+
+			/* position */
+			inline auto position(const size_type i, const simd::float3& position) noexcept -> void {
+				_px[i] = position.x; _py[i] = position.y; _pz[i] = position.z;
+			}
+
+			/* rotation */
+			inline auto rotation(const size_type i, const simd::quatf& rotation) noexcept -> void {
+				_qx[i] = rotation.vector.x; _qy[i] = rotation.vector.y;
+				_qz[i] = rotation.vector.z; _qw[i] = rotation.vector.w;
+			}
+
+			/* scale */
+			inline auto scale(const size_type i, const simd::float3& scale) noexcept -> void {
+				_sx[i] = scale.x; _sy[i] = scale.y; _sz[i] = scale.z;
+			}
+
+			/* remove every object */
+			inline auto clear(void) noexcept -> void {
+				for (auto* array : {&_px, &_py, &_pz, &_qx, &_qy, &_qz, &_qw, &_sx, &_sy, &_sz})
+					array->clear();
+				_matrices.clear();
+			}
+
+
+			// -- public methods ----------------------------------------------
+
+			/* compose every world matrix */
+			inline auto update(void) -> void {
+				_matrices.resize(_px.size());
+				self::compose({_px.data(), _py.data(), _pz.data()},
+							  {_qx.data(), _qy.data(), _qz.data(), _qw.data()},
+							  {_sx.data(), _sy.data(), _sz.data()}, _px.size(), _matrices.data());
+			}
+
+
+			// -- public static methods ---------------------------------------
+
+			/* objects composed per iteration */
+			static inline auto width(void) noexcept -> size_type {
+				return simd::width();
+			}
+
+			/* compose count world matrices from soa arrays */
+			static inline auto compose(engine::quaternion_batch::vectors position,
+									   engine::quaternion_batch::quats rotation,
+									   engine::quaternion_batch::vectors scale,
+									   const size_type count, simd::float4x4* out) noexcept -> void {
+				static const auto kernel = ENGINE_SIMD_CHOOSE(transform_kernels::compose);
+				kernel(position, rotation, scale, count, out);
+			}
+
+
+		private:
+
+			// -- private members ---------------------------------------------
+
+			/* positions */
+			std::vector<float> _px, _py, _pz;
+
+			/* rotations */
+			std::vector<float> _qx, _qy, _qz, _qw;
+
+			/* scales */
+			std::vector<float> _sx, _sy, _sz;
+
+			/* world matrices */
+			std::vector<simd::float4x4> _matrices;
+
+	};
+
+}
+
+#endif // ENGINE_TRANSFORM_BATCH_HEADER
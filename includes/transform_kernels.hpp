@@ -0,0 +1,70 @@
+// -- T R A N S F O R M  K E R N E L S ----------------------------------------
+
+/* no include guard: simd_kernels.hpp includes this once per instruction set
+   in namespace engine::simd::<set>, inside the target region of the set,
+   after the quaternion kernels of the set; transform_batch dispatches to the
+   copy of the selected set */
+
+
+/* world matrices composed from structure-of-arrays transforms, a pack of
+   objects at a time, see transform_batch */
+
+class transform_kernels final {
+
+
+	public:
+
+		// -- public types ----------------------------------------------------
+
+		/* size type */
+		using size_type = std::size_t;
+
+		/* quaternion arrays */
+		using quats = quaternion_kernels::quats;
+
+		/* vector arrays */
+		using vectors = quaternion_kernels::vectors;
+
+
+		// -- public lifecycle ------------------------------------------------
+
+		/* non-instanciable class */
+		transform_kernels(void) = delete;
+
+
+		// -- public static methods -------------------------------------------
+
+		/* compose count world matrices, as matrix::trs */
+		static inline auto compose(vectors position, quats rotation, vectors scale,
+								   const size_type count, simd::float4x4* out) noexcept -> void {
+			sweep<compose_step>(count, position, rotation, scale, out);
+		}
+
+
+	private:
+
+		// -- private types ---------------------------------------------------
+
+		/* one register of world matrices */
+		struct compose_step final {
+			template <typename L>
+			static inline auto apply(const size_type i, vectors position, quats rotation,
+									 vectors scale, simd::float4x4* out) noexcept -> void {
+
+				typename L::reg c[3][3];
+				quaternion_kernels::rotation<L>(L::load(rotation[0] + i), L::load(rotation[1] + i),
+												L::load(rotation[2] + i), L::load(rotation[3] + i), c);
+
+				// scaled columns, as matrix::trs
+				const auto zero = L::splat(0.0f);
+				for (unsigned int k = 0U; k < 3U; ++k) {
+					const auto s = L::load(scale[k] + i);
+					L::column(out + i, k, L::mul(c[k][0], s), L::mul(c[k][1], s), L::mul(c[k][2], s), zero);
+				}
+
+				L::column(out + i, 3U, L::load(position[0] + i), L::load(position[1] + i),
+									   L::load(position[2] + i), L::splat(1.0f));
+			}
+		};
+
+};
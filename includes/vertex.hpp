@@ -2,7 +2,7 @@
 #define ENGINE_VERTEX_HPP
 
 
-#include <simd/simd.h>
+#include "simd.hpp"
 #include <iostream>
 #include <vector>
 
@@ -41,13 +41,13 @@ namespace engine {
 			// -- public lifecycle --------------------------------------------
 
 			/* default constructor */
-			inline vertex(void) noexcept
+			inline constexpr vertex(void) noexcept
 			: _position{0.0f, 0.0f, 0.0f},
 				_normal{0.0f, 0.0f, 0.0f},
 			   _texture{0.0f, 0.0f} {}
 
 			/* position constructor */
-			inline vertex(const float px, const float py, const float pz) noexcept
+			inline constexpr vertex(const float px, const float py, const float pz) noexcept
 			: _position{px, py, pz},
 				_normal{0.0f, 0.0f, 0.0f},
 			   _texture{0.0f, 0.0f} {}
@@ -66,28 +66,28 @@ namespace engine {
 			   _texture{texture} {}
 
 			/* position + normal constructor */
-			inline vertex(const float px, const float py, const float pz,
-						  const float nx, const float ny, const float nz) noexcept
+			inline constexpr vertex(const float px, const float py, const float pz,
+									const float nx, const float ny, const float nz) noexcept
 			: _position{px, py, pz},
 				_normal{nx, ny, nz},
 			   _texture{0.0f, 0.0f} {}
 
 			/* position + normal + texture constructor */
-			inline vertex(const float px, const float py, const float pz,
-						  const float nx, const float ny, const float nz,
-						  const float tx, const float ty) noexcept
+			inline constexpr vertex(const float px, const float py, const float pz,
+									const float nx, const float ny, const float nz,
+									const float tx, const float ty) noexcept
 			: _position{px, py, pz},
 				_normal{nx, ny, nz},
 			   _texture{tx, ty} {}
 
 			/* copy constructor */
-			inline vertex(const self& other) noexcept
+			inline constexpr vertex(const self& other) noexcept
 			: _position{other._position},
 				_normal{other._normal},
 			   _texture{other._texture} {}
 
 			/* move constructor */
-			inline vertex(self&& other) noexcept
+			inline constexpr vertex(self&& other) noexcept
 			: vertex{other} {}
 
 			/* destructor */
@@ -97,7 +97,7 @@ namespace engine {
 			// -- public assignment operators ---------------------------------
 
 			/* copy assignment operator */
-			inline auto operator=(const self& other) noexcept -> self& {
+			inline constexpr auto operator=(const self& other) noexcept -> self& {
 				_position = other._position;
 				_normal   = other._normal;
 				_texture  = other._texture;
@@ -105,7 +105,7 @@ namespace engine {
 			}
 
 			/* move assignment operator */
-			inline auto operator=(self&& other) noexcept -> self& {
+			inline constexpr auto operator=(self&& other) noexcept -> self& {
 				return self::operator=(other);
 			}
 
@@ -129,44 +129,44 @@ namespace engine {
 
 
 			/* position x */
-			inline auto px(void) const noexcept -> float {
+			inline constexpr auto px(void) const noexcept -> float {
 				return _position.x;
 			}
 
 			/* position y */
-			inline auto py(void) const noexcept -> float {
+			inline constexpr auto py(void) const noexcept -> float {
 				return _position.y;
 			}
 
 			/* position z */
-			inline auto pz(void) const noexcept -> float {
+			inline constexpr auto pz(void) const noexcept -> float {
 				return _position.z;
 			}
 
 
 			/* normal x */
-			inline auto nx(void) const noexcept {
+			inline constexpr auto nx(void) const noexcept {
 				return _normal.x;
 			}
 
 			/* normal y */
-			inline auto ny(void) const noexcept {
+			inline constexpr auto ny(void) const noexcept {
 				return _normal.y;
 			}
 
 			/* normal z */
-			inline auto nz(void) const noexcept {
+			inline constexpr auto nz(void) const noexcept {
 				return _normal.z;
 			}
 
 
 			/* texture u */
-			inline auto tu(void) const noexcept {
+			inline constexpr auto tu(void) const noexcept {
 				return _texture.x;
 			}
 
 			/* texture v */
-			inline auto tv(void) const noexcept {
+			inline constexpr auto tv(void) const noexcept {
 				return _texture.y;
 			}
 
@@ -302,12 +302,12 @@ namespace engine {
 
 
 			/* copy constructor */
-			inline vertex_2D(const self& other) noexcept
+			inline constexpr vertex_2D(const self& other) noexcept
 			: _position{other._position} {
 			}
 
 			/* move constructor */
-			inline vertex_2D(self&& other) noexcept
+			inline constexpr vertex_2D(self&& other) noexcept
 			: vertex_2D{other} {}
 
 			/* destructor */
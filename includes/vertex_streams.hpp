@@ -0,0 +1,295 @@
+#ifndef ENGINE_VERTEX_STREAMS_HPP
+#define ENGINE_VERTEX_STREAMS_HPP
+
+#include "vertex.hpp"
+#include "model.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- V E R T E X  A T T R I B U T E S ------------------------------------
+
+	/* everything but the position, matches the split_3D attribute stream */
+	struct vertex_attributes final {
+
+		/* normal */
+		float normal[3];
+
+		/* texture coordinate */
+		float texcoord[2];
+	};
+
+	static_assert(sizeof(engine::vertex_attributes) == 20U, "vertex attributes must stay tightly packed");
+
+	/* attribute stream */
+	using attribute_stream = std::vector<engine::vertex_attributes>;
+
+
+	// -- P O S I T I O N  S T R E A M ----------------------------------------
+
+	/* positions as x, y and z planes, for cpu passes that never
+	   touch normals or texture coordinates (bounds, bvh builds, ray casts) */
+	struct position_stream final {
+
+		/* x plane */
+		std::vector<float> x{};
+
+		/* y plane */
+		std::vector<float> y{};
+
+		/* z plane */
+		std::vector<float> z{};
+
+		/* position count */
+		inline auto size(void) const noexcept -> std::size_t {
+			return x.size();
+		}
+	};
+
+
+	// -- V E R T E X  S T R E A M S ------------------------------------------
+
+	/* engine::vertex (array of structures) to and from split streams,
+	   four vertices per step through 4x4 transposes */
+
+	class vertex_streams final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::vertex_streams;
+
+			/* size type */
+			using size_type = std::size_t;
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* non-instanciable class */
+			vertex_streams(void) = delete;
+
+
+			// -- public static methods ---------------------------------------
+
+			/* split into packed positions (xyz xyz ..., 3 * count floats) and attributes */
+			static auto split(const engine::vertex* in, const size_type count,
+							  float* positions, engine::vertex_attributes* attributes) noexcept -> void {
+
+				size_type i = 0U;
+
+				for (; i + 4U <= count; i += 4U, positions += 12U) {
+
+					const f32x4 a = self::load(in[i + 0U]);
+					const f32x4 b = self::load(in[i + 1U]);
+					const f32x4 c = self::load(in[i + 2U]);
+					const f32x4 d = self::load(in[i + 3U]);
+
+					// ax ay az bx | by bz cx cy | cz dx dy dz
+					const f32x4 p0 = __builtin_shufflevector(a, b, 0, 1, 2, 4);
+					const f32x4 p1 = __builtin_shufflevector(b, c, 1, 2, 4, 5);
+					const f32x4 p2 = __builtin_shufflevector(c, d, 2, 4, 5, 6);
+
+					std::memcpy(positions + 0U, &p0, sizeof(f32x4));
+					std::memcpy(positions + 4U, &p1, sizeof(f32x4));
+					std::memcpy(positions + 8U, &p2, sizeof(f32x4));
+				}
+
+				for (; i < count; ++i, positions += 3U) {
+					positions[0U] = in[i].px();
+					positions[1U] = in[i].py();
+					positions[2U] = in[i].pz();
+				}
+
+				for (i = 0U; i < count; ++i)
+					attributes[i] = engine::vertex_attributes{{in[i].nx(), in[i].ny(), in[i].nz()},
+															  {in[i].tu(), in[i].tv()}};
+			}
+
+			/* merge packed positions and attributes back into vertices */
+			static auto merge(const float* positions, const engine::vertex_attributes* attributes,
+							  const size_type count, engine::vertex* out) noexcept -> void {
+
+				for (size_type i = 0U; i < count; ++i, positions += 3U) {
+					const auto& a = attributes[i];
+					out[i] = engine::vertex{positions[0U], positions[1U], positions[2U],
+											a.normal[0U], a.normal[1U], a.normal[2U],
+											a.texcoord[0U], a.texcoord[1U]};
+				}
+			}
+
+			/* position planes of count vertices */
+			static auto deinterleave(const engine::vertex* in, const size_type count,
+									 float* x, float* y, float* z) noexcept -> void {
+
+				size_type i = 0U;
+
+				for (; i + 4U <= count; i += 4U) {
+
+					const f32x4 a = self::load(in[i + 0U]);
+					const f32x4 b = self::load(in[i + 1U]);
+					const f32x4 c = self::load(in[i + 2U]);
+					const f32x4 d = self::load(in[i + 3U]);
+
+					// ax bx ay by | cx dx cy dy | az bz aw bw | cz dz cw dw
+					const f32x4 ab0 = __builtin_shufflevector(a, b, 0, 4, 1, 5);
+					const f32x4 cd0 = __builtin_shufflevector(c, d, 0, 4, 1, 5);
+					const f32x4 ab1 = __builtin_shufflevector(a, b, 2, 6, 3, 7);
+					const f32x4 cd1 = __builtin_shufflevector(c, d, 2, 6, 3, 7);
+
+					const f32x4 vx = __builtin_shufflevector(ab0, cd0, 0, 1, 4, 5);
+					const f32x4 vy = __builtin_shufflevector(ab0, cd0, 2, 3, 6, 7);
+					const f32x4 vz = __builtin_shufflevector(ab1, cd1, 0, 1, 4, 5);
+
+					std::memcpy(x + i, &vx, sizeof(f32x4));
+					std::memcpy(y + i, &vy, sizeof(f32x4));
+					std::memcpy(z + i, &vz, sizeof(f32x4));
+				}
+
+				for (; i < count; ++i) {
+					x[i] = in[i].px();
+					y[i] = in[i].py();
+					z[i] = in[i].pz();
+				}
+			}
+
+			/* position planes of a vertex vector */
+			static auto deinterleave(const engine::vertices& vertices) -> engine::position_stream {
+				const size_type count = vertices.size();
+				engine::position_stream stream{std::vector<float>(count),
+											   std::vector<float>(count),
+											   std::vector<float>(count)};
+				self::deinterleave(vertices.data(), count, stream.x.data(), stream.y.data(), stream.z.data());
+				return stream;
+			}
+
+			/* write position planes back into count vertices (other attributes kept) */
+			static auto interleave(const float* x, const float* y, const float* z,
+								   const size_type count, engine::vertex* out) noexcept -> void {
+
+				size_type i = 0U;
+
+				for (; i + 4U <= count; i += 4U) {
+
+					f32x4 vx, vy, vz;
+					std::memcpy(&vx, x + i, sizeof(f32x4));
+					std::memcpy(&vy, y + i, sizeof(f32x4));
+					std::memcpy(&vz, z + i, sizeof(f32x4));
+
+					// x0 y0 x1 y1 | x2 y2 x3 y3
+					const f32x4 xy0 = __builtin_shufflevector(vx, vy, 0, 4, 1, 5);
+					const f32x4 xy1 = __builtin_shufflevector(vx, vy, 2, 6, 3, 7);
+
+					const f32x4 p0 = __builtin_shufflevector(xy0, vz, 0, 1, 4, 4);
+					const f32x4 p1 = __builtin_shufflevector(xy0, vz, 2, 3, 5, 5);
+					const f32x4 p2 = __builtin_shufflevector(xy1, vz, 0, 1, 6, 6);
+					const f32x4 p3 = __builtin_shufflevector(xy1, vz, 2, 3, 7, 7);
+
+					out[i + 0U].position(p0[0], p0[1], p0[2]);
+					out[i + 1U].position(p1[0], p1[1], p1[2]);
+					out[i + 2U].position(p2[0], p2[1], p2[2]);
+					out[i + 3U].position(p3[0], p3[1], p3[2]);
+				}
+
+				for (; i < count; ++i)
+					out[i].position(x[i], y[i], z[i]);
+			}
+
+			/* bounds of position planes (zero box when empty) */
+			static auto bounds(const float* x, const float* y, const float* z,
+							   const size_type count) noexcept -> engine::bounds {
+
+				if (count == 0U)
+					return engine::bounds{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+
+				f32x4 lx{x[0U], x[0U], x[0U], x[0U]}, hx = lx;
+				f32x4 ly{y[0U], y[0U], y[0U], y[0U]}, hy = ly;
+				f32x4 lz{z[0U], z[0U], z[0U], z[0U]}, hz = lz;
+
+				size_type i = 0U;
+
+				for (; i + 4U <= count; i += 4U) {
+					f32x4 vx, vy, vz;
+					std::memcpy(&vx, x + i, sizeof(f32x4));
+					std::memcpy(&vy, y + i, sizeof(f32x4));
+					std::memcpy(&vz, z + i, sizeof(f32x4));
+					lx = self::min(lx, vx); hx = self::max(hx, vx);
+					ly = self::min(ly, vy); hy = self::max(hy, vy);
+					lz = self::min(lz, vz); hz = self::max(hz, vz);
+				}
+
+				engine::bounds b{{self::min(lx), self::min(ly), self::min(lz)},
+								 {self::max(hx), self::max(hy), self::max(hz)}};
+
+				for (; i < count; ++i)
+					b.expand(engine::vertex{x[i], y[i], z[i]});
+
+				return b;
+			}
+
+			/* bounds of a position stream */
+			static auto bounds(const engine::position_stream& stream) noexcept -> engine::bounds {
+				return self::bounds(stream.x.data(), stream.y.data(), stream.z.data(), stream.size());
+			}
+
+
+		private:
+
+			// -- private types -----------------------------------------------
+
+			/* four floats */
+			using f32x4 = float __attribute__((vector_size(16)));
+
+			/* four signed integers */
+			using i32x4 = std::int32_t __attribute__((vector_size(16)));
+
+
+			// -- private static methods --------------------------------------
+
+			/* position as four lanes (w is padding) */
+			static inline auto load(const engine::vertex& v) noexcept -> f32x4 {
+				static_assert(sizeof(simd::float3) == sizeof(f32x4), "simd::float3 must be padded to four lanes");
+				f32x4 p;
+				std::memcpy(&p, &v.position(), sizeof(f32x4));
+				return p;
+			}
+
+			/* lane minimum */
+			static inline auto min(const f32x4 a, const f32x4 b) noexcept -> f32x4 {
+				const i32x4 m = a < b;
+				return std::bit_cast<f32x4>((std::bit_cast<i32x4>(a) & m) | (std::bit_cast<i32x4>(b) & ~m));
+			}
+
+			/* lane maximum */
+			static inline auto max(const f32x4 a, const f32x4 b) noexcept -> f32x4 {
+				const i32x4 m = a > b;
+				return std::bit_cast<f32x4>((std::bit_cast<i32x4>(a) & m) | (std::bit_cast<i32x4>(b) & ~m));
+			}
+
+			/* horizontal minimum */
+			static inline auto min(const f32x4 v) noexcept -> float {
+				const f32x4 m = self::min(v, __builtin_shufflevector(v, v, 2, 3, 0, 1));
+				return m[0] < m[1] ? m[0] : m[1];
+			}
+
+			/* horizontal maximum */
+			static inline auto max(const f32x4 v) noexcept -> float {
+				const f32x4 m = self::max(v, __builtin_shufflevector(v, v, 2, 3, 0, 1));
+				return m[0] > m[1] ? m[0] : m[1];
+			}
+
+	};
+
+}
+
+#endif // ENGINE_VERTEX_STREAMS_HPP
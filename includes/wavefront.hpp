@@ -2,6 +2,13 @@
 #define ENGINE_MODEL_LOADER_HPP
 
 #include "vertex.hpp"
+#include "mapped_file.hpp"
+#include "scanner.hpp"
+#include "parallel.hpp"
+#include "welder.hpp"
+#include "mesh_attributes.hpp"
+#include "float_parser.hpp"
+#include "model.hpp"
 
 #include <unistd.h>
 #include <fcntl.h>
@@ -9,11 +16,15 @@
 #include <sstream>
 #include <map>
 #include <ranges>
+#include <string_view>
+#include <functional>
+#include <algorithm>
+#include <charconv>
 
 #include <xns>
 
 
-#include <simd/simd.h>
+#include "simd.hpp"
 
 // -- E N G I N E  N A M E S P A C E ------------------------------------------
 
@@ -217,6 +228,18 @@ namespace engine {
 	};
 
 
+	// -- S I N K -------------------------------------------------------------
+
+	/* receives elements as soon as they are complete (1-based indices, 0 when absent) */
+	template <typename T>
+	concept wavefront_sink = requires(T& sink, const float f, const std::uint32_t i) {
+		sink.new_position(f, f, f);
+		sink.new_texcoord(f, f);
+		sink.new_normal(f, f, f);
+		sink.new_face(i, i, i, i, i, i, i, i, i);
+	};
+
+
 	// -- W A V E F R O N T ---------------------------------------------------
 
 	class wavefront final {
@@ -293,64 +316,261 @@ namespace engine {
 						"texture index"
 					};
 
-				/* default constructor */
-				inline data(void)
-				: _positions{}, _texcoords{}, _normals{}, _faces{} {}
+					/* chunk-local index flag (relative indices, resolved by rebase) */
+					static constexpr std::uint32_t LOCAL = 1U << 31;
+
+					/* range material inherited from the previous range (resolved by merge) */
+					static constexpr std::uint32_t INHERIT = engine::model::NO_MATERIAL - 1U;
+
+					/* faces from face up to the next range share a material and a group */
+					struct range final {
+						std::uint32_t face;
+						std::uint32_t material;
+					};
+
+					/* faces from face up to the next one share a smoothing group (0: flat) */
+					struct smoothing final {
+						std::uint32_t face;
+						std::uint32_t id;
+					};
+
+					/* default constructor */
+					inline data(void)
+					: _positions{}, _texcoords{}, _normals{}, _faces{}, _relative{false},
+					  _ranges{}, _materials{}, _libraries{}, _smoothing{} {}
+
+					/* non-assignable class */
+					non_assignable(data);
+
+					/* destructor */
+					inline ~data(void) noexcept = default;
+
+
+					inline auto new_position(const float x, const float y, const float z) -> void {
+						_positions.emplace_back(simd::float3{x, y, z});
+					}
+
+					inline auto new_texcoord(const float u, const float v) -> void {
+						_texcoords.emplace_back(simd::float2{u, v});
+					}
+
+					inline auto new_normal(const float x, const float y, const float z) -> void {
+						_normals.emplace_back(simd::float3{x, y, z});
+					}
+
+					inline auto new_face(const std::uint32_t v1, const std::uint32_t t1, const std::uint32_t n1,
+										 const std::uint32_t v2, const std::uint32_t t2, const std::uint32_t n2,
+										 const std::uint32_t v3, const std::uint32_t t3, const std::uint32_t n3) -> void {
+						_faces.emplace_back(face{v1, t1, n1, v2, t2, n2, v3, t3, n3});
+					}
+
+					/* usemtl, material ids follow first use */
+					inline auto new_material(const std::string_view name) -> void {
+						self::push_range(static_cast<std::uint32_t>(_faces.size()), self::material_id(name));
+					}
+
+					/* g / o, new range with the current material */
+					inline auto new_group(const std::string_view) -> void {
+						self::push_range(static_cast<std::uint32_t>(_faces.size()),
+										 _ranges.empty() ? INHERIT : _ranges.back().material);
+					}
+
+					/* s, group number or off */
+					inline auto new_smoothing(const std::string_view name) -> void {
+						std::uint32_t id = 0U;
+						for (const char c : name) {
+							if (c < '0' || c > '9' || id > 0x0fffffffU)
+								break;
+							id = (id * 10U) + static_cast<std::uint32_t>(c - '0');
+						}
+						self::push_smoothing(static_cast<std::uint32_t>(_faces.size()), id);
+					}
+
+					/* mtllib, one or more paths */
+					inline auto new_library(const std::string_view paths) -> void {
+						size_type i = 0U;
+						while (i < paths.size()) {
+							while (i < paths.size() && (paths[i] == ' ' || paths[i] == '\t')) ++i;
+							const size_type begin = i;
+							while (i < paths.size() && paths[i] != ' ' && paths[i] != '\t') ++i;
+							if (i == begin)
+								break;
+							const std::string_view path = paths.substr(begin, i - begin);
+							if (std::find(_libraries.begin(), _libraries.end(), path) == _libraries.end())
+								_libraries.emplace_back(path);
+						}
+					}
+
+					/* append chunk ranges, faces shifted by base */
+					inline auto merge_ranges(const data& chunk, const std::uint32_t base) -> void {
+						for (const auto& r : chunk._ranges)
+							self::push_range(base + r.face, r.material == INHERIT
+										   ? INHERIT : self::material_id(chunk._materials[r.material]));
+						for (const auto& library : chunk._libraries)
+							self::new_library(library);
+						for (const auto& s : chunk._smoothing)
+							self::push_smoothing(base + s.face, s.id);
+					}
+
+					/* resolve inherited materials, in file order */
+					inline auto resolve_ranges(void) noexcept -> void {
+						std::uint32_t current = engine::model::NO_MATERIAL;
+						for (auto& r : _ranges)
+							current = r.material = (r.material == INHERIT) ? current : r.material;
+					}
+
+
+					/* rebase chunk-local indices on global offsets,
+					   false if a relative index points before the first element */
+					inline auto rebase(const std::uint32_t positions,
+									   const std::uint32_t texcoords,
+									   const std::uint32_t normals) noexcept -> bool {
+
+						if (not _relative)
+							return true;
+
+						bool valid = true;
+
+						const auto fix = [&valid](std::uint32_t& index, const std::uint32_t base) noexcept -> void {
+							if ((index & LOCAL) == 0U)
+								return;
+							// sign-extend 31-bit offset (may reach into previous chunks)
+							const auto offset = static_cast<std::int32_t>(index << 1) >> 1;
+							const auto global = static_cast<std::int64_t>(base) + offset;
+							valid &= (global > 0);
+							index  = global > 0 ? static_cast<std::uint32_t>(global) : 0U;
+						};
+
+						for (auto& f : _faces) {
+							fix(f.v1, positions); fix(f.t1, texcoords); fix(f.n1, normals);
+							fix(f.v2, positions); fix(f.t2, texcoords); fix(f.n2, normals);
+							fix(f.v3, positions); fix(f.t3, texcoords); fix(f.n3, normals);
+						}
+						_relative = false;
+						return valid;
+					}
+
+
+					/* positions */
+					std::vector<simd::float3> _positions;
+
+					/* texcoords */
+					std::vector<simd::float2> _texcoords;
 
-				/* non-assignable class */
-				non_assignable(data);
+					/* normals */
+					std::vector<simd::float3> _normals;
 
-				/* destructor */
-				inline ~data(void) noexcept = default;
+					/* faces */
+					std::vector<face> _faces;
 
+					/* has chunk-local indices */
+					bool _relative;
+
+					/* material / group ranges (faces before the first one have no material) */
+					std::vector<range> _ranges;
+
+					/* material names, by id */
+					std::vector<std::string> _materials;
+
+					/* material libraries */
+					std::vector<std::string> _libraries;
+
+					/* smoothing group ranges (faces before the first one use mesh_attributes::DEFAULT_GROUP) */
+					std::vector<smoothing> _smoothing;
+
+
+				private:
+
+					/* size type */
+					using size_type = std::size_t;
+
+					/* self type */
+					using self = data;
+
+					/* material id, added on first use */
+					inline auto material_id(const std::string_view name) -> std::uint32_t {
+						for (size_type i = 0U; i < _materials.size(); ++i)
+							if (_materials[i] == name)
+								return static_cast<std::uint32_t>(i);
+						_materials.emplace_back(name);
+						return static_cast<std::uint32_t>(_materials.size() - 1U);
+					}
+
+					/* new range, replaces an empty last one */
+					inline auto push_range(const std::uint32_t face, const std::uint32_t material) -> void {
+						if (not _ranges.empty() && _ranges.back().face == face) {
+							// keep a pending usemtl over a later group
+							if (material != INHERIT)
+								_ranges.back().material = material;
+							return;
+						}
+						_ranges.push_back(range{face, material});
+					}
+
+					/* new smoothing range, replaces an empty last one */
+					inline auto push_smoothing(const std::uint32_t face, const std::uint32_t id) -> void {
+						if (not _smoothing.empty() && _smoothing.back().face == face)
+							_smoothing.back().id = id;
+						else
+							_smoothing.push_back(smoothing{face, id});
+					}
+
+				public:
+
+
+
+					auto print(void) -> void {
+						//std::cout << "positions: " << _positions.size() << std::endl;
+						//for (auto& p : _positions)
+						//	std::cout << "x: " << p.x << " y: " << p.y << " z: " << p.z << std::endl;
+						//std::cout << "texcoords: " << _texcoords.size() << std::endl;
+						//for (auto& t : _texcoords)
+						//	std::cout << "u: " << t.u << " v: " << t.v << std::endl;
+						//std::cout << "normals: " << _normals.size() << std::endl;
+						//for (auto& n : _normals)
+						//	std::cout << "x: " << n.x << " y: " << n.y << " z: " << n.z << std::endl;
+						//std::cout << "faces: " << _faces.size() << std::endl;
+						//for (auto& f : _faces) {
+						//	std::cout << f.v1 << "/" << f.t1 << "/" << f.n1 << " " << f.v2 << "/" << f.t2 << "/" << f.n2 << " " << f.v3 << "/" << f.t3 << "/" << f.n3 << std::endl;
+						//}
+					}
+			};
+
+
+			// -- C A L L B A C K S -------------------------------------------
+
+			/* type-erased sink, unset callbacks drop their elements */
+			struct callbacks final {
+
+				/* position callback */
+				std::function<void(float, float, float)> position;
+
+				/* texcoord callback */
+				std::function<void(float, float)> texcoord;
+
+				/* normal callback */
+				std::function<void(float, float, float)> normal;
+
+				/* face callback (v, vt, vn per corner) */
+				std::function<void(const std::uint32_t (&)[9])> face;
 
 				inline auto new_position(const float x, const float y, const float z) -> void {
-					_positions.emplace_back(simd::float3{x, y, z});
+					if (position) position(x, y, z);
 				}
 
 				inline auto new_texcoord(const float u, const float v) -> void {
-					_texcoords.emplace_back(simd::float2{u, v});
+					if (texcoord) texcoord(u, v);
 				}
 
 				inline auto new_normal(const float x, const float y, const float z) -> void {
-					_normals.emplace_back(simd::float3{x, y, z});
+					if (normal) normal(x, y, z);
 				}
 
 				inline auto new_face(const std::uint32_t v1, const std::uint32_t t1, const std::uint32_t n1,
 									 const std::uint32_t v2, const std::uint32_t t2, const std::uint32_t n2,
 									 const std::uint32_t v3, const std::uint32_t t3, const std::uint32_t n3) -> void {
-					_faces.emplace_back(face{v1, t1, n1, v2, t2, n2, v3, t3, n3});
-				}
-
-
-				/* positions */
-				xns::vector<simd::float3> _positions;
-
-				/* texcoords */
-				xns::vector<simd::float2> _texcoords;
-
-				/* normals */
-				xns::vector<simd::float3> _normals;
-
-				/* faces */
-				xns::vector<face> _faces;
-
-
-
-				auto print(void) -> void {
-					//std::cout << "positions: " << _positions.size() << std::endl;
-					//for (auto& p : _positions)
-					//	std::cout << "x: " << p.x << " y: " << p.y << " z: " << p.z << std::endl;
-					//std::cout << "texcoords: " << _texcoords.size() << std::endl;
-					//for (auto& t : _texcoords)
-					//	std::cout << "u: " << t.u << " v: " << t.v << std::endl;
-					//std::cout << "normals: " << _normals.size() << std::endl;
-					//for (auto& n : _normals)
-					//	std::cout << "x: " << n.x << " y: " << n.y << " z: " << n.z << std::endl;
-					//std::cout << "faces: " << _faces.size() << std::endl;
-					//for (auto& f : _faces) {
-					//	std::cout << f.v1 << "/" << f.t1 << "/" << f.n1 << " " << f.v2 << "/" << f.t2 << "/" << f.n2 << " " << f.v3 << "/" << f.t3 << "/" << f.n3 << std::endl;
-					//}
+					const std::uint32_t indices[9] { v1, t1, n1, v2, t2, n2, v3, t3, n3 };
+					if (face) face(indices);
 				}
 			};
 
@@ -368,10 +588,27 @@ namespace engine {
 				_tr{&_transitions[0][3]}, // default state
 				_i{0U},
 				_kmap{},
-				_integral{0U},
-				_decimal{0U},
+				_mantissa{0U},
+				_exponent{0},
 				_sign{1},
-				_data{nullptr}
+				_scientific{0},
+				_escientific{1},
+				_emitter{nullptr},
+				_dtype{data::D_VERTEX},
+				_values{},
+				_count{0U},
+				_index{0U},
+				_isign{false},
+				_slot{0U},
+				_corners{},
+				_ccount{0U},
+				_counts{},
+				_lines{0U},
+				_at{0U},
+				_name{},
+				_nlen{0U},
+				_nkind{K_G},
+				_msg{nullptr}
 			{}
 
 			/* non-assignable */
@@ -384,64 +621,351 @@ namespace engine {
 			}
 
 
-			/* parse */
-			auto parse(data& data) -> void {
-				_data = &data;
-				// -- file check ----------------------------------------------
+			/* stream file through sink, chunk bytes per read (at most BUFFER_SIZE),
+			   elements are pushed as soon as their line is complete */
+			template <typename S> requires engine::wavefront_sink<S>
+			auto parse(S& sink, const xns::size_t chunk = BUFFER_SIZE) -> bool {
+
+				emitter emitter {
+					&sink,
+					[](void* s, const float x, const float y, const float z) -> void {
+						static_cast<S*>(s)->new_position(x, y, z); },
+					[](void* s, const float u, const float v) -> void {
+						static_cast<S*>(s)->new_texcoord(u, v); },
+					[](void* s, const float x, const float y, const float z) -> void {
+						static_cast<S*>(s)->new_normal(x, y, z); },
+					[](void* s, const std::uint32_t (&i)[9]) -> void {
+						static_cast<S*>(s)->new_face(i[0], i[1], i[2], i[3], i[4], i[5], i[6], i[7], i[8]); },
+					nullptr, nullptr, nullptr
+				};
+
+				// optional statements
+				if constexpr (requires(S& s, std::string_view n) { s.new_material(n); })
+					emitter.material = [](void* s, std::string_view n) -> void { static_cast<S*>(s)->new_material(n); };
+				if constexpr (requires(S& s, std::string_view n) { s.new_group(n); })
+					emitter.group = [](void* s, std::string_view n) -> void { static_cast<S*>(s)->new_group(n); };
+				if constexpr (requires(S& s, std::string_view n) { s.new_library(n); })
+					emitter.library = [](void* s, std::string_view n) -> void { static_cast<S*>(s)->new_library(n); };
+
+				return self::run(emitter, chunk);
+			}
+
 
-				if (_fd == -1) {
-					::write(2, "wavefront: error, can't open file\n", 35);
-					return;
+
+			static inline auto parse(const char* path) -> engine::vpackage {
+				//self::data data;
+				engine::vpackage vpackage;
+				self{path}.parse_mapped(vpackage, 0U);
+				return vpackage;
+			}
+
+			/* parse with submesh table and material names */
+			static inline auto load(const char* path) -> engine::model {
+				engine::model model;
+				self{path}.parse_mapped(model, 0U);
+				return model;
+			}
+
+
+			/* memory mapped parse (0 threads: one per CHUNK_SIZE bytes, up to core count),
+			   welded vertices only: no submesh split nor tangents */
+			auto parse_mapped(engine::vpackage& package, xns::size_t threads = 1U) -> bool {
+
+				const engine::mapped_file file{_path};
+
+				if (not file) {
+					std::cout << "error: can't map file" << std::endl;
+					return false;
 				}
 
-				#define ARR_SIZE CHARTYPE_SIZE * STATE_SIZE
-				std::cout << "chartype size: " << CHARTYPE_SIZE << std::endl;
-				std::cout << "state size: " << STATE_SIZE << std::endl;
-				std::cout << "sizeof arr: " << ARR_SIZE << std::endl;
-				std::cout << "sizeof trans struct: " << sizeof(transition) << std::endl;
-				std::cout << "sizeof trans: " << sizeof(_transitions) * ARR_SIZE << std::endl;
+				class data data;
+				return self::weld(file.begin(), file.end(), threads, data, package);
+			}
 
+			/* memory mapped parse, faces split in submeshes sorted by material */
+			auto parse_mapped(engine::model& model, xns::size_t threads = 1U) -> bool {
 
-				// -- main loop -----------------------------------------------
+				const engine::mapped_file file{_path};
 
+				if (not file) {
+					std::cout << "error: can't map file" << std::endl;
+					return false;
+				}
 
-				signed_type readed = 0;
+				return self::load(file.begin(), file.end(), model, threads);
+			}
 
-				// loop over file
-				while ((readed = read()) > 0) {
-					// loop over buffer
-					for (_i = 0; _i < static_cast<size_type>(readed); ++_i) {
-						// get chartype
-						chartype c = _chartypes[static_cast<byte>(_buffer[_i])];
-						// get next transition
-						_tr = &(_transitions[_tr->state()][c]);
-						// execute action
-						(this->*_actions[_tr->action()])();
+			/* parse bytes already in memory (0 threads: one per CHUNK_SIZE bytes, up to core count) */
+			static auto load(const char* begin, const char* end, engine::model& model, xns::size_t threads = 0U) -> bool {
+
+				class data data;
+
+				if (not self::weld(begin, end, threads, data, model.package))
+					return false;
+
+				self::split(data, model);
+
+				if (not data._texcoords.empty())
+					engine::mesh_attributes::tangents(model);
+				return true;
+			}
+
+			/* parse, fill missing normals and weld into package (data keeps the material ranges) */
+			static auto weld(const char* begin, const char* end, xns::size_t threads, data& data, engine::vpackage& package) -> bool {
+
+				if (threads == 0U) {
+					threads = (static_cast<size_type>(end - begin) / CHUNK_SIZE) + 1U;
+					threads = threads < engine::parallel::concurrency() ? threads : engine::parallel::concurrency();
+				}
+
+				// missing normals before welding, smoothing groups split vertices
+				return self::parse_chunks(begin, end, threads, data)
+					&& engine::mesh_attributes::normals(data)
+					&& engine::welder::weld(data, package);
+			}
+
+			/* submesh table from material ranges (welded indexes follow face order),
+			   ranges are stably sorted by material and the index stream permuted to
+			   match, one submesh per material (groups are not kept apart) */
+			static auto split(const data& data, engine::model& model) -> void {
+
+				auto& indexes = model.package.second;
+				const auto& vertices = model.package.first;
+
+				const auto faces = static_cast<std::uint32_t>(indexes.size() / 3U);
+
+				// ranges in file order, faces before the first one have no material
+				std::vector<class data::range> ranges;
+				ranges.reserve(data._ranges.size() + 1U);
+
+				if (data._ranges.empty() || data._ranges.front().face != 0U)
+					ranges.push_back({0U, engine::model::NO_MATERIAL});
+				ranges.insert(ranges.end(), data._ranges.begin(), data._ranges.end());
+
+				struct run final {
+					std::uint32_t begin;
+					std::uint32_t end;
+					std::uint32_t material;
+				};
+
+				std::vector<run> runs;
+				runs.reserve(ranges.size());
+
+				for (size_type i = 0U; i < ranges.size(); ++i) {
+					const std::uint32_t end = (i + 1U < ranges.size()) ? ranges[i + 1U].face : faces;
+					if (ranges[i].face < end)
+						runs.push_back(run{ranges[i].face, end, ranges[i].material});
+				}
+
+				std::stable_sort(runs.begin(), runs.end(), [](const run& a, const run& b) noexcept {
+					return a.material < b.material;
+				});
+
+				// permute only when sorting moved something
+				bool ordered = true;
+				for (size_type i = 1U; i < runs.size(); ++i)
+					ordered &= (runs[i - 1U].end == runs[i].begin);
+
+				if (not ordered) {
+					engine::indexes sorted;
+					sorted.reserve(indexes.size());
+					for (const auto& r : runs)
+						sorted.insert(sorted.end(), indexes.begin() + (r.begin * 3U), indexes.begin() + (r.end * 3U));
+					indexes = std::move(sorted);
+				}
+
+				model.submeshes.clear();
+				model.submeshes.reserve(runs.size());
+
+				std::uint32_t offset = 0U;
+
+				for (const auto& r : runs) {
+
+					const std::uint32_t count = (r.end - r.begin) * 3U;
+
+					// runs of one material are adjacent after the sort, coalesced
+					if (model.submeshes.empty() || model.submeshes.back().material != r.material)
+						model.submeshes.push_back(engine::submesh{offset, 0U, r.material, 0U,
+																  engine::bounds::at(vertices[indexes[offset]])});
+
+					auto& sub = model.submeshes.back();
+
+					for (std::uint32_t i = offset; i < offset + count; ++i)
+						sub.bounds.expand(vertices[indexes[i]]);
+
+					sub.index_count += count;
+					offset += count;
+				}
+
+				model.materials = data._materials;
+				model.libraries = data._libraries;
+			}
+
+			/* parse range in chunks split at line boundaries, one thread per chunk */
+			static auto parse_chunks(const char* begin, const char* end, const xns::size_t count, data& data) -> bool {
+
+				if (count < 2U) {
+					if (not self::parse_range(begin, begin, end, data))
+						return false;
+					if (not data.rebase(0U, 0U, 0U)) {
+						std::cout << "parsing error. (relative index out of range)" << std::endl;
+						return false;
 					}
+					data.resolve_ranges();
+					return true;
+				}
 
-					if (_tr->state() == S_ERROR) {
-						const char* msg = _tr->msg();
-						if (msg)
-							std::cout << "\x1b[31mERROR\x1b[0m: " << msg << std::endl;
-						else
-							std::cout << "\x1b[31mERROR\x1b[0m: unknown error" << std::endl;
-						break;
+				const auto size = static_cast<size_type>(end - begin);
+
+				// chunk boundaries, each chunk starts right after a line feed
+				std::vector<const char*> bounds(count + 1U);
+				bounds[0U]     = begin;
+				bounds[count]  = end;
+				for (size_type i = 1U; i < count; ++i) {
+					const char* split = engine::scanner::find_newline(begin + ((size * i) / count), end);
+					split = split != end ? split + 1 : end;
+					bounds[i] = split > bounds[i - 1U] ? split : bounds[i - 1U];
+				}
+
+				// thread-local results
+				std::vector<class data> chunks(count);
+				std::vector<char> status(count, 0);
+
+				engine::parallel::run(count, [&](const size_type i) {
+					status[i] = self::parse_range(begin, bounds[i], bounds[i + 1U], chunks[i]);
+				});
+
+				for (const auto ok : status)
+					if (not ok) return false;
+
+				// prefix sums of element counts
+				std::vector<std::uint32_t> positions(count + 1U, 0U);
+				std::vector<std::uint32_t> texcoords(count + 1U, 0U);
+				std::vector<std::uint32_t>   normals(count + 1U, 0U);
+				std::vector<size_type>         faces(count + 1U, 0U);
+
+				for (size_type i = 0U; i < count; ++i) {
+					positions[i + 1U] = positions[i] + static_cast<std::uint32_t>(chunks[i]._positions.size());
+					texcoords[i + 1U] = texcoords[i] + static_cast<std::uint32_t>(chunks[i]._texcoords.size());
+					  normals[i + 1U] =   normals[i] + static_cast<std::uint32_t>(chunks[i]._normals.size());
+					    faces[i + 1U] =     faces[i] + chunks[i]._faces.size();
+				}
+
+				data._positions.resize(positions[count]);
+				data._texcoords.resize(texcoords[count]);
+				  data._normals.resize(normals[count]);
+				    data._faces.resize(faces[count]);
+
+				// fix relative indices and gather in place, one thread per chunk
+				engine::parallel::run(count, [&](const size_type i) {
+					auto& chunk = chunks[i];
+					status[i] = chunk.rebase(positions[i], texcoords[i], normals[i]);
+					std::copy(chunk._positions.begin(), chunk._positions.end(), data._positions.begin() + positions[i]);
+					std::copy(chunk._texcoords.begin(), chunk._texcoords.end(), data._texcoords.begin() + texcoords[i]);
+					std::copy(chunk._normals.begin(),   chunk._normals.end(),   data._normals.begin()   + normals[i]);
+					std::copy(chunk._faces.begin(),     chunk._faces.end(),     data._faces.begin()     + static_cast<std::ptrdiff_t>(faces[i]));
+				});
+
+				for (const auto ok : status) {
+					if (ok) continue;
+					std::cout << "parsing error. (relative index out of range)" << std::endl;
+					return false;
+				}
+
+				// material ranges, few per chunk
+				for (size_type i = 0U; i < count; ++i)
+					data.merge_ranges(chunks[i], static_cast<std::uint32_t>(faces[i]));
+				data.resolve_ranges();
+
+				return true;
+			}
+
+			/* parse range of the file starting at file (errors report file lines) */
+			static auto parse_range(const char* file, const char* begin, const char* end, data& data) -> bool {
+
+				cursor cursor{file, begin, end};
+
+				while (not cursor.eof()) {
+
+					const std::string_view keyword = cursor.token();
+
+					if (keyword == "v") {
+						// v x y z [w] [r g b], extra components ignored
+						float x, y, z;
+						if (not cursor.number(x)
+						 || not cursor.number(y)
+						 || not cursor.number(z)
+						 || not cursor.trailing(MAX_VALUES - 3U))
+							return cursor.error();
+						data.new_position(x, y, z);
 					}
-					else if (_tr->state() == S_END) {
-						std::cout << "\x1b[32mEND\x1b[0m" << std::endl;
-						break;
+					else if (keyword == "vn") {
+						float x, y, z;
+						if (not cursor.number(x)
+						 || not cursor.number(y)
+						 || not cursor.number(z)
+						 || not cursor.eol())
+							return cursor.error();
+						data.new_normal(x, y, z);
 					}
+					else if (keyword == "vt") {
+						// vt u [v [w]], w ignored
+						float u, v = 0.0f;
+						if (not cursor.number(u)
+						 || (not cursor.eol() && not cursor.number(v))
+						 || not cursor.trailing(1U))
+							return cursor.error();
+						data.new_texcoord(u, v);
+					}
+					else if (keyword == "f") {
+						// fan triangulation (convex polygons), emitted while reading
+						std::uint32_t first[3], prev[3], corner[3];
+						if (not cursor.group(first, data)
+						 || not cursor.group(prev, data))
+							return cursor.error();
+						do {
+							if (not cursor.group(corner, data))
+								return cursor.error();
+							data.new_face(first[0],  first[1],  first[2],
+										  prev[0],   prev[1],   prev[2],
+										  corner[0], corner[1], corner[2]);
+							std::copy(corner, corner + 3, prev);
+						} while (not cursor.eol());
+					}
+					else if (keyword == "usemtl")
+						data.new_material(cursor.rest());
+					else if (keyword == "g" || keyword == "o")
+						data.new_group(cursor.rest());
+					else if (keyword == "mtllib")
+						data.new_library(cursor.rest());
+					else if (keyword == "s")
+						data.new_smoothing(cursor.rest());
+
+					cursor.next_line();
 				}
-				data.print();
+				return true;
 			}
 
+			/* re-index */
+			static auto reindex(const data& data, engine::vpackage& package) -> void {
 
+				auto& vec = package.first;
 
-			static inline auto parse(const char* path) -> engine::vpackage {
-				//self::data data;
-				engine::vpackage vpackage;
-				self{path}.parse2(vpackage);
-				return vpackage;
+				vec.reserve(vec.size() + (data._faces.size() * 3U));
+
+				// absent texcoord or normal (0) keeps the vertex default
+				auto corner = [&data, &vec](const std::uint32_t v, const std::uint32_t t, const std::uint32_t n) -> void {
+					auto& vertex = vec.emplace_back();
+					vertex.position(data._positions[v - 1U]);
+					if (n != 0U) vertex.normal(data._normals[n - 1U]);
+					if (t != 0U) vertex.texture(data._texcoords[t - 1U]);
+				};
+
+				for (const auto& face : data._faces) {
+					corner(face.v1, face.t1, face.n1);
+					corner(face.v2, face.t2, face.n2);
+					corner(face.v3, face.t3, face.n3);
+				}
 			}
 
 
@@ -472,7 +996,8 @@ namespace engine {
 						continue;
 
 					if (tokens[0] == "v") {
-						if (tokens.size() != 4) {
+						// v x y z [w] [r g b]
+						if (tokens.size() < 4 || tokens.size() > 8) {
 							std::cout << "parsing error." << std::endl;
 							return;
 						}
@@ -487,52 +1012,82 @@ namespace engine {
 
 					}
 					else if (tokens[0] == "vt") {
-						if (tokens.size() != 3) {
+						// vt u [v [w]]
+						if (tokens.size() < 2 || tokens.size() > 4) {
 							std::cout << "parsing error." << std::endl;
 							return;
 						}
-						data.new_texcoord(std::stof(tokens[1]), std::stof(tokens[2]));
+						data.new_texcoord(std::stof(tokens[1]), tokens.size() > 2 ? std::stof(tokens[2]) : 0.0f);
 
 					}
 					else if (tokens[0] == "f") {
-						if (tokens.size() != 4) {
+
+						// trailing comment
+						const auto groups = static_cast<size_type>(std::find_if(tokens.begin(), tokens.end(),
+											[](const std::string& t) { return t[0] == '#'; }) - tokens.begin());
+
+						if (groups < 4) {
 							std::cout << "parsing error." << std::endl;
 							return;
 						}
 
-						auto split = [](const std::string& str, const char sep) -> std::vector<std::string> {
-							std::vector<std::string> tokens;
+						// v, v/vt, v//vn or v/vt/vn, negative indices relative to the current counts
+						auto corner = [&data](const std::string& group, std::uint32_t (&i)[3]) -> bool {
+							const size_type counts[3] { data._positions.size(), data._texcoords.size(), data._normals.size() };
+							std::istringstream stream(group);
 							std::string token;
-							std::istringstream tokenStream(str);
-							while (std::getline(tokenStream, token, sep))
-								tokens.push_back(token);
-							return tokens;
+							unsigned int slot = 0U;
+							i[0] = i[1] = i[2] = 0U;
+							while (std::getline(stream, token, '/')) {
+								if (slot > 2U)
+									return false;
+								if (not token.empty()) {
+									// whole token numeric, or the line is malformed
+									long value = 0;
+									const auto end = token.data() + token.size();
+									const auto [ptr, ec] = std::from_chars(token.data(), end, value);
+									if (ec != std::errc{} || ptr != end)
+										return false;
+									const long index = value < 0 ? static_cast<long>(counts[slot]) + value + 1 : value;
+									if (index <= 0 || static_cast<size_type>(index) > counts[slot])
+										return false;
+									i[slot] = static_cast<std::uint32_t>(index);
+								}
+								++slot;
+							}
+							return i[0] != 0U;
 						};
 
-						auto subtok1 = split(tokens[1], '/');
-						auto subtok2 = split(tokens[2], '/');
-						auto subtok3 = split(tokens[3], '/');
+						std::uint32_t first[3], prev[3], next[3];
 
+						// fan triangulation (convex polygons)
+						for (size_type g = 1U; g < groups; ++g) {
 
-						data.new_face(std::stoi(subtok1[0]), std::stoi(subtok1[1]), std::stoi(subtok1[2]),
-									  std::stoi(subtok2[0]), std::stoi(subtok2[1]), std::stoi(subtok2[2]),
-									  std::stoi(subtok3[0]), std::stoi(subtok3[1]), std::stoi(subtok3[2]));
+							if (not corner(tokens[g], g == 1U ? first : g == 2U ? prev : next)) {
+								std::cout << "parsing error." << std::endl;
+								return;
+							}
+							if (g < 3U)
+								continue;
 
+							data.new_face(first[0], first[1], first[2],
+										  prev[0],  prev[1],  prev[2],
+										  next[0],  next[1],  next[2]);
+							std::copy(next, next + 3, prev);
+						}
 					}
+					else if (tokens[0] == "s")
+						data.new_smoothing(tokens.size() > 1U ? tokens[1] : std::string{});
 
 					//std::cout << "line -> " << line << std::endl;
 				}
 
-				auto& vec     = package.first;
-				auto& indices = package.second;
-
-				// re-index
-				for (const auto& face : data._faces) {
-					vec.emplace_back(data._positions[face.v1 - 1], data._normals[face.n1 - 1], data._texcoords[face.t1 - 1]);
-					vec.emplace_back(data._positions[face.v2 - 1], data._normals[face.n2 - 1], data._texcoords[face.t2 - 1]);
-					vec.emplace_back(data._positions[face.v3 - 1], data._normals[face.n3 - 1], data._texcoords[face.t3 - 1]);
+				if (not engine::mesh_attributes::normals(data)) {
+					std::cout << "parsing error." << std::endl;
+					return;
 				}
 
+				self::reindex(data, package);
 			};
 
 
@@ -553,11 +1108,32 @@ namespace engine {
 			using enum_type    = xns::ubyte;
 
 			/* action prototype */
-			using action_proto = auto (wavefront::*)(void) noexcept -> void;
+			using action_proto = auto (wavefront::*)(void) -> void;
+
+
+			/* buffer size (read window, scanned 64 bytes per step) */
+			enum : size_type { BUFFER_SIZE = 64U * 1024U };
+
+			/* minimum bytes per parsing thread */
+			enum : size_type { CHUNK_SIZE = 4U * 1024U * 1024U };
+
+			/* mantissa accumulation limit (19 significant digits) */
+			static constexpr xns::umax MANTISSA_LIMIT = 1000000000000000000ULL;
+
+			/* values per line (v: x y z [w] [r g b]) */
+			enum : size_type { MAX_VALUES = 8U };
 
+			/* fan window (first, previous and current corner) */
+			enum : size_type { MAX_CORNERS = 3U };
 
-			/* buffer size */
-			enum : size_type { BUFFER_SIZE = 200 };
+			/* exponent accumulation limit (saturates to zero or infinity) */
+			static constexpr std::int64_t EXPONENT_LIMIT = 0x10000;
+
+			/* face index limit */
+			static constexpr std::uint64_t INDEX_LIMIT = 0x80000000ULL;
+
+			/* usemtl / mtllib / g / o argument length */
+			enum : size_type { MAX_NAME = 256U };
 
 
 
@@ -567,14 +1143,169 @@ namespace engine {
 
 			class keyword_map;
 
+			class cursor;
+
+
+
+
+			// -- E M I T T E R -----------------------------------------------
+
+			/* sink erased behind plain function pointers, keeps the loop non-template */
+			struct emitter final {
+
+				/* sink */
+				void* sink;
+
+				/* position */
+				void (*position)(void*, float, float, float);
+
+				/* texcoord */
+				void (*texcoord)(void*, float, float);
+
+				/* normal */
+				void (*normal)(void*, float, float, float);
+
+				/* face */
+				void (*face)(void*, const std::uint32_t (&)[9]);
+
+				/* usemtl, g / o, mtllib (null when the sink has no such method) */
+				void (*material)(void*, std::string_view);
+				void (*group)(void*, std::string_view);
+				void (*library)(void*, std::string_view);
+			};
+
+
+			// -- private methods ---------------------------------------------
+
+			/* main loop, one transition per byte, state carried across reads */
+			auto run(const emitter& emitter, size_type chunk) -> bool {
+
+				if (_fd == -1) {
+					std::cout << "wavefront: error, can't open file" << std::endl;
+					return false;
+				}
+
+				chunk = (chunk == 0U || chunk > BUFFER_SIZE) ? BUFFER_SIZE : chunk;
+
+				if (::lseek(_fd, 0, SEEK_SET) == -1) {
+					std::cout << "wavefront: error, can't rewind file" << std::endl;
+					return false;
+				}
+
+				self::reset(emitter);
+
+				signed_type readed = 0;
+
+				// loop over file
+				while ((readed = self::read(chunk)) > 0) {
+
+					const char* const end = _buffer + readed;
+
+					// loop over buffer
+					for (_i = 0; _i < static_cast<size_type>(readed); ++_i) {
+
+						// bulk skip runs that keep the current state
+						switch (_tr->state()) {
+							case S_COMMENT:
+								_i = static_cast<size_type>(engine::scanner::find_control(_buffer + _i, end) - _buffer);
+								break;
+							case S_START:
+							case S_AFTER_KEYWORD:
+							case S_BETWEEN_INDEXES:
+								_i = static_cast<size_type>(engine::scanner::skip_blanks(_buffer + _i, end) - _buffer);
+								break;
+							default:
+								break;
+						}
+
+						if (_i == static_cast<size_type>(readed))
+							break;
+
+						self::step(_chartypes[static_cast<byte>(_buffer[_i])]);
+					}
 
+					if (_tr->state() == S_ERROR) {
+						// lines before the failing byte
+						return self::error(_lines + engine::scanner::count_lines(_buffer, _buffer + _at) + 1U);
+					}
+
+					if (_tr->state() == S_END)
+						break;
+
+					_lines += engine::scanner::count_lines(_buffer, end);
+				}
+
+				if (readed < 0) {
+					std::cout << "wavefront: error, can't read file" << std::endl;
+					return false;
+				}
+
+				// missing final line feed, flush pending element
+				if (_tr->state() != S_END) {
+					self::step(LF);
+					if (_tr->state() == S_ERROR)
+						return self::error(_lines + 1U);
+				}
+
+				_emitter = nullptr;
+				return true;
+			}
+
+			/* one transition */
+			inline auto step(const enum_type c) -> void {
+				// get next transition
+				_tr = &(_transitions[_tr->state()][c]);
+				// execute action
+				(this->*_actions[_tr->action()])();
+			}
+
+			/* reset machine */
+			inline auto reset(const emitter& emitter) noexcept -> void {
+				_tr          = &_transitions[0][3]; // default state
+				_i           = 0U;
+				_kmap.clear();
+				_mantissa    = 0U;
+				_exponent    = 0;
+				_sign        = 1;
+				_scientific  = 0;
+				_escientific = 1;
+				_emitter     = &emitter;
+				_count       = 0U;
+				_index       = 0U;
+				_isign       = false;
+				_slot        = 0U;
+				_ccount      = 0U;
+				_counts[0]   = _counts[1] = _counts[2] = 0U;
+				_lines       = 0U;
+				_at          = 0U;
+				_nlen        = 0U;
+				_msg         = nullptr;
+			}
+
+			/* report error */
+			inline auto error(const size_type line) -> bool {
+				const char* msg = _tr->msg() != nullptr ? _tr->msg() : _msg;
+				std::cout << "\x1b[31mERROR\x1b[0m: "
+						  << (msg != nullptr ? msg : "unknown error")
+						  << " (line " << line << ")" << std::endl;
+				_emitter = nullptr;
+				return false;
+			}
+
+			/* fail from an action */
+			inline auto fail(const char* msg) noexcept -> void {
+				_msg = msg;
+				_tr  = &_transitions[S_ERROR][NIL];
+				self::exit();
+			}
 
 
 			// -- private actions ---------------------------------------------
 
 			/* exit */
 			inline auto exit(void) noexcept -> void {
-				_i = BUFFER_SIZE;
+				_at = _i;
+				_i  = BUFFER_SIZE;
 			}
 
 			/* skip */
@@ -586,87 +1317,298 @@ namespace engine {
 			}
 
 
-			/* parse keyword */
-			inline auto parse_keyword(void) noexcept -> void {
-				auto type = _kmap.type();
+			/* parse keyword */
+			inline auto parse_keyword(void) noexcept -> void {
+
+				const keyword_type type = _kmap.type();
+
+				switch (type) {
+					case K_V:
+						_dtype = data::D_VERTEX;
+						break;
+					case K_VT:
+						_dtype = data::D_TEXCOORD;
+						break;
+					case K_VN:
+						_dtype = data::D_NORMAL;
+						break;
+					case K_F:
+						_dtype = data::D_FACE;
+						_tr    = &_transitions[S_BETWEEN_INDEXES][SPACE];
+						break;
+					case K_USEMTL:
+					case K_MTLLIB:
+					case K_G:
+					case K_O:
+						_nkind = type;
+						_nlen  = 0U;
+						_tr    = &_transitions[S_NAME][OTHER];
+						break;
+					case K_INVALID:
+						self::fail("invalid keyword");
+						break;
+					default:
+						// not implemented, skip line as a comment
+						_tr = &_transitions[0][HASH];
+						break;
+				}
+				_count = 0U;
+			}
+
+			/* keyword alone on its line */
+			inline auto end_keyword(void) noexcept -> void {
+				switch (_kmap.type()) {
+					case K_INVALID:
+						self::fail("invalid keyword");
+						break;
+					case K_V: case K_VT: case K_VN: case K_F:
+						self::fail("expect values after keyword");
+						break;
+					case K_G: case K_O:
+						// unnamed group
+						_nkind = K_G;
+						_nlen  = 0U;
+						self::emit_name();
+						break;
+					default:
+						break;
+				}
+			}
+
+			/* parse float */
+			inline auto parse_float(void) noexcept -> void {
+
+				const std::int64_t exponent = _exponent + (_escientific * _scientific);
+
+				if (_count < MAX_VALUES)
+					_values[_count] = engine::float_parser::compose(_mantissa, exponent, _sign < 0);
+				++_count;
+
+				_mantissa    = 0U;
+				_exponent    = 0;
+				_sign        = 1;
+				_scientific  = 0;
+				_escientific = 1;
+			}
+
+			/* emit values */
+			inline auto emit_values(void) -> void {
+
+				switch (_dtype) {
+
+					// v x y z [w | r g b]
+					case data::D_VERTEX:
+						if (_count < 3U) { self::fail("expect 3 values for vertex"); return; }
+						_emitter->position(_emitter->sink, _values[0], _values[1], _values[2]);
+						++_counts[0];
+						break;
+
+					// vt u [v [w]]
+					case data::D_TEXCOORD:
+						if (_count < 1U || _count > 3U) { self::fail("expect 1 to 3 values for texcoord"); return; }
+						_emitter->texcoord(_emitter->sink, _values[0], _count > 1U ? _values[1] : 0.0f);
+						++_counts[1];
+						break;
+
+					// vn x y z
+					case data::D_NORMAL:
+						if (_count != 3U) { self::fail("expect 3 values for normal"); return; }
+						_emitter->normal(_emitter->sink, _values[0], _values[1], _values[2]);
+						++_counts[2];
+						break;
+
+					default:
+						self::fail("unexpected values");
+						return;
+				}
+				_count = 0U;
+			}
+
+			/* parse float, emit values */
+			inline auto float_emit(void) -> void {
+				self::parse_float();
+				self::emit_values();
+			}
+
+
+			/* plus */
+			inline auto plus(void) noexcept -> void {
+				_sign = +1;
+			}
+
+			/* minus */
+			inline auto minus(void) noexcept -> void {
+				_sign = -1;
+			}
+
+			/* integer */
+			inline auto integer(void) noexcept -> void {
+				if (_mantissa < MANTISSA_LIMIT)
+					_mantissa = (_mantissa * 10U) + static_cast<xns::umax>(_buffer[_i] ^ '0');
+				else
+					++_exponent;
+			}
+
+			/* decimal */
+			inline auto decimal(void) noexcept -> void {
+				if (_mantissa < MANTISSA_LIMIT) {
+					_mantissa = (_mantissa * 10U) + static_cast<xns::umax>(_buffer[_i] ^ '0');
+					--_exponent;
+				}
+			}
+
+			/* exponent minus */
+			inline auto exponent_minus(void) noexcept -> void {
+				_escientific = -1;
+			}
+
+			/* exponent digit */
+			inline auto exponent_digit(void) noexcept -> void {
+				if (_scientific < EXPONENT_LIMIT)
+					_scientific = (_scientific * 10) + (_buffer[_i] ^ '0');
+			}
+
+
+			/* index digit */
+			inline auto index_digit(void) noexcept -> void {
+				if (_index < INDEX_LIMIT)
+					_index = (_index * 10U) + static_cast<std::uint64_t>(_buffer[_i] ^ '0');
+			}
+
+			/* index minus */
+			inline auto index_minus(void) noexcept -> void {
+				_isign = true;
+			}
+
+			/* store index in current slot (v, vt, vn), relative ones resolved on counts */
+			inline auto store_index(void) noexcept -> bool {
+
+				if (_slot > 2U) {
+					self::fail("too many indexes in group");
+					return false;
+				}
+
+				if (_index == 0U || _index >= INDEX_LIMIT) {
+					self::fail("index out of range");
+					return false;
+				}
+
+				std::uint64_t value = _index;
+
+				if (_isign) {
+					if (_index > _counts[_slot]) {
+						self::fail("relative index out of range");
+						return false;
+					}
+					value = _counts[_slot] - _index + 1U;
+				}
+
+				_corners[self::fan()][_slot] = static_cast<std::uint32_t>(value);
+
+				_index = 0U;
+				_isign = false;
+				++_slot;
+				return true;
+			}
+
+			/* slash, next slot (empty when no digits) */
+			inline auto index_next(void) noexcept -> void {
+				if (_index == 0U && not _isign) {
+					if (_slot > 1U) { self::fail("too many indexes in group"); return; }
+					_corners[self::fan()][_slot] = 0U;
+					++_slot;
+					return;
+				}
+				self::store_index();
+			}
+
+			/* end of group, every corner past the second closes a fan triangle */
+			inline auto index_group(void) -> void {
+				if (not self::store_index())
+					return;
+				// absent trailing slots
+				for (; _slot < 3U; ++_slot)
+					_corners[self::fan()][_slot] = 0U;
+				_slot = 0U;
+
+				if (++_ccount < 3U)
+					return;
+
+				const std::uint32_t indices[9] {
+					_corners[0][0], _corners[0][1], _corners[0][2],
+					_corners[1][0], _corners[1][1], _corners[1][2],
+					_corners[2][0], _corners[2][1], _corners[2][2]
+				};
+
+				_emitter->face(_emitter->sink, indices);
+
+				// current corner becomes previous
+				_corners[1][0] = _corners[2][0];
+				_corners[1][1] = _corners[2][1];
+				_corners[1][2] = _corners[2][2];
+			}
 
-				// reset count
-				if (type == K_INVALID) {
-					::exit(1);
-				}
-				if (type == K_NOT_IMPLEMENTED) {
-					// goto comment state
-					_tr = &_transitions[0][HASH];
+			/* end of group and line */
+			inline auto index_face(void) -> void {
+				self::index_group();
+				if (_tr->state() == S_ERROR)
 					return;
-				}
+				self::emit_face();
+			}
 
-				switch (type) {
-					case K_V:
-						_dtype = data::D_VERTEX;
-						break;
-					case K_VT:
-						_dtype = data::D_TEXCOORD;
-						break;
-					case K_VN:
-						_dtype = data::D_NORMAL;
-						break;
-					case K_F:
-						_dtype = data::D_FACE;
-						break;
-					default:
-						break;
+			/* end of face, triangles already emitted */
+			inline auto emit_face(void) noexcept -> void {
+				if (_ccount < 3U) {
+					self::fail("expect at least 3 corners for face");
+					return;
 				}
-				//_data->new_entry(_dtype);
+				_ccount = 0U;
 			}
 
-			/* parse float */
-			inline auto parse_float(void) noexcept -> void {
-
-				float value = static_cast<float>(_integral);
-
-				float decimal = .0f;
-				if (_decimal) {
-					const float facteur = std::pow(10, std::floor(std::log10(_decimal) + 1));
-					decimal = static_cast<float>(_decimal) / facteur ? facteur : 1;
-					value += decimal;
-				}
-				value *= _sign;
-				//_data->add_value(_dtype, value);
-				//_mesh->_data[_dtype].back()._values.emplace_back(value);
-				std::cout << "value: " << value << std::endl;
-
-				_integral = 0;
-				_decimal  = 0;
-				_sign     = 1;
+			/* fan slot of the current corner (first, previous, current) */
+			inline auto fan(void) const noexcept -> size_type {
+				return _ccount < 2U ? _ccount : 2U;
 			}
 
 
-			/* plus */
-			inline auto plus(void) noexcept -> void {
-				_sign = +1;
+			/* name char */
+			inline auto name_char(void) noexcept -> void {
+				// leading blanks
+				if (_nlen == 0U && (_buffer[_i] == ' ' || _buffer[_i] == '\t'))
+					return;
+				if (_nlen == MAX_NAME) {
+					self::fail("name too long");
+					return;
+				}
+				_name[_nlen++] = _buffer[_i];
 			}
 
-			/* minus */
-			inline auto minus(void) noexcept -> void {
-				_sign = -1;
-			}
+			/* emit name to the statement callback */
+			inline auto emit_name(void) -> void {
+				// trailing blanks
+				while (_nlen != 0U && (_name[_nlen - 1U] == ' ' || _name[_nlen - 1U] == '\t'))
+					--_nlen;
 
-			/* integer */
-			inline auto integer(void) noexcept -> void {
-				_integral *= 10U;
-				_integral += _buffer[_i] ^ '0';
-			}
+				const std::string_view name{_name, _nlen};
 
-			/* decimal */
-			inline auto decimal(void) noexcept -> void {
-				_decimal *= 10U;
-				_decimal += _buffer[_i] ^ '0';
+				switch (_nkind) {
+					case K_USEMTL:
+						if (_emitter->material) _emitter->material(_emitter->sink, name);
+						break;
+					case K_MTLLIB:
+						if (_emitter->library)  _emitter->library(_emitter->sink, name);
+						break;
+					default:
+						if (_emitter->group)    _emitter->group(_emitter->sink, name);
+						break;
+				}
+				_nlen = 0U;
 			}
 
 
 			/* read */
-			inline auto read(void) noexcept -> signed_type {
-				return ::read(_fd, _buffer, BUFFER_SIZE);
+			inline auto read(const size_type chunk) noexcept -> signed_type {
+				return ::read(_fd, _buffer, chunk);
 			}
 
 
@@ -721,6 +1663,15 @@ namespace engine {
 				S_INTEGER,
 				S_DECIMAL,
 
+				S_EXPONENT,
+				S_EXPONENT_SIGN,
+				S_EXPONENT_DIGITS,
+
+				S_INDEX_MINUS,
+				S_INDEX_SLASH,
+
+				S_NAME,
+
 				STATE_SIZE
 			};
 
@@ -738,6 +1689,23 @@ namespace engine {
 
 				A_INTEGER,
 				A_DECIMAL,
+
+				A_END_KEYWORD,
+				A_EMIT_VALUES,
+				A_FLOAT_EMIT,
+
+				A_EXPONENT_MINUS,
+				A_EXPONENT_DIGIT,
+
+				A_INDEX_DIGIT,
+				A_INDEX_MINUS,
+				A_INDEX_NEXT,
+				A_INDEX_GROUP,
+				A_INDEX_FACE,
+				A_EMIT_FACE,
+
+				A_NAME_CHAR,
+				A_EMIT_NAME,
 			};
 
 			static constexpr action_proto _actions[] {
@@ -750,6 +1718,19 @@ namespace engine {
 				&wavefront::minus,
 				&wavefront::integer,
 				&wavefront::decimal,
+				&wavefront::end_keyword,
+				&wavefront::emit_values,
+				&wavefront::float_emit,
+				&wavefront::exponent_minus,
+				&wavefront::exponent_digit,
+				&wavefront::index_digit,
+				&wavefront::index_minus,
+				&wavefront::index_next,
+				&wavefront::index_group,
+				&wavefront::index_face,
+				&wavefront::emit_face,
+				&wavefront::name_char,
+				&wavefront::emit_name,
 			};
 
 			/* keyword type */
@@ -1000,95 +1981,95 @@ namespace engine {
 				},
 
 				/* KEYWORD */ {
-					{S_ERROR,       A_EXIT, "expect values after keyword"},           // NIL
-					{S_ERROR,       A_EXIT, "ctrl in keyword"},           // CTRL
-					{S_ERROR,       A_EXIT, "invalid keyword"},           // OTHER
-
-					{S_AFTER_KEYWORD, A_PARSE_KEYWORD},  // SPACE
-					{S_ERROR,       A_EXIT, "expect values after keyword"},           // CR
-					{S_ERROR,       A_EXIT, "expect values after keyword"},           // LF
-					{S_ERROR,       A_EXIT, "unknown error"},           // BACKSLASH // need wait LF
-					{S_ERROR,       A_EXIT, "comment must begin at start of line"},           // HASH
-
-					{S_KEYWORD,     A_COUNT},          // KEYWORD  keyword
-
-					{S_KEYWORD,     A_COUNT},          // EXPONENT is in keyword char
-					{S_KEYWORD,     A_COUNT},          // TWO      is in keyword char
-
-					{S_ERROR,       A_EXIT, "invalid char in keyword"},           // NUMBER
-					{S_ERROR,       A_EXIT, "invalid char in keyword"},           // POINT
-					{S_ERROR,       A_EXIT, "invalid char in keyword"},           // PLUS
-					{S_ERROR,       A_EXIT, "invalid char in keyword"},           // MINUS
-					{S_ERROR,       A_EXIT, "invalid char in keyword"},           // SLASH
+					{S_ERROR, A_EXIT, "expect values after keyword"}, // NIL
+					{S_ERROR, A_EXIT, "ctrl in keyword"},        // CTRL
+					{S_ERROR, A_EXIT, "invalid keyword"},        // OTHER
+
+					{S_AFTER_KEYWORD, A_PARSE_KEYWORD},          // SPACE
+					{S_RETURN, A_END_KEYWORD},                   // CR
+					{S_START, A_END_KEYWORD},                    // LF
+					{S_ERROR, A_EXIT, "unknown error"},          // BACKSLASH
+					{S_ERROR, A_EXIT, "comment must begin at start of line"}, // HASH
+
+					{S_KEYWORD, A_COUNT},                        // KEYWORD
+
+					{S_KEYWORD, A_COUNT},                        // EXPONENT
+					{S_KEYWORD, A_COUNT},                        // TWO
+
+					{S_ERROR, A_EXIT, "invalid char in keyword"}, // NUMBER
+					{S_ERROR, A_EXIT, "invalid char in keyword"}, // POINT
+					{S_ERROR, A_EXIT, "invalid char in keyword"}, // PLUS
+					{S_ERROR, A_EXIT, "invalid char in keyword"}, // MINUS
+					{S_ERROR, A_EXIT, "invalid char in keyword"}, // SLASH
 				},
 
 				/* AFTER KEYWORD */ {
-					{S_ERROR,       A_EXIT, "expect values after keyword"},           // NIL
-					{S_ERROR,       A_EXIT, "ctrl after keyword"},           // CTRL
-					{S_ERROR,       A_EXIT, "invalid char, expect number"},           // OTHER
-
-					{S_AFTER_KEYWORD, A_SKIP},         // SPACE
-					{S_ERROR,       A_EXIT, "expect values after keyword"},           // CR
-					{S_ERROR,       A_EXIT, "expect values after keyword"},           // LF
-					{S_ERROR,       A_EXIT, "unknown"},           // BACKSLASH // need wait LF
-					{S_ERROR,       A_EXIT, "comment must begin at start of line"},           // HASH
-
-					{S_ERROR,       A_EXIT, "expect number after keyword"},           // KEYWORD
-
-					{S_ERROR,       A_EXIT, "expect number after keyword"},           // EXPONENT
-					{S_INTEGER,     A_INTEGER},        // TWO
-
-					{S_INTEGER,     A_INTEGER},        // NUMBER
-					{S_DECIMAL,     A_SKIP},           // POINT (enter decimal mode)
-					{S_PLUS,        A_PLUS},           // PLUS
-					{S_MINUS,       A_MINUS},          // MINUS
-					{S_ERROR,       A_EXIT, "expect number after keyword"},           // SLASH
+					{S_ERROR, A_EXIT, "expect values after keyword"}, // NIL
+					{S_ERROR, A_EXIT, "ctrl after keyword"},     // CTRL
+					{S_ERROR, A_EXIT, "invalid char, expect number"}, // OTHER
+
+					{S_AFTER_KEYWORD, A_SKIP},                   // SPACE
+					{S_RETURN, A_EMIT_VALUES},                   // CR
+					{S_START, A_EMIT_VALUES},                    // LF
+					{S_ERROR, A_EXIT, "unknown"},                // BACKSLASH
+					{S_COMMENT, A_EMIT_VALUES},                  // HASH
+
+					{S_ERROR, A_EXIT, "expect number after keyword"}, // KEYWORD
+
+					{S_ERROR, A_EXIT, "expect number after keyword"}, // EXPONENT
+					{S_INTEGER, A_INTEGER},                      // TWO
+
+					{S_INTEGER, A_INTEGER},                      // NUMBER
+					{S_DECIMAL, A_SKIP},                         // POINT
+					{S_PLUS, A_PLUS},                            // PLUS
+					{S_MINUS, A_MINUS},                          // MINUS
+					{S_ERROR, A_EXIT, "expect number after keyword"}, // SLASH
 				},
 
 				/* BETWEEN INDEXES */ {
-					{S_END,         A_EXIT},           // NIL
-					{S_ERROR,       A_EXIT},           // CTRL
-					{S_ERROR,       A_EXIT},           // OTHER
-
-					{S_BETWEEN_INDEXES, A_SKIP},       // SPACE
-					{S_RETURN,      A_SKIP},           // CR
-					{S_START,       A_SKIP},           // LF
-					{S_ERROR,       A_EXIT},           // BACKSLASH // need wait LF
-					{S_ERROR,       A_EXIT},           // HASH
-
-					{S_ERROR,       A_EXIT},           // KEYWORD
-
-					{S_ERROR,       A_EXIT},           // EXPONENT
-					{S_INDEX,       A_INTEGER},        // TWO
-
-					{S_INDEX,       A_INTEGER},        // NUMBER
-					{S_ERROR,       A_EXIT},           // POINT (enter decimal mode)
-					{S_ERROR,       A_EXIT},           // PLUS
-					{S_ERROR,       A_EXIT},           // MINUS
-					{S_ERROR,       A_EXIT},           // SLASH
+					{S_END, A_EXIT},                             // NIL
+					{S_ERROR, A_EXIT, "expect index"},           // CTRL
+					{S_ERROR, A_EXIT, "expect index"},           // OTHER
+
+					{S_BETWEEN_INDEXES, A_SKIP},                 // SPACE
+					{S_RETURN, A_EMIT_FACE},                     // CR
+					{S_START, A_EMIT_FACE},                      // LF
+					{S_ERROR, A_EXIT, "expect index"},           // BACKSLASH
+					{S_COMMENT, A_EMIT_FACE},                    // HASH
+
+					{S_ERROR, A_EXIT, "expect index"},           // KEYWORD
+
+					{S_ERROR, A_EXIT, "expect index"},           // EXPONENT
+					{S_INDEX, A_INDEX_DIGIT},                    // TWO
+
+					{S_INDEX, A_INDEX_DIGIT},                    // NUMBER
+					{S_ERROR, A_EXIT, "expect index"},           // POINT
+					{S_ERROR, A_EXIT, "expect index"},           // PLUS
+					{S_INDEX_MINUS, A_INDEX_MINUS},              // MINUS
+					{S_ERROR, A_EXIT, "expect index"},           // SLASH
 				},
 
 				/* INDEX */ {
-					{S_END,         A_EXIT},           // NIL
-					{S_ERROR,       A_EXIT},           // CTRL
-					{S_ERROR,       A_EXIT},           // OTHER
-
-					{S_BETWEEN_INDEXES, A_SKIP},       // SPACE
-					{S_RETURN,      A_SKIP},           // CR
-					{S_START,       A_SKIP},           // LF
-					{S_ERROR,       A_EXIT},           // BACKSLASH // need wait LF
-					{S_ERROR,       A_EXIT},           // HASH
-
-					{S_ERROR,       A_EXIT},           // KEYWORD
-
-					{S_ERROR,       A_EXIT},           // EXPONENT
-					{S_INDEX,       A_INTEGER},        // TWO
-
-					{S_INDEX,       A_INTEGER},        // NUMBER
-					{S_ERROR,       A_EXIT},           // POINT (enter decimal mode)
-					{S_ERROR,       A_EXIT},           // PLUS
-					{S_ERROR,       A_EXIT},           // MINUS
-					{S_ERROR,       A_EXIT},           // SLASH
+					{S_END, A_EXIT},                             // NIL
+					{S_ERROR, A_EXIT, "invalid char in index"},  // CTRL
+					{S_ERROR, A_EXIT, "invalid char in index"},  // OTHER
+
+					{S_BETWEEN_INDEXES, A_INDEX_GROUP},          // SPACE
+					{S_RETURN, A_INDEX_FACE},                    // CR
+					{S_START, A_INDEX_FACE},                     // LF
+					{S_ERROR, A_EXIT, "invalid char in index"},  // BACKSLASH
+					{S_COMMENT, A_INDEX_FACE},                   // HASH
+
+					{S_ERROR, A_EXIT, "invalid char in index"},  // KEYWORD
+
+					{S_ERROR, A_EXIT, "invalid char in index"},  // EXPONENT
+					{S_INDEX, A_INDEX_DIGIT},                    // TWO
+
+					{S_INDEX, A_INDEX_DIGIT},                    // NUMBER
+					{S_ERROR, A_EXIT, "invalid char in index"},  // POINT
+					{S_ERROR, A_EXIT, "invalid char in index"},  // PLUS
+					{S_ERROR, A_EXIT, "invalid char in index"},  // MINUS
+					{S_INDEX_SLASH, A_INDEX_NEXT},               // SLASH
 				},
 
 				/* PLUS */ {
@@ -1139,49 +2120,187 @@ namespace engine {
 
 
 				/* INTEGER */ {
-					{S_END,         A_EXIT},           // NIL // maybe check number of float parsed
-					{S_ERROR,       A_EXIT},           // CTRL
-					{S_ERROR,       A_EXIT},           // OTHER
+					{S_END, A_EXIT},                             // NIL
+					{S_ERROR, A_EXIT, "invalid char in number"}, // CTRL
+					{S_ERROR, A_EXIT, "invalid char in number"}, // OTHER
+
+					{S_AFTER_KEYWORD, A_PARSE_FLOAT},            // SPACE
+					{S_RETURN, A_FLOAT_EMIT},                    // CR
+					{S_START, A_FLOAT_EMIT},                     // LF
+					{S_ERROR, A_EXIT, "invalid char in number"}, // BACKSLASH
+					{S_COMMENT, A_FLOAT_EMIT},                   // HASH
+
+					{S_ERROR, A_EXIT, "invalid char in number"}, // KEYWORD
+
+					{S_EXPONENT, A_SKIP},                        // EXPONENT
+					{S_INTEGER, A_INTEGER},                      // TWO
+
+					{S_INTEGER, A_INTEGER},                      // NUMBER
+					{S_DECIMAL, A_SKIP},                         // POINT
+					{S_ERROR, A_EXIT, "invalid char in number"}, // PLUS
+					{S_ERROR, A_EXIT, "invalid char in number"}, // MINUS
+					{S_ERROR, A_EXIT, "invalid char in number"}, // SLASH
+				},
 
-					{S_AFTER_KEYWORD, A_PARSE_FLOAT},    // SPACE // need create intermediar state between number
-					{S_RETURN,      A_PARSE_FLOAT},    // CR
-					{S_START,       A_PARSE_FLOAT},    // LF
-					{S_ERROR,       A_EXIT},           // BACKSLASH // need wait LF
-					{S_ERROR,       A_EXIT},           // HASH // do you validate comment at end of line ?
+				/* DECIMAL */ {
+					{S_END, A_EXIT},                             // NIL
+					{S_ERROR, A_EXIT, "invalid char in number"}, // CTRL
+					{S_ERROR, A_EXIT, "invalid char in number"}, // OTHER
+
+					{S_AFTER_KEYWORD, A_PARSE_FLOAT},            // SPACE
+					{S_RETURN, A_FLOAT_EMIT},                    // CR
+					{S_START, A_FLOAT_EMIT},                     // LF
+					{S_ERROR, A_EXIT, "invalid char in number"}, // BACKSLASH
+					{S_COMMENT, A_FLOAT_EMIT},                   // HASH
+
+					{S_ERROR, A_EXIT, "invalid char in number"}, // KEYWORD
+
+					{S_EXPONENT, A_SKIP},                        // EXPONENT
+					{S_DECIMAL, A_DECIMAL},                      // TWO
+
+					{S_DECIMAL, A_DECIMAL},                      // NUMBER
+					{S_ERROR, A_EXIT, "invalid char in number"}, // POINT
+					{S_ERROR, A_EXIT, "invalid char in number"}, // PLUS
+					{S_ERROR, A_EXIT, "invalid char in number"}, // MINUS
+					{S_ERROR, A_EXIT, "invalid char in number"}, // SLASH
+				},
 
-					{S_ERROR,       A_EXIT},           // KEYWORD
+				/* EXPONENT */ {
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // NIL
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // CTRL
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // OTHER
 
-					{S_ERROR,       A_EXIT},           // EXPONENT // not implemented yet
-					{S_INTEGER,     A_INTEGER},        // TWO
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // SPACE
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // CR
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // LF
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // BACKSLASH
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // HASH
 
-					{S_INTEGER,     A_INTEGER},        // NUMBER
-					{S_DECIMAL,     A_SKIP},           // POINT (enter decimal mode)
-					{S_ERROR,       A_EXIT},           // PLUS
-					{S_ERROR,       A_EXIT},           // MINUS
-					{S_ERROR,       A_EXIT},           // SLASH
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // KEYWORD
+
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // EXPONENT
+					{S_EXPONENT_DIGITS, A_EXPONENT_DIGIT},       // TWO
+
+					{S_EXPONENT_DIGITS, A_EXPONENT_DIGIT},       // NUMBER
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // POINT
+					{S_EXPONENT_SIGN, A_SKIP},                   // PLUS
+					{S_EXPONENT_SIGN, A_EXPONENT_MINUS},         // MINUS
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // SLASH
 				},
 
-				/* DECIMAL */ {
-					{S_END,         A_EXIT},           // NIL // maybe check number of float parsed
-					{S_ERROR,       A_EXIT},           // CTRL
-					{S_ERROR,       A_EXIT},           // OTHER
+				/* EXPONENT SIGN */ {
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // NIL
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // CTRL
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // OTHER
 
-					{S_AFTER_KEYWORD, A_PARSE_FLOAT},    // SPACE // need create intermediar state between number
-					{S_RETURN,      A_PARSE_FLOAT},    // CR
-					{S_START,       A_PARSE_FLOAT},    // LF
-					{S_ERROR,       A_EXIT},           // BACKSLASH // need wait LF
-					{S_ERROR,       A_EXIT},           // HASH // do you validate comment at end of line ?
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // SPACE
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // CR
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // LF
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // BACKSLASH
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // HASH
 
-					{S_ERROR,       A_EXIT},           // KEYWORD
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // KEYWORD
 
-					{S_ERROR,       A_EXIT},           // EXPONENT // not implemented yet
-					{S_DECIMAL,     A_DECIMAL},        // TWO
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // EXPONENT
+					{S_EXPONENT_DIGITS, A_EXPONENT_DIGIT},       // TWO
 
-					{S_DECIMAL,     A_DECIMAL},        // NUMBER
-					{S_ERROR,       A_EXIT},           // POINT (no second point)
-					{S_ERROR,       A_EXIT},           // PLUS
-					{S_ERROR,       A_EXIT},           // MINUS
-					{S_ERROR,       A_EXIT},           // SLASH
+					{S_EXPONENT_DIGITS, A_EXPONENT_DIGIT},       // NUMBER
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // POINT
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // PLUS
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // MINUS
+					{S_ERROR, A_EXIT, "expect exponent digits"}, // SLASH
+				},
+
+				/* EXPONENT DIGITS */ {
+					{S_END, A_EXIT},                             // NIL
+					{S_ERROR, A_EXIT, "invalid char in exponent"}, // CTRL
+					{S_ERROR, A_EXIT, "invalid char in exponent"}, // OTHER
+
+					{S_AFTER_KEYWORD, A_PARSE_FLOAT},            // SPACE
+					{S_RETURN, A_FLOAT_EMIT},                    // CR
+					{S_START, A_FLOAT_EMIT},                     // LF
+					{S_ERROR, A_EXIT, "invalid char in exponent"}, // BACKSLASH
+					{S_COMMENT, A_FLOAT_EMIT},                   // HASH
+
+					{S_ERROR, A_EXIT, "invalid char in exponent"}, // KEYWORD
+
+					{S_ERROR, A_EXIT, "invalid char in exponent"}, // EXPONENT
+					{S_EXPONENT_DIGITS, A_EXPONENT_DIGIT},       // TWO
+
+					{S_EXPONENT_DIGITS, A_EXPONENT_DIGIT},       // NUMBER
+					{S_ERROR, A_EXIT, "invalid char in exponent"}, // POINT
+					{S_ERROR, A_EXIT, "invalid char in exponent"}, // PLUS
+					{S_ERROR, A_EXIT, "invalid char in exponent"}, // MINUS
+					{S_ERROR, A_EXIT, "invalid char in exponent"}, // SLASH
+				},
+
+				/* INDEX MINUS */ {
+					{S_ERROR, A_EXIT, "expect index after sign"}, // NIL
+					{S_ERROR, A_EXIT, "expect index after sign"}, // CTRL
+					{S_ERROR, A_EXIT, "expect index after sign"}, // OTHER
+
+					{S_ERROR, A_EXIT, "expect index after sign"}, // SPACE
+					{S_ERROR, A_EXIT, "expect index after sign"}, // CR
+					{S_ERROR, A_EXIT, "expect index after sign"}, // LF
+					{S_ERROR, A_EXIT, "expect index after sign"}, // BACKSLASH
+					{S_ERROR, A_EXIT, "expect index after sign"}, // HASH
+
+					{S_ERROR, A_EXIT, "expect index after sign"}, // KEYWORD
+
+					{S_ERROR, A_EXIT, "expect index after sign"}, // EXPONENT
+					{S_INDEX, A_INDEX_DIGIT},                    // TWO
+
+					{S_INDEX, A_INDEX_DIGIT},                    // NUMBER
+					{S_ERROR, A_EXIT, "expect index after sign"}, // POINT
+					{S_ERROR, A_EXIT, "expect index after sign"}, // PLUS
+					{S_ERROR, A_EXIT, "expect index after sign"}, // MINUS
+					{S_ERROR, A_EXIT, "expect index after sign"}, // SLASH
+				},
+
+				/* INDEX SLASH */ {
+					{S_ERROR, A_EXIT, "expect index after slash"}, // NIL
+					{S_ERROR, A_EXIT, "expect index after slash"}, // CTRL
+					{S_ERROR, A_EXIT, "expect index after slash"}, // OTHER
+
+					{S_ERROR, A_EXIT, "expect index after slash"}, // SPACE
+					{S_ERROR, A_EXIT, "expect index after slash"}, // CR
+					{S_ERROR, A_EXIT, "expect index after slash"}, // LF
+					{S_ERROR, A_EXIT, "expect index after slash"}, // BACKSLASH
+					{S_ERROR, A_EXIT, "expect index after slash"}, // HASH
+
+					{S_ERROR, A_EXIT, "expect index after slash"}, // KEYWORD
+
+					{S_ERROR, A_EXIT, "expect index after slash"}, // EXPONENT
+					{S_INDEX, A_INDEX_DIGIT},                    // TWO
+
+					{S_INDEX, A_INDEX_DIGIT},                    // NUMBER
+					{S_ERROR, A_EXIT, "expect index after slash"}, // POINT
+					{S_ERROR, A_EXIT, "expect index after slash"}, // PLUS
+					{S_INDEX_MINUS, A_INDEX_MINUS},              // MINUS
+					{S_INDEX_SLASH, A_INDEX_NEXT},               // SLASH
+				},
+
+				/* NAME */ {
+					{S_END, A_EXIT},                             // NIL
+					{S_ERROR, A_EXIT, "ctrl in name"},           // CTRL
+					{S_NAME, A_NAME_CHAR},                       // OTHER
+
+					{S_NAME, A_NAME_CHAR},                       // SPACE
+					{S_RETURN, A_EMIT_NAME},                     // CR
+					{S_START, A_EMIT_NAME},                      // LF
+					{S_NAME, A_NAME_CHAR},                       // BACKSLASH
+					{S_COMMENT, A_EMIT_NAME},                    // HASH
+
+					{S_NAME, A_NAME_CHAR},                       // KEYWORD
+
+					{S_NAME, A_NAME_CHAR},                       // EXPONENT
+					{S_NAME, A_NAME_CHAR},                       // TWO
+
+					{S_NAME, A_NAME_CHAR},                       // NUMBER
+					{S_NAME, A_NAME_CHAR},                       // POINT
+					{S_NAME, A_NAME_CHAR},                       // PLUS
+					{S_NAME, A_NAME_CHAR},                       // MINUS
+					{S_NAME, A_NAME_CHAR},                       // SLASH
 				},
 			};
 
@@ -1254,6 +2373,229 @@ namespace engine {
 
 
 
+			// -- C U R S O R -------------------------------------------------
+
+			/* in-place tokenizer over a mapped range,
+			   no allocation, never reads past end */
+
+			class cursor final {
+
+				public:
+
+					// -- public lifecycle ------------------------------------
+
+					/* deleted default constructor */
+					cursor(void) = delete;
+
+					/* range constructor (file, start of the file the range is part of) */
+					inline cursor(const char* file, const char* begin, const char* end) noexcept
+					: _file{file}, _it{begin}, _end{end} {}
+
+					/* non-assignable class */
+					non_assignable(cursor);
+
+					/* destructor */
+					inline ~cursor(void) noexcept = default;
+
+
+					// -- public accessors ------------------------------------
+
+					/* end of range */
+					inline auto eof(void) const noexcept -> bool {
+						return _it == _end;
+					}
+
+					/* end of line (trailing blanks and comment allowed) */
+					inline auto eol(void) noexcept -> bool {
+						self::skip_blanks();
+						return _it == _end || *_it == '\n' || *_it == '\r' || *_it == '#';
+					}
+
+					/* report error (line counted from the start of the file, only on failure) */
+					inline auto error(void) const -> bool {
+						std::cout << "parsing error. (line " << engine::scanner::count_lines(_file, _it) + 1U << ")" << std::endl;
+						return false;
+					}
+
+
+					// -- public modifiers ------------------------------------
+
+					/* skip blanks */
+					inline auto skip_blanks(void) noexcept -> void {
+						while (_it != _end && (*_it == ' ' || *_it == '\t'))
+							++_it;
+					}
+
+					/* skip to next line */
+					inline auto next_line(void) noexcept -> void {
+						// long runs (comments) are scanned in bulk
+						if (_it != _end && *_it != '\n')
+							_it = engine::scanner::find_newline(_it, _end);
+						if (_it == _end) return;
+						++_it;
+					}
+
+					/* next token */
+					inline auto token(void) noexcept -> std::string_view {
+						self::skip_blanks();
+						const char* begin = _it;
+						while (_it != _end && not self::is_delimiter(*_it))
+							++_it;
+						return std::string_view{begin, static_cast<size_type>(_it - begin)};
+					}
+
+					/* consume char */
+					inline auto consume(const char c) noexcept -> bool {
+						if (_it == _end || *_it != c)
+							return false;
+						++_it;
+						return true;
+					}
+
+					/* index, relative (negative) indices resolve against count
+					   and are stored as a chunk-local offset until rebased */
+					inline auto index(std::uint32_t& value, const size_type count, bool& relative) noexcept -> bool {
+						self::skip_blanks();
+						return self::index_at(value, count, relative);
+					}
+
+					/* index at current position */
+					inline auto index_at(std::uint32_t& value, const size_type count, bool& relative) noexcept -> bool {
+
+						const bool negative = (_it != _end && *_it == '-');
+						if (negative) ++_it;
+
+						const char* begin = _it;
+						std::uint64_t number = 0U;
+						while (_it != _end && self::is_digit(*_it)) {
+							if (number < data::LOCAL)
+								number = (number * 10U) + static_cast<std::uint64_t>(*_it ^ '0');
+							++_it;
+						}
+
+						if (_it == begin || number == 0U || number >= data::LOCAL)
+							return false;
+
+						if (not negative) {
+							value = static_cast<std::uint32_t>(number);
+							return true;
+						}
+
+						// may reach into previous chunks, kept as 31-bit signed offset
+						const auto local = static_cast<std::int64_t>(count) - static_cast<std::int64_t>(number) + 1;
+
+						value    = (static_cast<std::uint32_t>(local) & ~data::LOCAL) | data::LOCAL;
+						relative = true;
+						return true;
+					}
+
+					/* rest of line, trimmed, comment excluded */
+					inline auto rest(void) noexcept -> std::string_view {
+						self::skip_blanks();
+						const char* begin = _it;
+						while (_it != _end && *_it != '\n' && *_it != '\r' && *_it != '#')
+							++_it;
+						const char* last = _it;
+						while (last != begin && (*(last - 1) == ' ' || *(last - 1) == '\t'))
+							--last;
+						return std::string_view{begin, static_cast<size_type>(last - begin)};
+					}
+
+					/* face group (v, v/vt, v//vn, v/vt/vn), absent slots are 0 */
+					inline auto group(std::uint32_t (&corner)[3], data& data) noexcept -> bool {
+
+						corner[1] = corner[2] = 0U;
+
+						if (not self::index(corner[0], data._positions.size(), data._relative))
+							return false;
+
+						if (not self::consume('/'))
+							return self::is_blank();
+
+						if (_it == _end || *_it != '/')
+							if (not self::index_at(corner[1], data._texcoords.size(), data._relative))
+								return false;
+
+						if (not self::consume('/'))
+							return self::is_blank();
+
+						return self::index_at(corner[2], data._normals.size(), data._relative)
+							&& self::is_blank();
+					}
+
+					/* up to max numbers to the end of line, discarded */
+					inline auto trailing(size_type max) noexcept -> bool {
+						float ignored;
+						while (not self::eol()) {
+							if (max == 0U || not self::number(ignored))
+								return false;
+							--max;
+						}
+						return true;
+					}
+
+					/* floating point number (exactly rounded) */
+					inline auto number(float& value) noexcept -> bool {
+
+						self::skip_blanks();
+
+						const char* it = _it;
+
+						if (not engine::float_parser::parse(it, _end, value))
+							return false;
+
+						if (it != _end && not self::is_delimiter(*it))
+							return false;
+
+						_it = it;
+						return true;
+					}
+
+
+				private:
+
+					// -- private types ---------------------------------------
+
+					/* self type */
+					using self = engine::wavefront::cursor;
+
+
+					// -- private methods -------------------------------------
+
+					/* group ends on blank, end of line or comment */
+					inline auto is_blank(void) const noexcept -> bool {
+						return _it == _end || *_it == ' ' || *_it == '\t'
+							|| *_it == '\n' || *_it == '\r' || *_it == '#';
+					}
+
+
+					// -- private static methods ------------------------------
+
+					/* is digit */
+					static inline auto is_digit(const char c) noexcept -> bool {
+						return static_cast<unsigned char>(c ^ '0') < 10U;
+					}
+
+					/* is delimiter */
+					static inline auto is_delimiter(const char c) noexcept -> bool {
+						return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '/' || c == '#';
+					}
+
+
+					// -- private members -------------------------------------
+
+					/* start of the file */
+					const char* const _file;
+
+					/* iterator */
+					const char* _it;
+
+					/* end */
+					const char* const _end;
+			};
+
+
+
 			// -- P E R F E C T  H A S H  T A B L E ---------------------------
 
 			/* keyword map */
@@ -1311,7 +2653,7 @@ namespace engine {
 						{"end",        K_NOT_IMPLEMENTED},
 						{"surf",       K_NOT_IMPLEMENTED},
 						{"bevel",      K_NOT_IMPLEMENTED},
-						{"usemtl",     K_NOT_IMPLEMENTED},
+						{"usemtl",     K_USEMTL}, // material name
 						{"vn",         K_VN}, // normal
 						{},
 						{"scrv",       K_NOT_IMPLEMENTED},
@@ -1326,7 +2668,7 @@ namespace engine {
 						{},
 						{"trim",       K_NOT_IMPLEMENTED},
 						{"shadow_obj", K_NOT_IMPLEMENTED},
-						{"o",          K_NOT_IMPLEMENTED},
+						{"o",          K_O},      // object name
 						{"vp",         K_NOT_IMPLEMENTED},
 						{},
 						{"trace_obj",  K_NOT_IMPLEMENTED},
@@ -1335,12 +2677,12 @@ namespace engine {
 						{}, {},
 						{"parm",       K_NOT_IMPLEMENTED},
 						{},
-						{"mtllib",     K_NOT_IMPLEMENTED},
+						{"mtllib",     K_MTLLIB}, // material library
 						{},
 						{"con",        K_NOT_IMPLEMENTED},
 						{"bmat",       K_NOT_IMPLEMENTED},
 						{},
-						{"g",          K_NOT_IMPLEMENTED},
+						{"g",          K_G},      // group name
 						{}, {},
 						{"hole",       K_NOT_IMPLEMENTED},
 						{},
@@ -1386,6 +2728,22 @@ namespace engine {
 					/* get keyword type */
 					//static auto type(const char*, const size_type) noexcept -> keyword_type;
 					inline auto type(void) noexcept -> keyword_type {
+						const keyword_type type = lookup();
+						// reset index
+						_i = 0;
+						return type;
+					}
+
+					/* clear */
+					inline constexpr auto clear(void) noexcept -> void {
+						_i = 0;
+					}
+
+
+				private:
+
+					/* lookup buffered keyword */
+					inline auto lookup(void) const noexcept -> keyword_type {
 
 						if (_i > MAX_LENGTH) //|| len < MIN_LENGTH)
 							return K_INVALID;
@@ -1410,8 +2768,6 @@ namespace engine {
 								return K_INVALID;
 							++i;
 						}
-						// reset index
-						_i = 0;
 						return entry._key[i] == '\0' ? entry._type : K_INVALID;
 					}
 
@@ -1439,21 +2795,69 @@ namespace engine {
 			/* keyword map */
 			keyword_map _kmap;
 
-			/* integral */
-			xns::umax _integral;
+			/* mantissa (significant digits) */
+			xns::umax _mantissa;
 
-			/* decimal */
-			xns::umax _decimal;
+			/* decimal exponent */
+			std::int64_t _exponent;
 
 			/* sign */
 			int _sign;
 
-			/* mesh */
-			data* _data;
+			/* scientific exponent */
+			std::int64_t _scientific;
+
+			/* scientific exponent sign */
+			std::int64_t _escientific;
+
+			/* element sink */
+			const emitter* _emitter;
 
 			/* data type */
 			data::data_kind _dtype;
 
+			/* values of the current line */
+			float _values[MAX_VALUES];
+
+			/* value count */
+			size_type _count;
+
+			/* face index accumulator */
+			std::uint64_t _index;
+
+			/* face index sign */
+			bool _isign;
+
+			/* face index slot (v, vt, vn) */
+			size_type _slot;
+
+			/* fan window of the current face */
+			std::uint32_t _corners[MAX_CORNERS][3];
+
+			/* corner count */
+			size_type _ccount;
+
+			/* elements emitted so far (v, vt, vn), for relative indexes */
+			size_type _counts[3];
+
+			/* lines of previous buffers */
+			size_type _lines;
+
+			/* failing byte in buffer */
+			size_type _at;
+
+			/* statement argument */
+			char _name[MAX_NAME];
+
+			/* argument length */
+			size_type _nlen;
+
+			/* argument statement */
+			keyword_type _nkind;
+
+			/* action error message */
+			const char* _msg;
+
 	};
 }
 
@@ -1556,47 +2960,31 @@ namespace engine {
 
 
 
+/* parse decimal at str (exactly rounded), advances str on success */
 template <typename T>
 inline auto to_decimal(char*& str, T& num) -> int {
 
 	static_assert(xns::is_floating<T>, "T must be a floating point type");
-	num  = 0.0;
-	double fraction = 0.0;
-
-	double sign = +1;
-	int exponent = 0;
-
-	if (*str == '-') {
-		sign = -1;
-		++str; }
-	else if (*str == '+')
-		++str;
 
-	if ((*str ^ '0') >= 10)
-		return -1;
-
-	while ((*str ^ '0') < 10) {
-		num *= 10.0;
-		num += (*str ^ '0');
-		++str;
-	}
-	if (*str == '.') {
-		++str;
-		while ((*str ^ '0') < 10) {
-			num *= 10.0;
-			num += (*str ^ '0');
-			--exponent;
-			++str;
-		}
+	// wider types, libc
+	if constexpr (sizeof(T) != sizeof(float)) {
+		char* end = nullptr;
+		const T value = static_cast<T>(std::strtold(str, &end));
+		if (end == str)
+			return -1;
+		num = value;
+		str = end;
+		return 0;
 	}
-	while (exponent < 0) {
-		num *= 0.1;
-		++exponent;
+	else {
+		const char* it = str;
+		float value    = 0.0f;
+		if (not engine::float_parser::parse(it, str + std::strlen(str), value))
+			return -1;
+		num = value;
+		str += (it - str);
+		return 0;
 	}
-
-	num *= sign;
-
-	return 0;
 }
 
 
@@ -0,0 +1,290 @@
+#ifndef ENGINE_WELDER_HPP
+#define ENGINE_WELDER_HPP
+
+#include "vertex.hpp"
+#include "parallel.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+
+// -- E N G I N E  N A M E S P A C E ------------------------------------------
+
+namespace engine {
+
+
+	// -- W E L D E R ---------------------------------------------------------
+
+	/* merges identical (v, vt, vn) face corners into unique vertices
+
+	   one open-addressing table of corner ids is allocated up front and
+	   shared by all threads, slots are filled with compare-and-swap and
+	   always keep the smallest corner id of a key, so the vertex order
+	   (first occurrence) does not depend on thread scheduling */
+
+	class welder final {
+
+
+		public:
+
+			// -- public types ------------------------------------------------
+
+			/* self type */
+			using self = engine::welder;
+
+			/* size type */
+			using size_type = std::size_t;
+
+			/* index type */
+			using index_type = std::uint32_t;
+
+
+			// -- public constants --------------------------------------------
+
+			/* corners per thread before going parallel */
+			enum : size_type { PARALLEL_THRESHOLD = 256U * 1024U };
+
+
+			// -- public lifecycle --------------------------------------------
+
+			/* non-instanciable class */
+			welder(void) = delete;
+
+
+			// -- public static methods ---------------------------------------
+
+			/* weld faces into vertex / index buffers (0 threads: automatic),
+			   D exposes _positions, _texcoords, _normals and _faces */
+			template <typename D>
+			static auto weld(const D& data,
+							 engine::vpackage& package,
+							 size_type threads = 0U) -> bool {
+
+				const auto& faces = data._faces;
+				const size_type corners = faces.size() * 3U;
+
+				if (corners == 0U)
+					return true;
+
+				// slot indexes must fit in index_type
+				if (corners > static_cast<size_type>(EMPTY >> 1U)) {
+					std::cout << "welder: error, too many corners" << std::endl;
+					return false;
+				}
+
+				if (threads == 0U) {
+					threads = (corners / PARALLEL_THRESHOLD) + 1U;
+					threads = threads < engine::parallel::concurrency() ? threads : engine::parallel::concurrency();
+				}
+
+				// table at most half full
+				size_type capacity = 1U;
+				while (capacity < corners * 2U)
+					capacity <<= 1U;
+				const size_type mask = capacity - 1U;
+
+				std::vector<std::atomic<index_type>> table(capacity);
+				for (auto& slot : table)
+					slot.store(EMPTY, std::memory_order_relaxed);
+
+				// slot of each corner when shared, then its representative
+				std::vector<index_type> representative(corners);
+				const bool shared = threads > 1U;
+
+				// -- insert corners, smallest corner id wins -----------------
+
+				engine::parallel::slices(corners, threads, [&](const size_type, const size_type begin, const size_type end) {
+
+					for (size_type c = begin; c < end; ++c) {
+
+						const key k = self::corner(faces, c);
+						size_type h = self::hash(k) & mask;
+						index_type current = table[h].load(std::memory_order_acquire);
+
+						while (true) {
+
+							if (current == EMPTY) {
+								if (table[h].compare_exchange_weak(current, static_cast<index_type>(c), std::memory_order_acq_rel))
+									break;
+								continue;
+							}
+
+							if (self::corner(faces, current) != k) {
+								h = (h + 1U) & mask;
+								current = table[h].load(std::memory_order_acquire);
+								continue;
+							}
+
+							if (current < c)
+								break;
+
+							if (table[h].compare_exchange_weak(current, static_cast<index_type>(c), std::memory_order_acq_rel))
+								break;
+						}
+
+						// alone, the first corner seen is already the smallest
+						const index_type found = (current == EMPTY || current > c) ? static_cast<index_type>(c) : current;
+						representative[c] = shared ? static_cast<index_type>(h) : found;
+					}
+				});
+
+				// -- resolve representative, count unique per slice ----------
+
+				const size_type slices = threads < corners ? threads : corners;
+				std::vector<size_type> counts(slices + 1U, 0U);
+
+				engine::parallel::slices(corners, slices, [&](const size_type slice, const size_type begin, const size_type end) {
+
+					size_type count = 0U;
+
+					for (size_type c = begin; c < end; ++c) {
+						if (shared)
+							representative[c] = table[representative[c]].load(std::memory_order_relaxed);
+						count += (representative[c] == c);
+					}
+					counts[slice + 1U] = count;
+				});
+
+				// exclusive scan of unique counts
+				for (size_type i = 0U; i < slices; ++i)
+					counts[i + 1U] += counts[i];
+
+				const size_type unique = counts[slices];
+
+				// -- number vertices in first occurrence order ---------------
+
+				std::vector<index_type> ids(corners);
+
+				engine::parallel::slices(corners, slices, [&](const size_type slice, const size_type begin, const size_type end) {
+					size_type id = counts[slice];
+					for (size_type c = begin; c < end; ++c)
+						if (representative[c] == c)
+							ids[c] = static_cast<index_type>(id++);
+				});
+
+				// -- emit vertex and index streams ---------------------------
+
+				auto& vertices = package.first;
+				auto& indexes  = package.second;
+
+				const size_type vbase = vertices.size();
+				const size_type ibase = indexes.size();
+
+				vertices.resize(vbase + unique);
+				 indexes.resize(ibase + corners);
+
+				std::atomic<bool> valid{true};
+
+				engine::parallel::slices(corners, slices, [&](const size_type, const size_type begin, const size_type end) {
+
+					for (size_type c = begin; c < end; ++c) {
+
+						const index_type r = representative[c];
+						indexes[ibase + c] = static_cast<index_type>(vbase + ids[r]);
+
+						if (r != c)
+							continue;
+
+						if (not self::build(data, self::corner(faces, c), vertices[vbase + ids[c]]))
+							valid.store(false, std::memory_order_relaxed);
+					}
+				});
+
+				if (not valid.load()) {
+					std::cout << "welder: error, face index out of range" << std::endl;
+					vertices.resize(vbase);
+					 indexes.resize(ibase);
+					return false;
+				}
+
+				return true;
+			}
+
+
+			/* narrow indexes to 16 bits (caller checks vertex count) */
+			static auto narrow(const engine::indexes& indexes) -> std::vector<std::uint16_t> {
+				std::vector<std::uint16_t> narrowed(indexes.size());
+				for (size_type i = 0U; i < indexes.size(); ++i)
+					narrowed[i] = static_cast<std::uint16_t>(indexes[i]);
+				return narrowed;
+			}
+
+
+		private:
+
+			// -- private constants -------------------------------------------
+
+			/* empty slot */
+			static constexpr index_type EMPTY = 0xffffffffU;
+
+
+			// -- K E Y -------------------------------------------------------
+
+			struct key final {
+
+				/* position, texcoord, normal (1-based, 0 when absent) */
+				index_type v, t, n;
+
+				/* equality */
+				inline auto operator==(const key& other) const noexcept -> bool {
+					return v == other.v && t == other.t && n == other.n;
+				}
+
+				/* inequality */
+				inline auto operator!=(const key& other) const noexcept -> bool {
+					return not operator==(other);
+				}
+			};
+
+
+			// -- private static methods --------------------------------------
+
+			/* corner key */
+			template <typename F>
+			static inline auto corner(const F& faces, const size_type c) noexcept -> key {
+				const auto& f = faces[c / 3U];
+				switch (c % 3U) {
+					case 0U:  return key{f.v1, f.t1, f.n1};
+					case 1U:  return key{f.v2, f.t2, f.n2};
+					default:  return key{f.v3, f.t3, f.n3};
+				}
+			}
+
+			/* hash (murmur3 finalizer over packed key) */
+			static inline auto hash(const key& k) noexcept -> size_type {
+				std::uint64_t h = (static_cast<std::uint64_t>(k.v) << 32) ^ (static_cast<std::uint64_t>(k.t) << 16) ^ k.n;
+				h ^= static_cast<std::uint64_t>(k.n) << 40;
+				h ^= h >> 33;
+				h *= 0xff51afd7ed558ccdULL;
+				h ^= h >> 33;
+				h *= 0xc4ceb9fe1a85ec53ULL;
+				h ^= h >> 33;
+				return static_cast<size_type>(h);
+			}
+
+			/* build vertex from key */
+			template <typename D>
+			static inline auto build(const D& data, const key& k, engine::vertex& vertex) noexcept -> bool {
+
+				if (k.v == 0U || k.v > data._positions.size()
+				 || k.t > data._texcoords.size()
+				 || k.n > data._normals.size())
+					return false;
+
+				vertex.position(data._positions[k.v - 1U]);
+
+				if (k.n != 0U)
+					vertex.normal(data._normals[k.n - 1U]);
+				if (k.t != 0U)
+					vertex.texture(data._texcoords[k.t - 1U]);
+
+				return true;
+			}
+
+	};
+
+}
+
+#endif // ENGINE_WELDER_HPP
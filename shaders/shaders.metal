@@ -47,6 +47,54 @@ auto vertex vertex_main(const vertex_in           vertice    [[ stage_in  ]],
 }
 
 
+struct compact_in {
+	metal::float4 position [[ attribute(0) ]];
+	metal::float2 normal   [[ attribute(1) ]];
+	metal::float2 texcoord [[ attribute(2) ]];
+};
+
+struct dequantize {
+	metal::float4 scale;
+	metal::float4 offset;
+};
+
+/* octahedral normal decode */
+static auto oct_decode(const float2 e) -> float3 {
+	float3 n = float3(e, 1.0 - metal::abs(e.x) - metal::abs(e.y));
+	const float t = metal::max(-n.z, 0.0);
+	n.xy -= metal::copysign(float2(t), n.xy);
+	return metal::normalize(n);
+}
+
+/* vertex shader (compact vertex, same outputs as vertex_main) */
+auto vertex vertex_compact(const compact_in          vertice    [[ stage_in  ]],
+						   constant metal::float4x4& projection [[ buffer(1) ]],
+						   constant metal::float4x4& view       [[ buffer(2) ]],
+						   constant metal::float4x4& model      [[ buffer(3) ]],
+						   constant metal::float3&   cam_pos    [[ buffer(4) ]],
+						   constant dequantize&      quant      [[ buffer(5) ]]) -> vertex_out {
+
+	const float3 position = quant.offset.xyz + vertice.position.xyz * quant.scale.xyz;
+	const float3 normal   = oct_decode(vertice.normal);
+
+	const float4 model_position = model * metal::float4(position, 1.0);
+	const float4 view_position = view * model_position;
+
+	const float3 view_direction = metal::normalize(cam_pos - model_position.xyz);
+
+	const float3 normal_surface = (model * metal::float4(normal, 0.0)).xyz;
+
+	return vertex_out{
+		projection * view_position,
+		model_position.xyz,
+		view_position.xyz,
+		view_direction,
+		normal_surface,
+		metal::distance(model_position.xyz, cam_pos)
+	};
+}
+
+
 /* fragment shader */
 //auto fragment fragment_main(const vertex_out frag [[stage_in]],
 //							constant unsigned int& iteration [[ buffer(1) ]]) -> float4 {
@@ -3,6 +3,7 @@
 
 #include "vertex.hpp"
 #include "mesh.hpp"
+#include "mesh_library.hpp"
 
 #include "Metal/Metal.hpp"
 
@@ -22,6 +23,9 @@ auto engine::renderer::draw(const mtl::view& view) -> void {
 
 	engine::time::update();
 
+	// swap in meshes finished by the asset loader
+	engine::mesh_library::poll();
+
 
 	auto command    = mtl::command_buffer{_queue};
 	auto descriptor = mtl::render_pass_descriptor{view};
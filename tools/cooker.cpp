@@ -0,0 +1,103 @@
+#include "asset_cooker.hpp"
+
+#include <sys/stat.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+// -- asset cooker ------------------------------------------------------------
+
+/* cooks every obj file under the given directories (or the given files)
+   into the .cooked file next to it, across all cores unless -j says
+   otherwise; sources whose cooked file holds the key of their bytes and
+   of the cook settings are skipped, -f cooks them anyway; exits with a
+   failure when a source does not cook
+   usage: cooker [-j threads] [-f] [-q] <directory | file.obj>... */
+
+
+/* print usage and fail */
+static auto usage(void) -> int {
+	std::cerr << "usage: cooker [-j threads] [-f] [-q] <directory | file.obj>..." << std::endl;
+	return EXIT_FAILURE;
+}
+
+
+int main(int ac, char** av) {
+
+	std::size_t threads = 0U;
+	bool force = false, quiet = false;
+	std::vector<std::string> paths;
+
+	try {
+		for (int i = 1; i < ac; ++i) {
+
+			if (std::strcmp(av[i], "-j") == 0 && i + 1 < ac)
+				threads = std::strtoull(av[++i], nullptr, 10);
+			else if (std::strcmp(av[i], "-f") == 0)
+				force = true;
+			else if (std::strcmp(av[i], "-q") == 0)
+				quiet = true;
+			else if (av[i][0] == '-')
+				return usage();
+			else {
+				struct ::stat st{};
+				if (::stat(av[i], &st) == -1)
+					throw std::runtime_error{std::string{"cooker: can't stat "} + av[i]};
+
+				if (S_ISDIR(st.st_mode))
+					engine::asset_cooker::sources(av[i], paths);
+				else
+					paths.emplace_back(av[i]);
+			}
+		}
+
+		if (paths.empty())
+			return usage();
+
+		const auto start = std::chrono::steady_clock::now();
+		const auto results = engine::asset_cooker::cook(paths, engine::asset_cooker::settings{}, threads, force);
+		const auto end = std::chrono::steady_clock::now();
+
+		std::size_t cooked = 0U, skipped = 0U, failed = 0U, bytes = 0U;
+
+		for (const auto& r : results) {
+
+			switch (r.status) {
+				case engine::asset_cooker::COOKED:
+					++cooked;
+					bytes += r.bytes;
+					if (not quiet)
+						std::printf("  cooked  %8.1f ms %9zu triangles  %s\n", r.milliseconds, r.triangles, r.path.data());
+					break;
+				case engine::asset_cooker::SKIPPED:
+					++skipped;
+					if (not quiet)
+						std::printf("  skipped %8.1f ms                      %s\n", r.milliseconds, r.path.data());
+					break;
+				case engine::asset_cooker::FAILED:
+					++failed;
+					std::printf("  failed  %8.1f ms                      %s: %s\n", r.milliseconds, r.path.data(), r.error.data());
+					break;
+			}
+		}
+
+		std::printf("%zu cooked (%.1f MB of source), %zu skipped, %zu failed in %.1f ms\n",
+					cooked, static_cast<double>(bytes) / (1024.0 * 1024.0), skipped, failed,
+					std::chrono::duration<double, std::milli>(end - start).count());
+
+		if (failed != 0U)
+			return EXIT_FAILURE;
+
+	} catch (const std::exception& except) {
+		std::cerr << except.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}